@@ -1025,6 +1025,89 @@ static void arith(void) {
 	crt_free(crt);
 }
 
+static void polynomial(void) {
+	const size_t n = 1024;
+	bn_t m, *a = (bn_t *)calloc(n, sizeof(bn_t));
+	dig_t *u = (dig_t *)calloc(2 * n * RLC_BN_DIGS, sizeof(dig_t));
+	dig_t *v = (dig_t *)calloc(2 * n * RLC_BN_DIGS, sizeof(dig_t));
+	dig_t *w = (dig_t *)calloc(2 * n * RLC_BN_DIGS, sizeof(dig_t));
+	bn_pol_t p;
+
+	if (a == NULL || u == NULL || v == NULL || w == NULL) {
+		free((void *)a);
+		free(u);
+		free(v);
+		free(w);
+		return;
+	}
+
+	bn_null(m);
+	bn_new(m);
+	for (size_t i = 0; i < n; i++) {
+		bn_null(a[i]);
+		bn_new(a[i]);
+	}
+
+	/* Find a prime m such that 2^16 divides m - 1. */
+	do {
+		bn_rand(m, RLC_POS, RLC_MIN(240, RLC_BN_BITS - 16));
+		bn_lsh(m, m, 16);
+		bn_add_dig(m, m, 1);
+	} while (!bn_is_prime(m));
+
+	BENCH_ONE("bn_pol_pre", bn_pol_pre(p, m), 1);
+
+	for (size_t i = 0; i < n; i++) {
+		bn_rand_mod(a[i], m);
+	}
+	bn_pol_set(u, a, n, p);
+	bn_pol_set(v, a, n, p);
+
+	BENCH_RUN("bn_pol_ntt (1024)") {
+		BENCH_ADD(bn_pol_ntt(u, n, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_pol_itt (1024)") {
+		BENCH_ADD(bn_pol_itt(u, n, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_pol_mul (512)") {
+		BENCH_ADD(bn_pol_mul(w, u, n / 2, v, n / 2, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_pol_lag (1024)") {
+		BENCH_ADD(bn_pol_lag(w, u, n, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_pol_evl (1024)") {
+		BENCH_ADD(bn_pol_evl(w, u, n, v, n, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_pol_itp (1024)") {
+		BENCH_ADD(bn_pol_itp(w, u, v, n, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("bn_lag (1024)") {
+		BENCH_ADD(bn_lag(a, a, m, n));
+	}
+	BENCH_END;
+
+	bn_free(m);
+	for (size_t i = 0; i < n; i++) {
+		bn_free(a[i]);
+	}
+	free((void *)a);
+	free(u);
+	free(v);
+	free(w);
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -1038,6 +1121,8 @@ int main(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	util_banner("Polynomials:", 1);
+	polynomial();
 
 	core_clean();
 	return 0;
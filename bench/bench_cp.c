@@ -372,20 +372,45 @@ static void ecies(void) {
 	bn_free(d);
 }
 
+/**
+ * Inputs shared by the threads verifying ECDSA signatures.
+ */
+typedef struct {
+	/** The signed message. */
+	uint8_t msg[5];
+	/** The signature. */
+	bn_t r, s;
+	/** The public key. */
+	ec_t p;
+} ecdsa_thr_t;
+
+static void ecdsa_ver_thr(void *arg) {
+	ecdsa_thr_t *a = (ecdsa_thr_t *)arg;
+
+	cp_ecdsa_ver(a->r, a->s, a->msg, sizeof(a->msg), 0, a->p);
+}
+
 static void ecdsa(void) {
 	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN];
+	ecdsa_thr_t a;
 	bn_t r, s, d;
 	ec_t p;
+	ec_pubkey_t k;
+	ec_cache_t c;
+	uint8_t b[2 * RLC_FC_BYTES + 1];
+	size_t l;
 
 	bn_null(r);
 	bn_null(s);
 	bn_null(d);
 	ec_null(p);
+	ec_pubkey_null(k);
 
 	bn_new(r);
 	bn_new(s);
 	bn_new(d);
 	ec_new(p);
+	ec_pubkey_new(k);
 
 	BENCH_RUN("cp_ecdsa_gen") {
 		BENCH_ADD(cp_ecdsa_gen(d, p));
@@ -414,26 +439,66 @@ static void ecdsa(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("cp_ecpk_pre") {
+		BENCH_ADD(cp_ecpk_pre(k, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_ecdsa_ver_pre (h = 1)") {
+		md_map(h, msg, 5);
+		BENCH_ADD(cp_ecdsa_ver_pre(r, s, h, RLC_MD_LEN, 1, k));
+	}
+	BENCH_END;
+
+	cp_ecpk_init(c, 1 << 20);
+	l = ec_size_bin(p, 1);
+	ec_write_bin(b, l, p, 1);
+	BENCH_RUN("cp_ecpk_get (hit)") {
+		BENCH_ADD(cp_ecpk_get(c, b, l));
+	}
+	BENCH_END;
+	cp_ecpk_clean(c);
+
+	bn_null(a.r);
+	bn_null(a.s);
+	ec_null(a.p);
+	bn_new(a.r);
+	bn_new(a.s);
+	ec_new(a.p);
+
+	memcpy(a.msg, msg, sizeof(msg));
+	cp_ecdsa_sig(a.r, a.s, a.msg, sizeof(a.msg), 0, d);
+	ec_copy(a.p, p);
+	bench_thread("cp_ecdsa_ver", ecdsa_ver_thr, &a);
+
+	bn_free(a.r);
+	bn_free(a.s);
+	ec_free(a.p);
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
 	ec_free(p);
+	ec_pubkey_free(k);
 }
 
 static void ecss(void) {
 	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
 	bn_t r, s, d;
 	ec_t p;
+	ec_pubkey_t k;
 
 	bn_null(r);
 	bn_null(s);
 	bn_null(d);
 	ec_null(p);
+	ec_pubkey_null(k);
 
 	bn_new(r);
 	bn_new(s);
 	bn_new(d);
 	ec_new(p);
+	ec_pubkey_new(k);
 
 	BENCH_RUN("cp_ecss_gen") {
 		BENCH_ADD(cp_ecss_gen(d, p));
@@ -450,10 +515,17 @@ static void ecss(void) {
 	}
 	BENCH_END;
 
+	cp_ecpk_pre(k, p);
+	BENCH_RUN("cp_ecss_ver_pre") {
+		BENCH_ADD(cp_ecss_ver_pre(r, s, msg, 5, k));
+	}
+	BENCH_END;
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
 	ec_free(p);
+	ec_pubkey_free(k);
 }
 
 static void vbnn(void) {
@@ -731,6 +803,149 @@ static int pedersen(void) {
 	return code;
 }
 
+/**
+ * Maximum length of the vectors in the inner product argument benchmarks.
+ */
+#define IPA_MAX		4096
+
+/**
+ * Commits to two vectors as P = <a, g> + <b, h> + <a, b> * u.
+ */
+static void ipa_com(ec_t p, ec_t *t, bn_t *k, const ec_t *g, const ec_t *h,
+		const ec_t u, const bn_t *a, const bn_t *b, int n) {
+	bn_t o;
+
+	bn_null(o);
+	bn_new(o);
+
+	bn_zero(k[2 * n]);
+	for (int i = 0; i < n; i++) {
+		bn_copy(k[i], a[i]);
+		bn_copy(k[n + i], b[i]);
+		bn_mul(o, a[i], b[i]);
+		bn_add(k[2 * n], k[2 * n], o);
+		ec_copy(t[i], g[i]);
+		ec_copy(t[n + i], h[i]);
+	}
+	ec_curve_get_ord(o);
+	bn_mod(k[2 * n], k[2 * n], o);
+	ec_copy(t[2 * n], u);
+	ec_mul_sim_lot(p, (const ec_t *)t, (const bn_t *)k, 2 * n + 1);
+
+	bn_free(o);
+}
+
+/**
+ * Benchmarks the inner product argument for vectors of length N.
+ */
+#define IPA_BENCH(N)														\
+	ipa_com(p, t, k, (const ec_t *)g, (const ec_t *)h, u, (const bn_t *)a,	\
+			(const bn_t *)b, N);											\
+	BENCH_ONE("cp_ipa_prv (" #N ")", cp_ipa_prv(l, r, x, y, p,				\
+			(const ec_t *)g, (const ec_t *)h, u, (const bn_t *)a,			\
+			(const bn_t *)b, N), 1);										\
+	BENCH_ONE("cp_ipa_ver (" #N ")", cp_ipa_ver(p, (const ec_t *)l,			\
+			(const ec_t *)r, x, y, (const ec_t *)g, (const ec_t *)h, u, N), 1);
+
+static int ipa(void) {
+	int code = RLC_ERR;
+	ec_t p, u, l[12], r[12], *g, *h, *t;
+	bn_t n, x, y, *a, *b, *k;
+
+	g = (ec_t *)calloc(IPA_MAX, sizeof(ec_t));
+	h = (ec_t *)calloc(IPA_MAX, sizeof(ec_t));
+	t = (ec_t *)calloc(2 * IPA_MAX + 1, sizeof(ec_t));
+	a = (bn_t *)calloc(IPA_MAX, sizeof(bn_t));
+	b = (bn_t *)calloc(IPA_MAX, sizeof(bn_t));
+	k = (bn_t *)calloc(2 * IPA_MAX + 1, sizeof(bn_t));
+	if (g == NULL || h == NULL || t == NULL || a == NULL || b == NULL ||
+			k == NULL) {
+		free((void *)g);
+		free((void *)h);
+		free((void *)t);
+		free((void *)a);
+		free((void *)b);
+		free((void *)k);
+		return code;
+	}
+
+	bn_null(n);
+	bn_null(x);
+	bn_null(y);
+	ec_null(p);
+	ec_null(u);
+
+	bn_new(n);
+	bn_new(x);
+	bn_new(y);
+	ec_new(p);
+	ec_new(u);
+	for (int i = 0; i < 12; i++) {
+		ec_null(l[i]);
+		ec_null(r[i]);
+		ec_new(l[i]);
+		ec_new(r[i]);
+	}
+	for (int i = 0; i <= 2 * IPA_MAX; i++) {
+		ec_null(t[i]);
+		bn_null(k[i]);
+		ec_new(t[i]);
+		bn_new(k[i]);
+	}
+
+	ec_curve_get_ord(n);
+	for (int i = 0; i < IPA_MAX; i++) {
+		ec_null(g[i]);
+		ec_null(h[i]);
+		bn_null(a[i]);
+		bn_null(b[i]);
+		ec_new(g[i]);
+		ec_new(h[i]);
+		bn_new(a[i]);
+		bn_new(b[i]);
+		bn_rand_mod(a[i], n);
+		bn_rand_mod(b[i], n);
+	}
+
+	BENCH_ONE("cp_ipa_gen (64)", cp_ipa_gen(g, h, u, 64), 1);
+	cp_ipa_gen(g, h, u, IPA_MAX);
+
+	IPA_BENCH(64);
+	IPA_BENCH(128);
+	IPA_BENCH(256);
+	IPA_BENCH(512);
+	IPA_BENCH(1024);
+	IPA_BENCH(2048);
+	IPA_BENCH(4096);
+
+	bn_free(n);
+	bn_free(x);
+	bn_free(y);
+	ec_free(p);
+	ec_free(u);
+	for (int i = 0; i < 12; i++) {
+		ec_free(l[i]);
+		ec_free(r[i]);
+	}
+	for (int i = 0; i <= 2 * IPA_MAX; i++) {
+		ec_free(t[i]);
+		bn_free(k[i]);
+	}
+	for (int i = 0; i < IPA_MAX; i++) {
+		ec_free(g[i]);
+		ec_free(h[i]);
+		bn_free(a[i]);
+		bn_free(b[i]);
+	}
+	free((void *)g);
+	free((void *)h);
+	free((void *)t);
+	free((void *)a);
+	free((void *)b);
+	free((void *)k);
+	return code;
+}
+
 static int oprf(void) {
 	int code = RLC_ERR;
 	ec_t c, h;
@@ -1271,10 +1486,32 @@ static void bgn(void) {
 	}
 }
 
-static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
+/**
+ * Inputs shared by the threads verifying BLS signatures.
+ */
+typedef struct {
+	/** The signed message. */
+	uint8_t msg[5];
+	/** The signature. */
 	g1_t s;
+	/** The public key. */
 	g2_t p;
+} bls_thr_t;
+
+static void bls_ver_thr(void *arg) {
+	bls_thr_t *a = (bls_thr_t *)arg;
+
+	cp_bls_ver(a->s, a->msg, sizeof(a->msg), a->p);
+}
+
+static void bls(void) {
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
+	const uint8_t *ms[AGGS];
+	size_t ls[AGGS];
+	int b[AGGS];
+	bls_thr_t a;
+	g1_t s, t[AGGS];
+	g2_t p, q[AGGS];
 	bn_t d;
 
 	g1_null(s);
@@ -1300,9 +1537,42 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	g1_null(a.s);
+	g2_null(a.p);
+	g1_new(a.s);
+	g2_new(a.p);
+
+	memcpy(a.msg, msg, sizeof(msg));
+	g1_copy(a.s, s);
+	g2_copy(a.p, p);
+	bench_thread("cp_bls_ver", bls_ver_thr, &a);
+
+	g1_free(a.s);
+	g2_free(a.p);
+
+	for (int i = 0; i < AGGS; i++) {
+		g1_null(t[i]);
+		g2_null(q[i]);
+		g1_new(t[i]);
+		g2_new(q[i]);
+		ms[i] = msg;
+		ls[i] = sizeof(msg);
+		cp_bls_gen(d, q[i]);
+		cp_bls_sig(t[i], msg, sizeof(msg), d);
+	}
+
+	BENCH_RUN("cp_bls_batch_ver (AGGS)") {
+		BENCH_ADD(cp_bls_batch_ver(b, t, ms, ls, AGGS, q));
+	}
+	BENCH_END;
+
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
+	for (int i = 0; i < AGGS; i++) {
+		g1_free(t[i]);
+		g2_free(q[i]);
+	}
 }
 
 static void bbs(void) {
@@ -1723,6 +1993,123 @@ static void zss(void) {
 #define K	RLC_MD_LEN	/* Size of PRF key. */
 //#define BENCH_LHS		/* Uncomment for fine-grained benchmarking. */
 
+/* Opening sizes above 4096 take minutes, so only run them on long benchmarks. */
+#if BENCH > 100
+#define KZG_MAX		65536
+#else
+#define KZG_MAX		4096
+#endif
+#define KZG_K		16
+
+#define KZG_STR(N)	#N
+#define KZG_VAL(N)	KZG_STR(N)
+
+/**
+ * Benchmarks committing and opening polynomials with N coefficients.
+ */
+#define KZG_BENCH(N)														\
+	BENCH_ONE("cp_kzg_com (" #N ")", cp_kzg_com(c[0], (const bn_t *)a, N,	\
+			(const g1_t *)s), 1);											\
+	BENCH_ONE("cp_kzg_prv (" #N ")", cp_kzg_prv(pi[0], y[0],				\
+			(const bn_t *)a, N, z[0], (const g1_t *)s), 1);					\
+	BENCH_ONE("cp_kzg_prv_sim (" #N ", " KZG_VAL(KZG_K) ")",				\
+			cp_kzg_prv_sim(pi[0], y,										\
+			(const bn_t *)a, N, (const bn_t *)z, KZG_K, (const g1_t *)s), 1);
+
+static void kzg(void) {
+	g1_t c[KZG_K], pi[KZG_K], *s;
+	g2_t t[KZG_K + 1];
+	bn_t n, y[KZG_K], z[KZG_K], *a;
+
+	s = (g1_t *)calloc(KZG_MAX, sizeof(g1_t));
+	a = (bn_t *)calloc(KZG_MAX, sizeof(bn_t));
+	if (s == NULL || a == NULL) {
+		free((void *)s);
+		free((void *)a);
+		return;
+	}
+
+	bn_null(n);
+	bn_new(n);
+	pc_get_ord(n);
+	for (int i = 0; i < KZG_K; i++) {
+		g1_null(c[i]);
+		g1_null(pi[i]);
+		bn_null(y[i]);
+		bn_null(z[i]);
+		g1_new(c[i]);
+		g1_new(pi[i]);
+		bn_new(y[i]);
+		bn_new(z[i]);
+		bn_rand_mod(z[i], n);
+	}
+	for (int i = 0; i <= KZG_K; i++) {
+		g2_null(t[i]);
+		g2_new(t[i]);
+	}
+	for (int i = 0; i < KZG_MAX; i++) {
+		g1_null(s[i]);
+		bn_null(a[i]);
+		g1_new(s[i]);
+		bn_new(a[i]);
+		bn_rand_mod(a[i], n);
+	}
+
+	BENCH_ONE("cp_kzg_gen (" KZG_VAL(KZG_MAX) ")",
+			cp_kzg_gen(s, KZG_MAX, t, KZG_K + 1), 1);
+
+	KZG_BENCH(1024);
+	KZG_BENCH(4096);
+#if BENCH > 100
+	KZG_BENCH(16384);
+	KZG_BENCH(65536);
+#endif
+
+	BENCH_RUN("cp_kzg_ver") {
+		cp_kzg_com(c[0], (const bn_t *)a, 64, (const g1_t *)s);
+		cp_kzg_prv(pi[0], y[0], (const bn_t *)a, 64, z[0], (const g1_t *)s);
+		BENCH_ADD(cp_kzg_ver(c[0], z[0], y[0], pi[0], (const g2_t *)t));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_kzg_ver_sim (" KZG_VAL(KZG_K) ")") {
+		cp_kzg_com(c[0], (const bn_t *)a, 64, (const g1_t *)s);
+		cp_kzg_prv_sim(pi[0], y, (const bn_t *)a, 64, (const bn_t *)z, KZG_K,
+				(const g1_t *)s);
+		BENCH_ADD(cp_kzg_ver_sim(c[0], (const bn_t *)z, (const bn_t *)y,
+				KZG_K, pi[0], (const g1_t *)s, (const g2_t *)t));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < KZG_K; i++) {
+		cp_kzg_com(c[i], (const bn_t *)a + i, 64, (const g1_t *)s);
+		cp_kzg_prv(pi[i], y[i], (const bn_t *)a + i, 64, z[i],
+				(const g1_t *)s);
+	}
+	BENCH_RUN("cp_kzg_ver_lot (" KZG_VAL(KZG_K) ")") {
+		BENCH_ADD(cp_kzg_ver_lot((const g1_t *)c, (const bn_t *)z,
+				(const bn_t *)y, (const g1_t *)pi, KZG_K, (const g2_t *)t));
+	}
+	BENCH_END;
+
+	bn_free(n);
+	for (int i = 0; i < KZG_K; i++) {
+		g1_free(c[i]);
+		g1_free(pi[i]);
+		bn_free(y[i]);
+		bn_free(z[i]);
+	}
+	for (int i = 0; i <= KZG_K; i++) {
+		g2_free(t[i]);
+	}
+	for (int i = 0; i < KZG_MAX; i++) {
+		g1_free(s[i]);
+		bn_free(a[i]);
+	}
+	free((void *)s);
+	free((void *)a);
+}
+
 static void lhs(void) {
 	uint8_t k[S][K];
 	bn_t m, n, msg[L], sk[S], d[S], x[S][L];
@@ -2256,6 +2643,7 @@ int main(void) {
 		smlers();
 		etrs();
 		pedersen();
+		ipa();
 		oprf();
 	}
 #endif
@@ -2276,6 +2664,7 @@ int main(void) {
 		mpss();
 #endif
 		zss();
+		kzg();
 		lhs();
 
 		util_banner("Protocols based on accumulators:\n", 0);
@@ -179,6 +179,23 @@ static void util(void) {
 		BENCH_ADD(ep_read_bin(p, bin, l));
 	} BENCH_END;
 
+	BENCH_RUN("ep_read_bin_batch (64)") {
+		uint8_t buf[64 * (1 * RLC_FP_BYTES + 1)];
+		int v[64];
+		ep_t b[64];
+		l = 1 * RLC_FP_BYTES + 1;
+		for (int i = 0; i < 64; i++) {
+			ep_null(b[i]);
+			ep_new(b[i]);
+			ep_rand(b[i]);
+			ep_write_bin(buf + i * l, l, b[i], 1);
+		}
+		BENCH_ADD(ep_read_bin_batch(b, v, buf, l, 64));
+		for (int i = 0; i < 64; i++) {
+			ep_free(b[i]);
+		}
+	} BENCH_END;
+
 	ep_free(p);
 	ep_free(q);
 	for (int j = 0; j < 4; j++) {
@@ -186,9 +203,26 @@ static void util(void) {
 	}
 }
 
+/**
+ * Benchmarks fixed-base multiplication with a serialized table of width W.
+ */
+#define EP_BIN_BENCH(W)														\
+	bin = (uint8_t *)malloc(ep_mul_size_bin(W));							\
+	if (bin != NULL) {														\
+		ep_rand(p);															\
+		BENCH_ONE("ep_mul_pre_bin (" #W ")",								\
+				ep_mul_pre_bin(bin, ep_mul_size_bin(W), p, W), 1);			\
+		BENCH_RUN("ep_mul_fix_bin (" #W ")") {								\
+			bn_rand_mod(k, n);												\
+			BENCH_ADD(ep_mul_fix_bin(q, bin, ep_mul_size_bin(W), k));		\
+		} BENCH_END;														\
+		free(bin);															\
+	}																		\
+
 static void arith(void) {
-	ep_t p, q, r, t[RLC_EP_TABLE_MAX];
-	bn_t k, l[2], n;
+	ep_t p, q, r, t[RLC_EP_TABLE_MAX], u[64];
+	bn_t k, l[2], n, s[64];
+	uint8_t *bin;
 
 	ep_null(p);
 	ep_null(q);
@@ -547,6 +581,11 @@ static void arith(void) {
 		ep_free(t[i]);
 	}
 #endif
+
+	EP_BIN_BENCH(8);
+	EP_BIN_BENCH(12);
+	EP_BIN_BENCH(16);
+
 	BENCH_RUN("ep_mul_sim") {
 		bn_rand_mod(l[0], n);
 		bn_rand_mod(l[1], n);
@@ -614,8 +653,50 @@ static void arith(void) {
 		BENCH_ADD(ep_mul_sim_lot(r, t, l, 2));
 	} BENCH_END;
 
-	for (int i = 0; i < 2; i++) {
-		ep_free(t[i]);
+	for (int i = 0; i < 64; i++) {
+		bn_null(s[i]);
+		ep_null(u[i]);
+		bn_new(s[i]);
+		ep_new(u[i]);
+		bn_rand_mod(s[i], n);
+		ep_rand(u[i]);
+	}
+
+	BENCH_RUN("ep_mul_sim_pip (64)") {
+		bn_rand_mod(s[0], n);
+		BENCH_ADD(ep_mul_sim_pip(r, u, s, 64));
+	} BENCH_END;
+
+	BENCH_RUN("ep_add_batch (32)") {
+		ep_rand(u[0]);
+		BENCH_ADD(ep_add_batch(u, (const ep_t *)u, (const ep_t *)u + 32, 32));
+	} BENCH_END;
+
+	BENCH_RUN("ep_dbl_batch (64)") {
+		ep_rand(u[0]);
+		BENCH_ADD(ep_dbl_batch(u, (const ep_t *)u, 64));
+	} BENCH_END;
+
+	BENCH_RUN("ep_norm_batch (64)") {
+		ep_dbl_batch(u, (const ep_t *)u, 64);
+		BENCH_ADD(ep_norm_batch(u, (const ep_t *)u, 64));
+	} BENCH_END;
+
+	BENCH_RUN("ep_map_batch (8)") {
+		uint8_t msg[4 * RLC_FP_BYTES];
+		const uint8_t *m[8];
+		size_t l[8];
+		rand_bytes(msg, ep_map_rnd_size());
+		for (int i = 0; i < 8; i++) {
+			m[i] = msg;
+			l[i] = ep_map_rnd_size();
+		}
+		BENCH_ADD(ep_map_batch(u, m, l, 8));
+	} BENCH_END;
+
+	for (int i = 0; i < 64; i++) {
+		bn_free(s[i]);
+		ep_free(u[i]);
 	}
 
 	BENCH_RUN("ep_map") {
@@ -675,6 +756,69 @@ static void arith(void) {
 	bn_free(n);
 }
 
+static void context(void) {
+	ctx_t *ctx, *old = core_get();
+	int p0 = ep_param_get(), p1 = 0;
+	ep_t p;
+	bn_t k, n;
+
+	ctx = core_new();
+	if (ctx == NULL) {
+		return;
+	}
+
+	ep_null(p);
+	bn_null(k);
+	bn_null(n);
+
+	ep_new(p);
+	bn_new(k);
+	bn_new(n);
+
+	/* Configure a second curve in its own context. */
+	core_set(ctx);
+	if (ep_param_set_any_endom() == RLC_OK && ep_param_get() != p0) {
+		p1 = ep_param_get();
+	} else if (ep_param_set_any_plain() == RLC_OK && ep_param_get() != p0) {
+		p1 = ep_param_get();
+	}
+	ep_curve_get_ord(k);
+	core_set(old);
+	ep_curve_get_ord(n);
+	/* Use scalars valid on both curves. */
+	if (bn_cmp(k, n) == RLC_LT) {
+		bn_copy(n, k);
+	}
+
+	if (p0 != 0 && p1 != 0) {
+		util_banner("Context switching:", 1);
+		BENCH_RUN("ep_mul_gen (1 curve)") {
+			bn_rand_mod(k, n);
+			BENCH_ADD(ep_mul_gen(p, k));
+		}
+		BENCH_END;
+
+		BENCH_RUN("ep_param_set + ep_mul_gen") {
+			bn_rand_mod(k, n);
+			BENCH_ADD(ep_param_set(p1); ep_mul_gen(p, k);
+				ep_param_set(p0); ep_mul_gen(p, k));
+		}
+		BENCH_DIV(2);
+
+		BENCH_RUN("core_set + ep_mul_gen") {
+			bn_rand_mod(k, n);
+			BENCH_ADD(core_set(ctx); ep_mul_gen(p, k);
+				core_set(old); ep_mul_gen(p, k));
+		}
+		BENCH_DIV(2);
+	}
+
+	ep_free(p);
+	bn_free(k);
+	bn_free(n);
+	core_free(ctx);
+}
+
 static void bench(void) {
 	ep_param_print();
 	util_banner("Utilities:", 1);
@@ -727,6 +871,8 @@ int main(void) {
 		}
 	}
 
+	context();
+
 	core_clean();
 	return 0;
 }
@@ -172,6 +172,23 @@ static void util2(void) {
 		BENCH_ADD(ep2_read_bin(p, bin, l));
 	} BENCH_END;
 
+	BENCH_RUN("ep2_read_bin_batch (64)") {
+		uint8_t buf[64 * (2 * RLC_FP_BYTES + 1)];
+		int v[64];
+		ep2_t b[64];
+		l = 2 * RLC_FP_BYTES + 1;
+		for (int i = 0; i < 64; i++) {
+			ep2_null(b[i]);
+			ep2_new(b[i]);
+			ep2_rand(b[i]);
+			ep2_write_bin(buf + i * l, l, b[i], 1);
+		}
+		BENCH_ADD(ep2_read_bin_batch(b, v, buf, l, 64));
+		for (int i = 0; i < 64; i++) {
+			ep2_free(b[i]);
+		}
+	} BENCH_END;
+
 	ep2_free(p);
 	ep2_free(q);
 	ep2_free(t[0]);
@@ -179,8 +196,8 @@ static void util2(void) {
 }
 
 static void arith2(void) {
-	ep2_t p, q, r, t[RLC_EPX_TABLE_MAX];
-	bn_t k, n, l[2];
+	ep2_t p, q, r, t[RLC_EPX_TABLE_MAX], u[64];
+	bn_t k, n, l[2], v[64];
 	fp2_t s;
 
 	ep2_null(p);
@@ -414,6 +431,19 @@ static void arith2(void) {
 		BENCH_ADD(ep2_mul_cof(q, p));
 	} BENCH_END;
 
+	BENCH_RUN("ep2_mul_cof_sim (8)") {
+		ep2_t b[8];
+		for (int i = 0; i < 8; i++) {
+			ep2_null(b[i]);
+			ep2_new(b[i]);
+			ep2_rand(b[i]);
+		}
+		BENCH_ADD(ep2_mul_cof_sim(b, (const ep2_t *)b, 8));
+		for (int i = 0; i < 8; i++) {
+			ep2_free(b[i]);
+		}
+	} BENCH_END;
+
 	BENCH_RUN("ep2_mul_dig") {
 		bn_rand(k, RLC_POS, RLC_DIG);
 		ep2_rand(p);
@@ -590,6 +620,25 @@ static void arith2(void) {
 		ep2_free(t[i]);
 	}
 
+	for (int i = 0; i < 64; i++) {
+		bn_null(v[i]);
+		ep2_null(u[i]);
+		bn_new(v[i]);
+		ep2_new(u[i]);
+		bn_rand_mod(v[i], n);
+		ep2_rand(u[i]);
+	}
+
+	BENCH_RUN("ep2_mul_sim_pip (64)") {
+		bn_rand_mod(v[0], n);
+		BENCH_ADD(ep2_mul_sim_pip(r, u, v, 64));
+	} BENCH_END;
+
+	for (int i = 0; i < 64; i++) {
+		bn_free(v[i]);
+		ep2_free(u[i]);
+	}
+
 	BENCH_RUN("ep2_frb") {
 		ep2_rand(q);
 		BENCH_ADD(ep2_frb(r, q, 1));
@@ -601,6 +650,24 @@ static void arith2(void) {
 		BENCH_ADD(ep2_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_RUN("ep2_map_batch (8)") {
+		uint8_t msg[5];
+		const uint8_t *m[8];
+		size_t l[8];
+		ep2_t b[8];
+		rand_bytes(msg, 5);
+		for (int i = 0; i < 8; i++) {
+			ep2_null(b[i]);
+			ep2_new(b[i]);
+			m[i] = msg;
+			l[i] = 5;
+		}
+		BENCH_ADD(ep2_map_batch(b, m, l, 8));
+		for (int i = 0; i < 8; i++) {
+			ep2_free(b[i]);
+		}
+	} BENCH_END;
+
 #if EP_MAP == BASIC || !defined(STRIP)
 	BENCH_RUN("ep2_map_basic") {
 		uint8_t msg[5];
@@ -184,7 +184,7 @@ static void util(void) {
 }
 
 static void arith(void) {
-	fp_t a, b, c, f[2];
+	fp_t a, b, c, f[8];
 	dv_t d;
 	bn_t e;
 
@@ -193,16 +193,18 @@ static void arith(void) {
 	fp_null(c);
 	dv_null(d);
 	bn_null(e);
-	fp_null(f[0]);
-	fp_null(f[1]);
+	for (int i = 0; i < 8; i++) {
+		fp_null(f[i]);
+	}
 
 	fp_new(a);
 	fp_new(b);
 	fp_new(c);
 	dv_new(d);
 	bn_new(e);
-	fp_new(f[0]);
-	fp_new(f[1]);
+	for (int i = 0; i < 8; i++) {
+		fp_new(f[i]);
+	}
 
 	dv_zero(d, RLC_DV_DIGS);
 
@@ -356,12 +358,28 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_mul_x8") {
+		for (int i = 0; i < 8; i++) {
+			fp_rand(f[i]);
+		}
+		BENCH_ADD(fp_mul_x8(f, (const fp_t *)f, (const fp_t *)f));
+	}
+	BENCH_END;
+
 	BENCH_RUN("fp_sqr") {
 		fp_rand(a);
 		BENCH_ADD(fp_sqr(c, a));
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_sqr_x8") {
+		for (int i = 0; i < 8; i++) {
+			fp_rand(f[i]);
+		}
+		BENCH_ADD(fp_sqr_x8(f, (const fp_t *)f));
+	}
+	BENCH_END;
+
 #if FP_SQR == BASIC || !defined(STRIP)
 	BENCH_RUN("fp_sqr_basic") {
 		fp_rand(a);
@@ -640,6 +658,15 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("fp_exp_batch (8)") {
+		for (int i = 0; i < 8; i++) {
+			fp_rand(f[i]);
+		}
+		bn_rand(e, RLC_POS, RLC_FP_BITS);
+		BENCH_ADD(fp_exp_batch(f, (const fp_t *)f, e, 8));
+	}
+	BENCH_END;
+
 #if FP_EXP == BASIC || !defined(STRIP)
 	BENCH_RUN("fp_exp_basic") {
 		fp_rand(a);
@@ -724,8 +751,9 @@ static void arith(void) {
 	fp_free(c);
 	dv_free(d);
 	bn_free(e);
-	fp_free(f[0]);
-	fp_free(f[1]);
+	for (int i = 0; i < 8; i++) {
+		fp_free(f[i]);
+	}
 }
 
 int main(void) {
@@ -35,8 +35,14 @@
 #include "relic_bench.h"
 
 static void hash(void) {
-	uint8_t hash[RLC_MD_LEN], buf[256];
-	const uint8_t *dst = (const uint8_t *)"RELIC";
+	uint8_t hash[RLC_MD_LEN], buf[256], out[8 * 256];
+	const uint8_t *dst = (const uint8_t *)"RELIC", *msg[8];
+	size_t len[8];
+
+	for (int i = 0; i < 8; i++) {
+		msg[i] = buf;
+		len[i] = sizeof(buf);
+	}
 
 	BENCH_RUN("md_map (256)") {
 		rand_bytes(buf, sizeof(buf));
@@ -47,6 +53,18 @@ static void hash(void) {
 		rand_bytes(buf, sizeof(buf));
 		BENCH_ADD(md_xmd(buf, sizeof(buf), buf, sizeof(buf), dst, 5));
 	} BENCH_END;
+
+#if MD_MAP == SH256 || !defined(STRIP)
+	BENCH_RUN("md_map_sh256_batch (8 x 256)") {
+		rand_bytes(buf, sizeof(buf));
+		BENCH_ADD(md_map_sh256_batch(out, msg, len, 8));
+	} BENCH_END;
+#endif
+
+	BENCH_RUN("md_xmd_batch (8 x 256)") {
+		rand_bytes(buf, sizeof(buf));
+		BENCH_ADD(md_xmd_batch(out, sizeof(buf), msg, len, 8, dst, 5));
+	} BENCH_END;
 }
 
 int main(void) {
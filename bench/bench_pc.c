@@ -110,6 +110,14 @@ static void util1(void) {
 
 	BENCH_RUN("g1_is_valid") {
 		g1_rand(p);
+		g1_norm(p, p);
+		BENCH_ADD(pc_core_reset(); g1_is_valid(p));
+	} BENCH_END;
+
+	BENCH_RUN("g1_is_valid (cached)") {
+		g1_rand(p);
+		g1_norm(p, p);
+		g1_is_valid(p);
 		BENCH_ADD(g1_is_valid(p));
 	} BENCH_END;
 
@@ -366,6 +374,16 @@ static void util2(void) {
 	BENCH_END;
 
 	BENCH_RUN("g2_is_valid") {
+		g2_rand(p);
+		g2_norm(p, p);
+		BENCH_ADD(pc_core_reset(); g2_is_valid(p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("g2_is_valid (cached)") {
+		g2_rand(p);
+		g2_norm(p, p);
+		g2_is_valid(p);
 		BENCH_ADD(g2_is_valid(p));
 	}
 	BENCH_END;
@@ -792,6 +810,53 @@ static void pairing(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("pc_map_par (AGGS)") {
+		for (size_t i = 0; i < AGGS; i++) {
+			g1_rand(p[i]);
+			g2_rand(q[i]);
+		}
+		BENCH_ADD(pc_map_par(r, p, q, AGGS));
+	}
+	BENCH_END;
+
+#if RLC_GT_EMBED == 12 || RLC_GT_EMBED == 16 || RLC_GT_EMBED == 18 || \
+		RLC_GT_EMBED == 24
+	g2_prep_t w[AGGS];
+
+	for (size_t i = 0; i < AGGS; i++) {
+		g2_prep_null(w[i]);
+		g2_prep_new(w[i]);
+	}
+
+	BENCH_RUN("g2_prep") {
+		g2_rand(q[0]);
+		BENCH_ADD(g2_prep(w[0], q[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pc_map_prep") {
+		g1_rand(p[0]);
+		g2_rand(q[0]);
+		g2_prep(w[0], q[0]);
+		BENCH_ADD(pc_map_prep(r, p[0], w[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pc_map_sim_prep (AGGS)") {
+		for (size_t i = 0; i < AGGS; i++) {
+			g1_rand(p[i]);
+			g2_rand(q[i]);
+			g2_prep(w[i], q[i]);
+		}
+		BENCH_ADD(pc_map_sim_prep(r, p, w, AGGS));
+	}
+	BENCH_END;
+
+	for (size_t i = 0; i < AGGS; i++) {
+		g2_prep_free(w[i]);
+	}
+#endif
+
 	for (size_t i = 0; i < AGGS; i++) {
 		g1_free(p[i]);
 		g2_free(q[i]);
@@ -799,6 +864,77 @@ static void pairing(void) {
 	gt_free(r);
 }
 
+/**
+ * Inputs shared by the threads of a throughput benchmark.
+ */
+typedef struct {
+	/** The point in G_1. */
+	g1_t p;
+	/** The point in G_2. */
+	g2_t q;
+	/** The scalar. */
+	bn_t k;
+} thr_t;
+
+static void g1_mul_thr(void *arg) {
+	thr_t *a = (thr_t *)arg;
+	g1_t r;
+
+	g1_null(r);
+	g1_new(r);
+	g1_mul(r, a->p, a->k);
+	g1_free(r);
+}
+
+static void g2_mul_thr(void *arg) {
+	thr_t *a = (thr_t *)arg;
+	g2_t r;
+
+	g2_null(r);
+	g2_new(r);
+	g2_mul(r, a->q, a->k);
+	g2_free(r);
+}
+
+static void pc_map_thr(void *arg) {
+	thr_t *a = (thr_t *)arg;
+	gt_t e;
+
+	gt_null(e);
+	gt_new(e);
+	pc_map(e, a->p, a->q);
+	gt_free(e);
+}
+
+static void throughput(void) {
+	thr_t a;
+	bn_t n;
+
+	g1_null(a.p);
+	g2_null(a.q);
+	bn_null(a.k);
+	bn_null(n);
+
+	g1_new(a.p);
+	g2_new(a.q);
+	bn_new(a.k);
+	bn_new(n);
+
+	g1_rand(a.p);
+	g2_rand(a.q);
+	pc_get_ord(n);
+	bn_rand_mod(a.k, n);
+
+	bench_thread("g1_mul", g1_mul_thr, &a);
+	bench_thread("g2_mul", g2_mul_thr, &a);
+	bench_thread("pc_map", pc_map_thr, &a);
+
+	g1_free(a.p);
+	g2_free(a.q);
+	bn_free(a.k);
+	bn_free(n);
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -844,6 +980,9 @@ int main(void) {
 	util_banner("Arithmetic:", 1);
 	pairing();
 
+	util_banner("Throughput:", 0);
+	throughput();
+
 	core_clean();
 	return 0;
 }
@@ -480,6 +480,7 @@ static void pairing12(void) {
 	bn_t k, n, l;
 	ep2_t p[2], r;
 	ep_t q[2];
+	pp_prep_t w[2];
 	fp12_t e;
 	int j;
 
@@ -500,6 +501,8 @@ static void pairing12(void) {
 		ep_null(q[j]);
 		ep2_new(p[j]);
 		ep_new(q[j]);
+		pp_prep_null(w[j]);
+		pp_prep_new(w[j]);
 	}
 
 	ep2_curve_get_ord(n);
@@ -682,6 +685,42 @@ static void pairing12(void) {
 	BENCH_END;
 #endif
 
+#if PP_MAP == OATEP || !defined(STRIP)
+	BENCH_RUN("pp_map_par_oatep_k12 (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		BENCH_ADD(pp_map_par_oatep_k12(e, q, p, 2));
+	}
+	BENCH_END;
+#endif
+
+	BENCH_RUN("pp_prep_k12") {
+		ep2_rand(p[0]);
+		BENCH_ADD(pp_prep_k12(w[0], p[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_prep_k12") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		pp_prep_k12(w[0], p[0]);
+		BENCH_ADD(pp_map_prep_k12(e, q[0], w[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sim_prep_k12 (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		pp_prep_k12(w[0], p[0]);
+		pp_prep_k12(w[1], p[1]);
+		BENCH_ADD(pp_map_sim_prep_k12(e, q, w, 2));
+	}
+	BENCH_END;
+
 	bn_free(k);
 	bn_free(n);
 	bn_free(l);
@@ -690,6 +729,7 @@ static void pairing12(void) {
 	for (j = 0; j < 2; j++) {
 		ep2_free(p[j]);
 		ep_free(q[j]);
+		pp_prep_free(w[j]);
 	}
 }
 
@@ -295,6 +295,41 @@ void fp_sqrn_low(dig_t *c, const dig_t *a);
  */
 void fp_sqrm_low(dig_t *c, const dig_t *a);
 
+/**
+ * Multiplies eight pairs of digit vectors with embedded modular reduction.
+ * Computes c[i] = (a[i] * b[i]) mod p for 0 <= i < 8. Each result may alias
+ * the operands with the same index.
+ *
+ * @param[out] c			- the addresses of the results.
+ * @param[in] a				- the addresses of the first digit vectors.
+ * @param[in] b				- the addresses of the second digit vectors.
+ */
+void fp_mulm_x8_low(dig_t **c, const dig_t **a, const dig_t **b);
+
+/**
+ * Squares eight digit vectors with embedded modular reduction. Computes
+ * c[i] = (a[i] * a[i]) mod p for 0 <= i < 8. Each result may alias the
+ * operand with the same index.
+ *
+ * @param[out] c			- the addresses of the results.
+ * @param[in] a				- the addresses of the digit vectors to square.
+ */
+void fp_sqrm_x8_low(dig_t **c, const dig_t **a);
+
+/**
+ * Exponentiates eight digit vectors by a common exponent with embedded modular
+ * reduction, following a sliding window recoding of width RLC_WIDTH. The
+ * backend may keep the intermediate values in its own representation, so the
+ * conversion is paid once per call. The exponent must be non-zero.
+ *
+ * @param[out] c			- the addresses of the results.
+ * @param[in] a				- the addresses of the bases.
+ * @param[in] win			- the windows of the exponent.
+ * @param[in] len			- the number of windows.
+ */
+void fp_expm_x8_low(dig_t **c, const dig_t **a, const uint8_t *win,
+		size_t len);
+
 /**
  * Reduces a digit vector modulo m represented in special form.
  * Computes c = a mod m.
@@ -329,6 +364,65 @@ void fp_invm_low(dig_t *c, const dig_t *a);
  */
 int fp_smbm_low(const dig_t *a);
 
+#if ARITH == X64_DISPATCH
+
+/**
+ * Versions of the functions above for the baseline x64 instruction set,
+ * called through the table filled by arch_init(). @{
+ */
+void fp_mulm_x8_low_base(dig_t **c, const dig_t **a, const dig_t **b);
+void fp_sqrm_x8_low_base(dig_t **c, const dig_t **a);
+void fp_expm_x8_low_base(dig_t **c, const dig_t **a, const uint8_t *win,
+		size_t len);
+/** @} */
+
+#if (FP_PRIME == 330 || FP_PRIME == 354 || FP_PRIME == 377 || \
+		FP_PRIME == 381 || FP_PRIME == 382 || FP_PRIME == 383) && \
+		FP_RDC == MONTY
+/**
+ * Flag indicating that the backend has versions for processors with BMI2 and
+ * ADX, specialized to the modulus of the configured size. Otherwise, the
+ * functions operating on a single element have no faster version and are
+ * called directly instead of through the table.
+ */
+#define FP_LOW_BMI2
+
+/**
+ * Versions of the functions above for the baseline x64 instruction set,
+ * called through the table filled by arch_init(). @{
+ */
+void fp_muln_low_base(dig_t *c, const dig_t *a, const dig_t *b);
+void fp_mulm_low_base(dig_t *c, const dig_t *a, const dig_t *b);
+void fp_sqrn_low_base(dig_t *c, const dig_t *a);
+void fp_sqrm_low_base(dig_t *c, const dig_t *a);
+void fp_rdcn_low_base(dig_t *c, dig_t *a);
+/** @} */
+
+/**
+ * Versions of the functions above for processors with BMI2 and ADX. @{
+ */
+void fp_muln_low_bmi2(dig_t *c, const dig_t *a, const dig_t *b);
+void fp_mulm_low_bmi2(dig_t *c, const dig_t *a, const dig_t *b);
+void fp_sqrn_low_bmi2(dig_t *c, const dig_t *a);
+void fp_sqrm_low_bmi2(dig_t *c, const dig_t *a);
+void fp_rdcn_low_bmi2(dig_t *c, dig_t *a);
+/** @} */
+#endif
+
+/**
+ * Versions of the functions above for processors with AVX-512 IFMA. There is
+ * no AVX2 tier: AVX2 only multiplies 32-bit lanes, so a vector of four
+ * products yields as many partial product bits as a single MULX while adding
+ * carry handling, and every processor with AVX2 also has BMI2. @{
+ */
+void fp_mulm_x8_low_ifma(dig_t **c, const dig_t **a, const dig_t **b);
+void fp_sqrm_x8_low_ifma(dig_t **c, const dig_t **a);
+void fp_expm_x8_low_ifma(dig_t **c, const dig_t **a, const uint8_t *win,
+		size_t len);
+/** @} */
+
+#endif /* X64_DISPATCH */
+
 #endif /* ASM */
 
 #endif /* !RLC_FP_LOW_H */
@@ -29,7 +29,24 @@
  * @ingroup utils
  */
 
+#ifndef RLC_ALLOC_H
+#define RLC_ALLOC_H
+
+#include <stddef.h>
+
 #include "relic_conf.h"
+#include "relic_label.h"
+
+/*
+ * Number of size classes kept in the memory pool, the largest class holding
+ * blocks of 2^(RLC_POOL_CLS + 3) bytes.
+ */
+#define RLC_POOL_CLS			12
+
+/*
+ * Maximum number of free blocks kept in the memory pool for each size class.
+ */
+#define RLC_POOL_MAX			256
 
 #if defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
 
@@ -44,7 +61,7 @@
  * @param[in] T                 - the type of each object.
  * @param[in] S                 - the number of obecs to allocate.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define RLC_ALLOCA(T, S)		(T*) calloc((S), sizeof(T))
 #else
 #define RLC_ALLOCA(T, S)		(T*) _alloca((S) * sizeof(T))
@@ -67,7 +84,7 @@
  * @param[in] T                 - the type of each object.
  * @param[in] S                 - the number of obecs to allocate.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define RLC_ALLOCA(T, S)		(T*) malloc((S) * sizeof(T))
 #else
 #define RLC_ALLOCA(T, S)		(T*) alloca((S) * sizeof(T))
@@ -80,7 +97,7 @@
  *
  * @param[in] A					- the variable to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define RLC_FREE(A)															\
 	if (A != NULL) {														\
 		free((void *)A);													\
@@ -89,3 +106,71 @@
 #else
 #define RLC_FREE(A)         	(void)A;
 #endif
+
+/*
+ * Allocates and clears memory for a single element of "Type" under dynamic
+ * allocation, taking the memory from the thread pool if enabled.
+ *
+ * @param[in] T					- the type of the element.
+ */
+#if ALLOC == POOL
+#define RLC_NEW(T)				pool_calloc(1, sizeof(T))
+#else
+#define RLC_NEW(T)				calloc(1, sizeof(T))
+#endif
+
+/*
+ * Frees memory allocated with RLC_NEW.
+ *
+ * @param[in] A					- the variable to free.
+ */
+#if ALLOC == POOL
+#define RLC_DEL(A)				pool_free((void *)(A))
+#else
+#define RLC_DEL(A)				free((void *)(A))
+#endif
+
+#if ALLOC == POOL
+
+/**
+ * Allocates a memory block from the thread pool.
+ *
+ * @param[in] size				- the number of bytes to allocate.
+ * @return the allocated block, or NULL if there is no available memory.
+ */
+void *pool_alloc(size_t size);
+
+/**
+ * Allocates a cleared memory block for an array from the thread pool.
+ *
+ * @param[in] n					- the number of elements.
+ * @param[in] size				- the size of each element in bytes.
+ * @return the allocated block, or NULL if there is no available memory.
+ */
+void *pool_calloc(size_t n, size_t size);
+
+/**
+ * Changes the size of a memory block allocated from the thread pool,
+ * preserving its contents.
+ *
+ * @param[in] ptr				- the block to resize, or NULL.
+ * @param[in] size				- the new size in bytes.
+ * @return the resized block, or NULL if there is no available memory.
+ */
+void *pool_realloc(void *ptr, size_t size);
+
+/**
+ * Returns a memory block to the thread pool.
+ *
+ * @param[in] ptr				- the block to free, or NULL.
+ */
+void pool_free(void *ptr);
+
+/**
+ * Releases all free memory blocks kept in the thread pool.
+ */
+void pool_clean(void);
+
+#endif /* ALLOC == POOL */
+
+#endif /* !RLC_ALLOC_H */
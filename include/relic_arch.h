@@ -43,6 +43,22 @@
 #include <avr/pgmspace.h>
 #endif
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+#if ARCH == X64
+/**
+ * Flag for processors supporting the BMI2 and ADX instruction set extensions.
+ */
+#define RLC_ISA_BMI2			0x01
+
+/**
+ * Flag for processors supporting the AVX-512 IFMA instruction set extension.
+ */
+#define RLC_ISA_IFMA			0x02
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -100,6 +116,18 @@ uint_t arch_lzcnt(dig_t);
  */
 uint_t arch_tzcnt(dig_t);
 
+#if ARCH == X64
+
+/**
+ * Detects the instruction set extensions supported by the processor and the
+ * operating system.
+ *
+ * @return a combination of the RLC_ISA_* flags.
+ */
+uint_t arch_isa(void);
+
+#endif
+
 #if ARCH == AVR
 
 /**
@@ -52,6 +52,32 @@ extern "C" {
 #include <linux/perf_event.h>
 #endif
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Maximum number of measurements kept for computing the statistics of a
+ * benchmark.
+ */
+#define RLC_BENCH_SAMPLES	1024
+
+/**
+ * Maximum length of a benchmark label, including the terminating null byte.
+ */
+#define RLC_BENCH_LABEL		64
+
+/**
+ * Default tolerance, in percent, above which a benchmark slower than its
+ * baseline is flagged as a regression.
+ */
+#define RLC_BENCH_TOL		5
+
+/**
+ * Maximum number of performance counters read together around a benchmark.
+ */
+#define RLC_BENCH_EVENTS	8
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -65,7 +91,7 @@ extern "C" {
  */
 #define BENCH_ONE(LABEL, FUNCTION, N)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	bench_before();															\
 	FUNCTION;																\
 	bench_after();															\
@@ -82,7 +108,7 @@ extern "C" {
  */
 #define BENCH_FEW(LABEL, FUNCTION, N)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	bench_before();															\
 	for (int i = 0; i < BENCH; i++)	{										\
 		FUNCTION;															\
@@ -98,7 +124,7 @@ extern "C" {
  */
 #define BENCH_RUN(LABEL)													\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	for (int _b = 0; _b < BENCH; _b++)	{									\
 
 /**
@@ -165,12 +191,34 @@ typedef ull_t ben_t;
 
 #endif
 
+/**
+ * Represents the result of a benchmark read from a baseline file.
+ */
+typedef struct {
+	/** The label of the benchmark. */
+	char label[RLC_BENCH_LABEL];
+	/** The median timing of the benchmark. */
+	ull_t med;
+} ben_ref_t;
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
 
 /**
- * Initializes the benchmarking module.
+ * Initializes the benchmarking module. Results are also exported when the
+ * following environment variables are set:
+ *
+ * - RELIC_BENCH_JSON: file where results are appended as JSON lines;
+ * - RELIC_BENCH_CSV: file where results are appended as CSV records;
+ * - RELIC_BENCH_BASE: CSV file from a previous run used as baseline;
+ * - RELIC_BENCH_TOL: tolerance in percent for flagging a median timing slower
+ *   than the baseline as a regression (default is RLC_BENCH_TOL);
+ * - RELIC_BENCH_EVENTS: comma-separated performance counters read around each
+ *   benchmark when TIMER = PERF, among instructions, cycles, l1d-misses,
+ *   llc-misses, branch-misses, task-clock, context-switches and page-faults.
+ *   By default, all hardware counters are read, and the software counters are
+ *   used instead when hardware counters are not available.
  */
 void bench_init(void);
 
@@ -186,10 +234,15 @@ void bench_overhead(void);
 
 /**
  * Resets the benchmark data.
+ */
+void bench_reset(void);
+
+/**
+ * Sets and prints the label of the current benchmark.
  *
  * @param[in] label			- the benchmark label.
  */
-void bench_reset(void);
+void bench_label(const char *label);
 
 /**
  * Measures the time before a benchmark is executed.
@@ -202,14 +255,17 @@ void bench_before(void);
 void bench_after(void);
 
 /**
- * Computes the mean elapsed time between the start and the end of a benchmark.
+ * Computes the mean elapsed time between the start and the end of a benchmark,
+ * together with the distribution of the individual measurements.
  *
  * @param benches			- the number of executed benchmarks.
  */
 void bench_compute(int benches);
 
 /**
- * Prints the last benchmark.
+ * Prints the last benchmark, compares it against the baseline and exports it
+ * to the files chosen in bench_init(). When performance counters are enabled,
+ * also prints the instructions per cycle and the counts per operation.
  */
 void bench_print(void);
 
@@ -220,6 +276,31 @@ void bench_print(void);
  */
 ull_t bench_total(void);
 
+/**
+ * Runs an operation BENCH times on each of 1, 2, 4, ... threads at once, up to
+ * and including CORES threads, and prints the throughput and the scaling
+ * efficiency relative to a single thread. Without MULTI, only one thread is
+ * measured. The operation must only read its inputs, which are shared by all
+ * threads.
+ *
+ * @param[in] label			- the benchmark label.
+ * @param[in] func			- the operation to benchmark.
+ * @param[in] arg			- the inputs of the operation.
+ */
+void bench_thread(const char *label, void (*func)(void *), void *arg);
+
+/**
+ * Returns the distribution of the measurements of the last benchmark, each
+ * amortized in the same way as the mean.
+ *
+ * @param[out] min			- the minimum timing.
+ * @param[out] med			- the median timing.
+ * @param[out] p90			- the 90th percentile.
+ * @param[out] p99			- the 99th percentile.
+ * @param[out] dev			- the standard deviation.
+ */
+void bench_stats(ull_t *min, ull_t *med, ull_t *p90, ull_t *p99, ull_t *dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,6 +40,7 @@
 #include "relic_util.h"
 #include "relic_types.h"
 #include "relic_label.h"
+#include "relic_alloc.h"
 
 /*============================================================================*/
 /* Constant definitions                                                       */
@@ -81,6 +82,12 @@
  */
 #define RLC_NEG		1
 
+/**
+ * Number of coefficients from which polynomial arithmetic modulo a prime
+ * switches from quadratic to subquadratic algorithms.
+ */
+#define RLC_BN_POL		32
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -99,7 +106,7 @@ typedef struct {
 	size_t used;
 	/** The sign of this multiple precision integer. */
 	int sign;
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	/** The sequence of contiguous digits that forms this integer. */
 	dig_t *dp;
 #elif ALLOC == AUTO
@@ -113,7 +120,7 @@ typedef struct {
  */
 #if ALLOC == AUTO
 typedef bn_st bn_t[1];
-#elif ALLOC == DYNAMIC
+#elif ALLOC != AUTO
 #ifdef CHECK
 typedef bn_st *volatile bn_t;
 #else
@@ -139,6 +146,34 @@ typedef struct {
 	bn_t qi;
 } crt_st;
 
+/**
+ * Represents the precomputed constants for polynomial arithmetic modulo an odd
+ * integer. Coefficients are stored in Montgomery form as contiguous vectors
+ * of w digits each, so that a polynomial with n coefficients occupies n * w
+ * digits.
+ */
+typedef struct {
+	/** The modulus. */
+	dig_t m[RLC_BN_DIGS];
+	/** The number of digits in each coefficient. */
+	size_t w;
+	/** The Montgomery reciprocal of the modulus. */
+	dig_t u;
+	/** The constant R^2 mod m for conversion to Montgomery form. */
+	dig_t r2[RLC_BN_DIGS];
+	/** The constant one in Montgomery form. */
+	dig_t one[RLC_BN_DIGS];
+	/** The logarithm of the largest transform length supported. */
+	size_t s;
+	/** A principal (2^s)-th root of unity in Montgomery form. */
+	dig_t root[RLC_BN_DIGS];
+} bn_pol_st;
+
+/**
+ * Pointer to the precomputed constants for polynomial arithmetic.
+ */
+typedef bn_pol_st bn_pol_t[1];
+
 #if ALLOC == AUTO
 typedef crt_st crt_t[1];
 #else
@@ -156,7 +191,7 @@ typedef crt_st *crt_t;
  */
 #if ALLOC == AUTO
 #define bn_null(A)			/* empty */
-#elif ALLOC == DYNAMIC
+#elif ALLOC != AUTO
 #define bn_null(A)			A = NULL;
 #endif
 
@@ -166,9 +201,9 @@ typedef crt_st *crt_t;
  * @param[in,out] A			- the multiple precision integer to initialize.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bn_new(A)															\
-	A = (bn_t)calloc(1, sizeof(bn_st));										\
+	A = (bn_t)RLC_NEW(bn_st);												\
 	if ((A) == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -190,9 +225,9 @@ typedef crt_st *crt_t;
  * @throw ERR_PRECISION		- if the required precision cannot be represented
  *							by the library.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bn_new_size(A, D)													\
-	A = (bn_t)calloc(1, sizeof(bn_st));										\
+	A = (bn_t)RLC_NEW(bn_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -209,11 +244,11 @@ typedef crt_st *crt_t;
  *
  * @param[in,out] A			- the multiple precision integer to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bn_free(A)															\
 	if (A != NULL) {														\
 		bn_clean(A);														\
-		free((void *)A);													\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}
 
@@ -234,7 +269,7 @@ typedef crt_st *crt_t;
  *
  * @param[out] A			- the new CRT moduli set.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define crt_new(A)															\
 	A = (crt_t)calloc(1, sizeof(crt_st));									\
 	if (A == NULL) {														\
@@ -263,7 +298,7 @@ typedef crt_st *crt_t;
  *
  * @param[out] A			- the CRT moduli set to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define crt_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->n);													\
@@ -1625,5 +1660,126 @@ void bn_lag(bn_t *c, const bn_t *a, const bn_t b, size_t n);
  * @param[in] n				- the degree of the polynomial.
  */
 void bn_evl(bn_t c, const bn_t *a, const bn_t x, const bn_t b, size_t n);
+
+/**
+ * Precomputes the constants for polynomial arithmetic modulo an odd integer,
+ * including a principal root of unity of the largest power-of-two order
+ * dividing m - 1 when one can be found.
+ *
+ * @param[out] p			- the precomputed constants.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is even or too large.
+ */
+void bn_pol_pre(bn_pol_t p, const bn_t m);
+
+/**
+ * Converts a vector of multiple precision integers to polynomial coefficients.
+ *
+ * @param[out] c			- the coefficients.
+ * @param[in] a				- the integers to convert.
+ * @param[in] n				- the number of integers.
+ * @param[in] p				- the precomputed constants.
+ */
+void bn_pol_set(dig_t *c, const bn_t *a, size_t n, const bn_pol_t p);
+
+/**
+ * Converts polynomial coefficients back to multiple precision integers.
+ *
+ * @param[out] c			- the integers.
+ * @param[in] a				- the coefficients to convert.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] p				- the precomputed constants.
+ */
+void bn_pol_get(bn_t *c, const dig_t *a, size_t n, const bn_pol_t p);
+
+/**
+ * Computes the number theoretic transform of a polynomial in place, that is,
+ * evaluates it on the powers of a principal n-th root of unity. Outputs are
+ * produced in natural order.
+ *
+ * @param[in,out] a			- the coefficients.
+ * @param[in] n				- the number of coefficients, a power of two.
+ * @param[in] p				- the precomputed constants.
+ * @throw ERR_NO_VALID		- if the length is not supported by the modulus.
+ */
+void bn_pol_ntt(dig_t *a, size_t n, const bn_pol_t p);
+
+/**
+ * Computes the inverse number theoretic transform of a polynomial in place.
+ *
+ * @param[in,out] a			- the evaluations.
+ * @param[in] n				- the number of evaluations, a power of two.
+ * @param[in] p				- the precomputed constants.
+ * @throw ERR_NO_VALID		- if the length is not supported by the modulus.
+ */
+void bn_pol_itt(dig_t *a, size_t n, const bn_pol_t p);
+
+/**
+ * Multiplies two polynomials, producing na + nb - 1 coefficients. The result
+ * may overlap the inputs.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the coefficients of the first polynomial.
+ * @param[in] na			- the number of coefficients of the first polynomial.
+ * @param[in] b				- the coefficients of the second polynomial.
+ * @param[in] nb			- the number of coefficients of the second polynomial.
+ * @param[in] p				- the precomputed constants.
+ */
+void bn_pol_mul(dig_t *c, const dig_t *a, size_t na, const dig_t *b, size_t nb,
+		const bn_pol_t p);
+
+/**
+ * Divides a polynomial by a monic polynomial, producing na - nb + 1
+ * coefficients of quotient and nb - 1 coefficients of remainder. Either
+ * output may be NULL, and outputs must not overlap the inputs.
+ *
+ * @param[out] q			- the quotient.
+ * @param[out] r			- the remainder.
+ * @param[in] a				- the dividend.
+ * @param[in] na			- the number of coefficients of the dividend.
+ * @param[in] b				- the monic divisor.
+ * @param[in] nb			- the number of coefficients of the divisor.
+ * @param[in] p				- the precomputed constants.
+ */
+void bn_pol_div(dig_t *q, dig_t *r, const dig_t *a, size_t na, const dig_t *b,
+		size_t nb, const bn_pol_t p);
+
+/**
+ * Computes the n + 1 coefficients of the monic polynomial with the given n
+ * roots, that is, c(x) = \prod_{0 <= i < n}(x - ai), with a product tree.
+ *
+ * @param[out] c			- the coefficients of the polynomial.
+ * @param[in] a				- the roots.
+ * @param[in] n				- the number of roots.
+ * @param[in] p				- the precomputed constants.
+ */
+void bn_pol_lag(dig_t *c, const dig_t *a, size_t n, const bn_pol_t p);
+
+/**
+ * Evaluates a polynomial on a set of points with a remainder tree.
+ *
+ * @param[out] c			- the evaluations.
+ * @param[in] a				- the coefficients of the polynomial.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] x				- the points.
+ * @param[in] m				- the number of points.
+ * @param[in] p				- the precomputed constants.
+ */
+void bn_pol_evl(dig_t *c, const dig_t *a, size_t n, const dig_t *x, size_t m,
+		const bn_pol_t p);
+
+/**
+ * Interpolates the polynomial with n coefficients that takes the values y on
+ * the distinct points x.
+ *
+ * @param[out] c			- the coefficients of the polynomial.
+ * @param[in] x				- the points.
+ * @param[in] y				- the values.
+ * @param[in] n				- the number of points.
+ * @param[in] p				- the precomputed constants.
+ * @throw ERR_NO_VALID		- if the differences of points are not invertible.
+ */
+void bn_pol_itp(dig_t *c, const dig_t *x, const dig_t *y, size_t n,
+		const bn_pol_t p);
 	
 #endif /* !RLC_BN_H */
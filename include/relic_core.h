@@ -133,12 +133,60 @@ extern "C" {
 /* Type definitions                                                           */
 /*============================================================================*/
 
+/**
+ * Precomputed tables that depend only on the configured fields and curves.
+ * They are computed once and can be shared read-only by the contexts of
+ * several threads.
+ */
+typedef struct _pre_t {
+	/** Number of library contexts using these parameters. */
+	int refs;
+#ifdef WITH_FB
+#if FB_SLV == QUICK || !defined(STRIP)
+	/** Table of precomputed half-traces. */
+	fb_st fb_half[(RLC_DIG / 8 + 1) * RLC_FB_DIGS][16];
+#endif /* FB_SLV == QUICK */
+#if FB_SRT == QUICK || !defined(STRIP)
+#ifdef FB_PRECO
+	/** Multiplication table for the polynomial z^(1/2). */
+	fb_st fb_tab_srz[256];
+#endif /* FB_PRECO */
+#endif /* FB_SRT == QUICK */
+#if FB_INV == ITOHT || !defined(STRIP)
+	/** Tables for repeated squarings. */
+	fb_st fb_tab_sqr[RLC_TERMS][RLC_FB_TABLE];
+#endif /* FB_INV == ITOHT */
+#endif /* WITH_FB */
+#if defined(WITH_EB) && defined(EB_PRECO)
+	/** Precomputation table for generator multiplication. */
+	eb_st eb_pre[RLC_EB_TABLE];
+#endif /* WITH_EB && EB_PRECO */
+#if defined(WITH_EP) && defined(EP_PRECO)
+	/** Precomputation table for generator multiplication. */
+	ep_st ep_pre[RLC_EP_TABLE];
+#endif /* WITH_EP && EP_PRECO */
+#if defined(WITH_EPX) && defined(EP_PRECO)
+	/** Precomputation tables for generator multiplication in extensions. @{ */
+	ep2_st ep2_pre[RLC_EP_TABLE];
+	ep3_st ep3_pre[RLC_EP_TABLE];
+	ep4_st ep4_pre[RLC_EP_TABLE];
+	ep8_st ep8_pre[RLC_EP_TABLE];
+	/** @} */
+#endif /* WITH_EPX && EP_PRECO */
+#if defined(WITH_ED) && defined(ED_PRECO)
+	/** Precomputation table for generator multiplication. */
+	ed_st ed_pre[RLC_ED_TABLE];
+#endif /* WITH_ED && ED_PRECO */
+} pre_t;
+
 /**
  * Library context.
  */
 typedef struct _ctx_t {
 	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
 	int code;
+	/** Precomputed tables, possibly shared with other contexts. */
+	pre_t *pre;
 
 #ifdef CHECK
 	/** The state of the last error caught. */
@@ -166,25 +214,15 @@ typedef struct _ctx_t {
 	/** Powers of z with non-zero traces. */
 	int fb_ta, fb_tb, fb_tc;
 #endif /* FB_TRC == QUICK */
-#if FB_SLV == QUICK || !defined(STRIP)
-	/** Table of precomputed half-traces. */
-	fb_st fb_half[(RLC_DIG / 8 + 1) * RLC_FB_DIGS][16];
-#endif /* FB_SLV == QUICK */
 #if FB_SRT == QUICK || !defined(STRIP)
 	/** Square root of z. */
 	fb_st fb_srz;
-#ifdef FB_PRECO
-	/** Multiplication table for the polynomial z^(1/2). */
-	fb_st fb_tab_srz[256];
-#endif /* FB_PRECO */
 #endif /* FB_SRT == QUICK */
 #if FB_INV == ITOHT || !defined(STRIP)
 	/** Stores an addition chain for (RLC_FB_BITS - 1). */
 	int chain[RLC_TERMS + 1];
 	/** Stores the length of the addition chain. */
 	int chain_len;
-	/** Tables for repeated squarings. */
-	fb_st fb_tab_sqr[RLC_TERMS][RLC_FB_TABLE];
 #endif /* FB_INV == ITOHT */
 #endif /* WITH_FB */
 
@@ -208,8 +246,6 @@ typedef struct _ctx_t {
 	/** Flag that stores if the binary curve has efficient endomorphisms. */
 	int eb_is_kbltz;
 #ifdef EB_PRECO
-	/** Precomputation table for generator multiplication. */
-	eb_st eb_pre[RLC_EB_TABLE];
 	/** Array of pointers to the precomputation table. */
 	eb_st *eb_ptr[RLC_EB_TABLE];
 #endif /* EB_PRECO */
@@ -303,8 +339,6 @@ typedef struct _ctx_t {
 	/** Flag that indicates whether this curve uses an isogeny for the SSWU mapping. */
 	int ep_is_ctmap;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication. */
-	ep_st ep_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep_st *ep_ptr[RLC_EP_TABLE];
 #endif /* EP_PRECO */
@@ -340,8 +374,6 @@ typedef struct _ctx_t {
 	/** Flag that indicates whether this curve uses an isogeny for the SSWU mapping. */
 	int ep2_is_ctmap;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication.*/
-	ep2_st ep2_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep2_st *ep2_ptr[RLC_EP_TABLE];
 #endif /* EP_PRECO */
@@ -368,8 +400,6 @@ typedef struct _ctx_t {
 	/** Flag that stores if the prime curve is a twist. */
 	int ep3_is_twist;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication.*/
-	ep3_st ep3_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep3_st *ep3_ptr[RLC_EP_TABLE];
 #endif /* EP_PRECO */
@@ -390,8 +420,6 @@ typedef struct _ctx_t {
 	/** Flag that stores if the prime curve is a twist. */
 	int ep4_is_twist;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication.*/
-	ep4_st ep4_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep4_st *ep4_ptr[RLC_EP_TABLE];
 #endif /* EP_PRECO */
@@ -412,8 +440,6 @@ typedef struct _ctx_t {
 	/** Flag that stores if the prime curve is a twist. */
 	int ep8_is_twist;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication.*/
-	ep8_st ep8_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep8_st *ep8_ptr[RLC_EP_TABLE];
 #endif /* EP_PRECO */
@@ -436,8 +462,6 @@ typedef struct _ctx_t {
 	bn_st ed_h;
 
 #ifdef ED_PRECO
-	/** Precomputation table for generator multiplication. */
-	ed_st ed_pre[RLC_ED_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ed_st *ed_ptr[RLC_ED_TABLE];
 #endif /* ED_PRECO */
@@ -464,6 +488,8 @@ typedef struct _ctx_t {
 
 #if defined(WITH_PC)
 	gt_t gt_g;
+	/** Digests of the elements recently found to be in G_1 or G_2. */
+	uint8_t pc_val[RLC_PC_VAL][RLC_PC_VLEN];
 #endif
 
 #if BENCH > 0
@@ -473,12 +499,35 @@ typedef struct _ctx_t {
 	ben_t after;
 	/** Stores the sum of timings for the current benchmark. */
 	ull_t total;
+	/** Stores the individual measurements of the current benchmark. */
+	ull_t sample[RLC_BENCH_SAMPLES];
+	/** Stores the number of measurements of the current benchmark. */
+	int count;
+	/** Stores the label of the current benchmark. */
+	char label[RLC_BENCH_LABEL];
+	/** Stores the minimum, median, percentiles and deviation of the timings. */
+	ull_t min, med, p90, p99, dev;
+	/** Files where the results are exported in JSON and CSV formats. */
+	FILE *json, *csv;
+	/** Results read from the baseline file. */
+	ben_ref_t *base;
+	/** Number of results read from the baseline file. */
+	int base_len;
+	/** Tolerance in percent for flagging regressions against the baseline. */
+	int tol;
 #ifdef OVERH
 	/** Benchmarking overhead to be measured and subtracted from benchmarks. */
 	ull_t over;
 #endif
 #endif
 
+#if ALLOC == POOL
+	/** Free lists of memory blocks, one for each size class. */
+	void *pool[RLC_POOL_CLS];
+	/** Number of blocks in each free list. */
+	int pool_len[RLC_POOL_CLS];
+#endif
+
 #if RAND != CALL
 	/** Internal state of the PRNG. */
 	uint8_t rand[RLC_RAND_SIZE];
@@ -496,6 +545,16 @@ typedef struct _ctx_t {
 	int perf_fd;
 	/** Buffer for storing perf data, */
 	struct perf_event_mmap_page *perf_buf;
+	/** File descriptors of the group of counters, the first is the leader. */
+	int perf_grp[RLC_BENCH_EVENTS];
+	/** Indices of the counters in the group in the table of counters. */
+	int perf_evt[RLC_BENCH_EVENTS];
+	/** Number of counters in the group. */
+	int perf_num;
+	/** Counters read before the benchmark, after the enabled/running times. */
+	ull_t perf_val[RLC_BENCH_EVENTS + 2];
+	/** Sum of the counters for the current benchmark. */
+	ull_t perf_sum[RLC_BENCH_EVENTS];
 #endif
 
 	/** Function pointer to underlying lznct implementation. */
@@ -506,6 +565,19 @@ typedef struct _ctx_t {
 	unsigned int (*lzcnt_ptr)(ull_t);
 	unsigned int (*tzcnt_ptr)(ull_t);
 #endif
+
+#if ARITH == X64_DISPATCH
+	/** Function pointers to the prime field backend selected at runtime. @{ */
+	void (*fp_muln_ptr)(dig_t *, const dig_t *, const dig_t *);
+	void (*fp_mulm_ptr)(dig_t *, const dig_t *, const dig_t *);
+	void (*fp_sqrn_ptr)(dig_t *, const dig_t *);
+	void (*fp_sqrm_ptr)(dig_t *, const dig_t *);
+	void (*fp_rdcn_ptr)(dig_t *, dig_t *);
+	void (*fp_mulm_x8_ptr)(dig_t **, const dig_t **, const dig_t **);
+	void (*fp_sqrm_x8_ptr)(dig_t **, const dig_t **);
+	void (*fp_expm_x8_ptr)(dig_t **, const dig_t **, const uint8_t *, size_t);
+	/** @} */
+#endif
 } ctx_t;
 
 /*============================================================================*/
@@ -520,7 +592,43 @@ typedef struct _ctx_t {
 int core_init(void);
 
 /**
- * Finalizes the library with the current error condition.
+ * Initializes the current library context sharing the fields, curves and
+ * precomputed tables already configured in another context. Only the random
+ * number generator and the error state are set up anew, so no parameter is
+ * recomputed. Shared parameters must not be changed while other contexts use
+ * them, and the source context must stay alive until they are finalized. If
+ * the current context is already initialized, it is finalized first, so it
+ * must either be initialized or zeroed.
+ *
+ * @param[in] ctx					- the context to share parameters with.
+ * @return RLC_OK if no error has occurred, RLC_ERR otherwise.
+ */
+int core_share(ctx_t *ctx);
+
+/**
+ * Allocates and initializes a new library context without changing the
+ * current one. Each context keeps its own field, curve and pairing parameters
+ * with their precomputed tables, so a context configured once can serve as a
+ * handle to a curve: switching to it with core_set() is a pointer swap and
+ * recomputes nothing. As digit vectors are sized at build time, all contexts
+ * share the configured prime size FP_PRIME, so handles switch between curves
+ * over primes of that size, such as SECG K-256 and NIST P-256.
+ *
+ * @return the new context, or NULL if an error occurs.
+ */
+ctx_t *core_new(void);
+
+/**
+ * Finalizes and frees a library context allocated with core_new(). If the
+ * context is the current one, there is no current context afterwards.
+ *
+ * @param[in] ctx					- the context to free.
+ */
+void core_free(ctx_t *ctx);
+
+/**
+ * Finalizes the library with the current error condition. Parameters shared
+ * with other contexts are released by the last context using them.
  *
  * @return RLC_OK if no error has occurred, RLC_ERR otherwise.
  */
@@ -540,6 +648,22 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Executes a function on multiple workers when multithreading is enabled.
+ * Worker threads run on private copies of the caller's library context, so
+ * that curve parameters are available and error state is kept separate, while
+ * precomputed tables are shared with the caller. If multithreading is disabled,
+ * the function is called once by the caller.
+ *
+ * @param[in] func					- the function to execute, receiving the
+ * 									argument, the worker index and the number
+ * 									of workers.
+ * @param[in] arg					- the argument to pass to the function.
+ * @param[in] cores					- the maximum number of workers.
+ */
+void core_run(void (*func)(void *arg, int id, int cores), void *arg,
+		int cores);
+
 #if defined(MULTI)
 
 #include "relic_multi.h"
@@ -44,6 +44,16 @@
 #include "relic_pc.h"
 #include "relic_mpc.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Minimum number of set elements processed by each thread in the private set
+ * intersection protocols.
+ */
+#define RLC_CP_PSI_PAR		16
+
 /*============================================================================*/
 /* Type definitions.                                                          */
 /*============================================================================*/
@@ -261,6 +271,50 @@ typedef etrs_st etrs_t[1];
 typedef etrs_st *etrs_t;
 #endif
 
+/**
+ * Represents an elliptic curve public key with a precomputation table for
+ * fixed-base multiplication.
+ */
+typedef struct _ec_pubkey_st {
+	/** The public key. */
+	ec_t q;
+	/** The precomputation table for the public key. */
+	ec_t t[RLC_EC_TABLE];
+} ec_pubkey_st;
+
+/**
+ * Pointer to a precomputed elliptic curve public key.
+ */
+#if ALLOC == AUTO
+typedef ec_pubkey_st ec_pubkey_t[1];
+#else
+typedef ec_pubkey_st *ec_pubkey_t;
+#endif
+
+/**
+ * Represents a set-associative cache of precomputed public keys, indexed by
+ * their serialization.
+ */
+typedef struct _ec_cache_st {
+	/** The precomputed public keys. */
+	ec_pubkey_st *k;
+	/** The serialized public keys, in slots of 2 * RLC_FC_BYTES + 1 bytes. */
+	uint8_t *b;
+	/** The lengths of the serialized public keys, zero for empty entries. */
+	size_t *l;
+	/** The time of the last use of each entry. */
+	size_t *u;
+	/** The number of entries. */
+	size_t n;
+	/** The current time. */
+	size_t c;
+} ec_cache_st;
+
+/**
+ * Pointer to a cache of precomputed public keys.
+ */
+typedef ec_cache_st ec_cache_t[1];
+
 
 /*============================================================================*/
 /* Macro definitions                                                          */
@@ -278,7 +332,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define shpe_new(A)															\
 	A = (shpe_t)calloc(1, sizeof(shpe_st));									\
 	if (A == NULL) {														\
@@ -305,7 +359,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define shpe_free(A)														\
 	if (A != NULL) {														\
 		bn_free((A)->a);													\
@@ -334,7 +388,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define rsa_new(A)															\
 	A = (rsa_t)calloc(1, sizeof(_rsa_st));									\
 	if (A == NULL) {														\
@@ -359,7 +413,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define rsa_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->d);													\
@@ -428,7 +482,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bdpe_new(A)															\
 	A = (bdpe_t)calloc(1, sizeof(bdpe_st));									\
 	if (A == NULL) {														\
@@ -455,7 +509,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bdpe_free(A)														\
 	if (A != NULL) {														\
 		bn_free((A)->n);													\
@@ -483,7 +537,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define sokaka_new(A)														\
 	A = (sokaka_t)calloc(1, sizeof(sokaka_st));								\
 	if (A == NULL) {														\
@@ -501,7 +555,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define sokaka_free(A)														\
 	if (A != NULL) {														\
 		g1_free((A)->s1);													\
@@ -514,6 +568,53 @@ typedef etrs_st *etrs_t;
 #define sokaka_free(A)			/* empty */
 #endif
 
+/**
+ * Initializes a precomputed public key with a null value.
+ *
+ * @param[out] A			- the key to initialize.
+ */
+#define ec_pubkey_null(A)		RLC_NULL(A)
+
+/**
+ * Calls a function to allocate and initialize a precomputed public key.
+ *
+ * @param[out] A			- the new key.
+ */
+#if ALLOC != AUTO
+#define ec_pubkey_new(A)													\
+	A = (ec_pubkey_t)calloc(1, sizeof(ec_pubkey_st));						\
+	if (A == NULL) {														\
+		RLC_THROW(ERR_NO_MEMORY);											\
+	}																		\
+	ec_new((A)->q);															\
+	for (int _i = 0; _i < RLC_EC_TABLE; _i++) {								\
+		ec_new((A)->t[_i]);													\
+	}																		\
+
+#elif ALLOC == AUTO
+#define ec_pubkey_new(A)		/* empty */
+#endif
+
+/**
+ * Calls a function to clean and free a precomputed public key.
+ *
+ * @param[out] A			- the key to clean and free.
+ */
+#if ALLOC != AUTO
+#define ec_pubkey_free(A)													\
+	if (A != NULL) {														\
+		ec_free((A)->q);													\
+		for (int _i = 0; _i < RLC_EC_TABLE; _i++) {							\
+			ec_free((A)->t[_i]);											\
+		}																	\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define ec_pubkey_free(A)		/* empty */
+#endif
+
 /**
  * Initializes a BGN key pair with a null value.
  *
@@ -526,7 +627,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new key pair.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bgn_new(A)															\
 	A = (bgn_t)calloc(1, sizeof(bgn_st));									\
 	if (A == NULL) {														\
@@ -551,7 +652,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the key pair to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define bgn_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->x);													\
@@ -583,7 +684,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new signature ring.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ers_new(A)															\
 	A = (ers_t)calloc(1, sizeof(ers_st));									\
 	if (A == NULL) {														\
@@ -605,7 +706,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the signature ring to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ers_free(A)															\
 	if (A != NULL) {														\
 		ec_free((A)->h);													\
@@ -634,7 +735,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new signature ring.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define smlers_new(A)														\
 	A = (smlers_t)calloc(1, sizeof(ers_st));								\
 	if (A == NULL) {														\
@@ -656,7 +757,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the signature ring to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define smlers_free(A)														\
 	if (A != NULL) {														\
 		ers_free((A)->sig);													\
@@ -685,7 +786,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the new signature ring.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define etrs_new(A)															\
 	A = (etrs_t)calloc(1, sizeof(etrs_st));									\
 	if (A == NULL) {														\
@@ -709,7 +810,7 @@ typedef etrs_st *etrs_t;
  *
  * @param[out] A			- the signature ring to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define etrs_free(A)														\
 	if (A != NULL) {														\
 		bn_free((A)->y);													\
@@ -1138,6 +1239,74 @@ int cp_ecss_sig(bn_t e, bn_t s, const uint8_t *msg, size_t len, const bn_t d);
  */
 int cp_ecss_ver(bn_t e, bn_t s, const uint8_t *msg, size_t len, const ec_t q);
 
+/**
+ * Precomputes a table for fixed-base multiplication by a public key, so that
+ * signatures under long-lived keys can be verified faster.
+ *
+ * @param[out] p			- the precomputed public key.
+ * @param[in] q				- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR if the key is invalid.
+ */
+int cp_ecpk_pre(ec_pubkey_t p, const ec_t q);
+
+/**
+ * Initializes a cache of precomputed public keys using at most a given amount
+ * of memory.
+ *
+ * @param[out] c			- the cache.
+ * @param[in] size			- the memory budget in bytes.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_ecpk_init(ec_cache_t c, size_t size);
+
+/**
+ * Frees a cache of precomputed public keys.
+ *
+ * @param[out] c			- the cache.
+ */
+void cp_ecpk_clean(ec_cache_t c);
+
+/**
+ * Returns the precomputed public key with a given serialization from a cache,
+ * deserializing and precomputing it on a miss. The least recently used key
+ * in the same set is evicted when needed. The returned key is valid until the
+ * next call with the same cache.
+ *
+ * @param[in,out] c			- the cache.
+ * @param[in] bin			- the serialized public key.
+ * @param[in] len			- the number of bytes.
+ * @return the precomputed public key, or NULL if the key is invalid.
+ */
+ec_pubkey_st *cp_ecpk_get(ec_cache_t c, const uint8_t *bin, size_t len);
+
+/**
+ * Verifies a message signed with ECDSA under a precomputed public key.
+ *
+ * @param[out] r			- the first component of the signature.
+ * @param[out] s			- the second component of the signature.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] p				- the precomputed public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_ecdsa_ver_pre(const bn_t r, const bn_t s, const uint8_t *msg,
+		size_t len, int hash, const ec_pubkey_t p);
+
+/**
+ * Verifies a message signed with the Elliptic Curve Schnorr Signature under
+ * a precomputed public key.
+ *
+ * @param[out] e			- the first component of the signature.
+ * @param[out] s			- the second component of the signature.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] p				- the precomputed public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_ecss_ver_pre(bn_t e, bn_t s, const uint8_t *msg, size_t len,
+		const ec_pubkey_t p);
+
 /**
  * Generates parameters for the DCKKS pairing delegation protocol described at
  * "Secure and Efficient Delegationof Pairings with Online Inputs" (CARDIS 2020)
@@ -1793,6 +1962,23 @@ int cp_bls_agg_sig(g1_t sig, g2_t a, const g1_t s, const g2_t q);
 int cp_bls_agg_ver(const g1_t s, const uint8_t **m, const size_t *l,
 		size_t size, const g2_t q[]);
 
+/**
+ * Verifies a batch of independent BLS signatures using a random linear
+ * combination, with a single multi-pairing sharing the final exponentiation.
+ * If the batch fails and flags are requested, the batch is bisected to
+ * identify the invalid signatures.
+ *
+ * @param[out] b			- the validity flags of each signature, or NULL.
+ * @param[in] s				- the signatures.
+ * @param[in] m				- the signed messages.
+ * @param[in] l				- the message lengths.
+ * @param[in] size			- the number of signatures.
+ * @param[in] q				- the public keys.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_bls_batch_ver(int *b, const g1_t s[], const uint8_t **m,
+		const size_t *l, size_t size, const g2_t q[]);
+
 /**
  * Generates a key pair for the Boneh-Boyen (BB) signature protocol.
  *
@@ -2561,6 +2747,200 @@ int cp_etrs_uni(int thres, bn_t *td, bn_t *y, int max, etrs_t *p, size_t *size,
  */
 int cp_ped_com(ec_t c, ec_t h, bn_t r, bn_t x);
 
+/**
+ * Generates the public parameters of an inner product argument by hashing to
+ * the curve, so that no discrete logarithm relation among them is known.
+ *
+ * @param[out] g			- the generators for the first vector.
+ * @param[out] h			- the generators for the second vector.
+ * @param[out] u			- the generator for the inner product.
+ * @param[in] n				- the length of the vectors.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_ipa_gen(ec_t *g, ec_t *h, ec_t u, size_t n);
+
+/**
+ * Proves knowledge of vectors a and b opening the commitment
+ * p = <a, g> + <b, h> + <a, b> * u with a Bulletproofs inner product argument.
+ * The proof consists of log2(n) pairs of points and two integers. The
+ * challenges are derived from the commitment, the vector length and all the
+ * generators, so a proof only verifies under the key it was made for.
+ *
+ * @param[out] l			- the left cross terms, one per round.
+ * @param[out] r			- the right cross terms, one per round.
+ * @param[out] x			- the folded first vector.
+ * @param[out] y			- the folded second vector.
+ * @param[in] p				- the commitment to the vectors.
+ * @param[in] g				- the generators for the first vector.
+ * @param[in] h				- the generators for the second vector.
+ * @param[in] u				- the generator for the inner product.
+ * @param[in] a				- the first vector.
+ * @param[in] b				- the second vector.
+ * @param[in] n				- the length of the vectors, a power of 2.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_ipa_prv(ec_t *l, ec_t *r, bn_t x, bn_t y, const ec_t p, const ec_t *g,
+		const ec_t *h, const ec_t u, const bn_t *a, const bn_t *b, size_t n);
+
+/**
+ * Verifies a Bulletproofs inner product argument with a single
+ * multi-scalar multiplication of size 2n + 2log2(n) + 2.
+ *
+ * @param[in] p				- the commitment to the vectors.
+ * @param[in] l				- the left cross terms, one per round.
+ * @param[in] r				- the right cross terms, one per round.
+ * @param[in] x				- the folded first vector.
+ * @param[in] y				- the folded second vector.
+ * @param[in] g				- the generators for the first vector.
+ * @param[in] h				- the generators for the second vector.
+ * @param[in] u				- the generator for the inner product.
+ * @param[in] n				- the length of the vectors, a power of 2.
+ * @return a boolean value indicating the verification result.
+ */
+int cp_ipa_ver(const ec_t p, const ec_t *l, const ec_t *r, const bn_t x,
+		const bn_t y, const ec_t *g, const ec_t *h, const ec_t u, size_t n);
+
+/**
+ * Generates a structured reference string for the KZG polynomial commitment
+ * scheme, consisting of the powers of a random secret in both groups. The
+ * secret is discarded afterwards.
+ *
+ * @param[out] s			- the powers of the secret in G_1.
+ * @param[in] n				- the number of powers in G_1.
+ * @param[out] t			- the powers of the secret in G_2.
+ * @param[in] m				- the number of powers in G_2, at least 2.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_kzg_gen(g1_t *s, size_t n, g2_t *t, size_t m);
+
+/**
+ * Returns the number of bytes needed to store a structured reference string
+ * for the KZG polynomial commitment scheme.
+ *
+ * @param[in] n				- the number of powers in G_1.
+ * @param[in] m				- the number of powers in G_2.
+ * @return the number of bytes.
+ */
+size_t cp_kzg_size(size_t n, size_t m);
+
+/**
+ * Writes a structured reference string for the KZG polynomial commitment
+ * scheme as a sequence of compressed group elements.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] s				- the powers of the secret in G_1.
+ * @param[in] n				- the number of powers in G_1.
+ * @param[in] t				- the powers of the secret in G_2.
+ * @param[in] m				- the number of powers in G_2.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_kzg_write(uint8_t *bin, size_t len, const g1_t *s, size_t n,
+		const g2_t *t, size_t m);
+
+/**
+ * Reads a structured reference string for the KZG polynomial commitment
+ * scheme, checking that all group elements are in the prime-order subgroups.
+ *
+ * @param[out] s			- the powers of the secret in G_1.
+ * @param[in] n				- the number of powers in G_1.
+ * @param[out] t			- the powers of the secret in G_2.
+ * @param[in] m				- the number of powers in G_2.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_kzg_read(g1_t *s, size_t n, g2_t *t, size_t m, const uint8_t *bin,
+		size_t len);
+
+/**
+ * Commits to a polynomial with the KZG polynomial commitment scheme.
+ *
+ * @param[out] c			- the commitment.
+ * @param[in] a				- the coefficients of the polynomial.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] s				- the powers of the secret in G_1.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_kzg_com(g1_t c, const bn_t *a, size_t n, const g1_t *s);
+
+/**
+ * Opens a committed polynomial at a point with the KZG polynomial commitment
+ * scheme.
+ *
+ * @param[out] pi			- the proof.
+ * @param[out] y			- the evaluation of the polynomial at the point.
+ * @param[in] a				- the coefficients of the polynomial.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] z				- the point.
+ * @param[in] s				- the powers of the secret in G_1.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_kzg_prv(g1_t pi, bn_t y, const bn_t *a, size_t n, const bn_t z,
+		const g1_t *s);
+
+/**
+ * Verifies the opening of a committed polynomial at a point with the KZG
+ * polynomial commitment scheme.
+ *
+ * @param[in] c				- the commitment.
+ * @param[in] z				- the point.
+ * @param[in] y				- the claimed evaluation.
+ * @param[in] pi			- the proof.
+ * @param[in] t				- the first two powers of the secret in G_2.
+ * @return a boolean value indicating the verification result.
+ */
+int cp_kzg_ver(const g1_t c, const bn_t z, const bn_t y, const g1_t pi,
+		const g2_t *t);
+
+/**
+ * Opens a committed polynomial at k points with a single proof with the KZG
+ * polynomial commitment scheme.
+ *
+ * @param[out] pi			- the proof.
+ * @param[out] y			- the evaluations of the polynomial at the points.
+ * @param[in] a				- the coefficients of the polynomial.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] z				- the distinct points.
+ * @param[in] k				- the number of points.
+ * @param[in] s				- the powers of the secret in G_1.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_kzg_prv_sim(g1_t pi, bn_t *y, const bn_t *a, size_t n, const bn_t *z,
+		size_t k, const g1_t *s);
+
+/**
+ * Verifies the opening of a committed polynomial at k points with the KZG
+ * polynomial commitment scheme.
+ *
+ * @param[in] c				- the commitment.
+ * @param[in] z				- the distinct points.
+ * @param[in] y				- the claimed evaluations.
+ * @param[in] k				- the number of points.
+ * @param[in] pi			- the proof.
+ * @param[in] s				- the first k powers of the secret in G_1.
+ * @param[in] t				- the first k + 1 powers of the secret in G_2.
+ * @return a boolean value indicating the verification result.
+ */
+int cp_kzg_ver_sim(const g1_t c, const bn_t *z, const bn_t *y, size_t k,
+		const g1_t pi, const g1_t *s, const g2_t *t);
+
+/**
+ * Verifies l openings of committed polynomials at one point each with the KZG
+ * polynomial commitment scheme, using a random linear combination so that
+ * only two pairings and one final exponentiation are computed.
+ *
+ * @param[in] c				- the commitments.
+ * @param[in] z				- the points.
+ * @param[in] y				- the claimed evaluations.
+ * @param[in] pi			- the proofs.
+ * @param[in] l				- the number of openings.
+ * @param[in] t				- the first two powers of the secret in G_2.
+ * @return a boolean value indicating the verification result.
+ */
+int cp_kzg_ver_lot(const g1_t *c, const bn_t *z, const bn_t *y,
+		const g1_t *pi, size_t l, const g2_t *t);
+
 /**
  * Compute the client-side part of an OPRF evaluation.
  *
@@ -2861,7 +3241,11 @@ int cp_rsapsi_ask(bn_t d, bn_t r, bn_t *p, const bn_t g, const bn_t n,
 		const bn_t *x, size_t m);
 
 /**
- * Computes the sender part of the RSA-PSI protocol, given its input set.
+ * Computes the sender part of the RSA-PSI protocol, given its input set. The
+ * elements are processed in parallel when multithreading is enabled, and each
+ * answer is independent, so a large set can be answered in consecutive slices
+ * that are streamed to the receiver, at the cost of shuffling within each
+ * slice only.
  *
  * @param[out] t			- the accumulator results.
  * @param[out] u			- the missing elements in the exponent.
@@ -2917,7 +3301,8 @@ int cp_shipsi_ask(bn_t d, bn_t r, bn_t *p, const bn_t g, const bn_t n,
 		const bn_t *x, size_t m);
 
 /**
- * Computes the sender part of the SHI-PSI protocol, given its input set.
+ * Computes the sender part of the SHI-PSI protocol, given its input set. The
+ * elements are processed in parallel when multithreading is enabled.
  *
  * @param[out] t			- the accumulator results.
  * @param[out] u			- the hint in the exponent.
@@ -2971,7 +3356,8 @@ int cp_pbpsi_gen(bn_t sk, g1_t ss, g2_t *s, size_t m);
 int cp_pbpsi_ask(g2_t *d, bn_t r, const bn_t *x, const g2_t *s, size_t m);
 
 /**
- * Computes the sender part of the PB-PSI protocol, given its input set.
+ * Computes the sender part of the PB-PSI protocol, given its input set. The
+ * elements are processed in parallel when multithreading is enabled.
  *
  * @param[out] t			- the pairing results.
  * @param[out] u			- the missing elements in the exponent.
@@ -2983,6 +3369,27 @@ int cp_pbpsi_ask(g2_t *d, bn_t r, const bn_t *x, const g2_t *s, size_t m);
 int cp_pbpsi_ans(gt_t *t, g1_t *u, const g1_t ss, const g2_t d,
 		const bn_t *y, size_t n);
 
+/**
+ * Computes the sender part of the PB-PSI protocol in blocks of l elements,
+ * passing each block of the answer to a function as soon as it is computed.
+ * Only one block is kept in memory, and the answer is shuffled as a whole, so
+ * the concatenation of the blocks is distributed as the output of
+ * cp_pbpsi_ans().
+ *
+ * @param[in] ss			- the secret power.
+ * @param[in] d				- the polynomial interpolations in the exponent.
+ * @param[in] y				- the server's input set.
+ * @param[in] n				- the sender's input set size.
+ * @param[in] l				- the number of elements in each block.
+ * @param[in] f				- the function receiving the pairing results and
+ * 							  the missing elements of each block.
+ * @param[in] arg			- the argument passed to the function.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_pbpsi_ans_str(const g1_t ss, const g2_t d, const bn_t *y, size_t n,
+		size_t l, void (*f)(const gt_t *t, const g1_t *u, size_t len,
+		void *arg), void *arg);
+
 /**
  * Computes the intersection as the final part of the PB-PSI protocol.
  *
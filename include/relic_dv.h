@@ -114,7 +114,7 @@ typedef dig_t *dv_t;
  *
  * @param[out] A			- the double-precision result.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define dv_new(A)			dv_new_dynam(&(A), RLC_DV_DIGS)
 #elif ALLOC == AUTO
 #define dv_new(A)			/* empty */
@@ -125,7 +125,7 @@ typedef dig_t *dv_t;
  *
  * @param[out] A			- the temporary digit vector to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define dv_free(A)			dv_free_dynam(&(A))
 #elif ALLOC == AUTO
 #define dv_free(A)			(void)A
@@ -229,7 +229,7 @@ int dv_equ_sec(const dig_t *a, const dig_t *b, size_t size);
  * @throw ERR_PRECISION		- if the required precision cannot be represented
  * 							by the library.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 void dv_new_dynam(dv_t *a, size_t digits);
 #endif
 
@@ -238,7 +238,7 @@ void dv_new_dynam(dv_t *a, size_t digits);
  *
  * @param[out] a			- the temporary digit vector to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 void dv_free_dynam(dv_t *a);
 #endif
 
@@ -172,9 +172,9 @@ typedef eb_st *eb_t;
  * @param[out] A			- the new point.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define eb_new(A)															\
-	A = (eb_t)calloc(1, sizeof(eb_st));										\
+	A = (eb_t)RLC_NEW(eb_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -189,10 +189,10 @@ typedef eb_st *eb_t;
  *
  * @param[out] A			- the point to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define eb_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}																		\
 
@@ -244,6 +244,11 @@ enum {
 #define RLC_EP_TABLE			RLC_EP_TABLE_LWNAF
 #endif
 
+/**
+ * Maximum window width of a serialized precomputation table.
+ */
+#define RLC_EP_BIN_MAX			16
+
 /**
  * Maximum size of a precomputation table.
  */
@@ -259,6 +264,24 @@ enum {
  */
 #define RLC_EP_CTMAP_MAX		16
 
+/**
+ * Minimum number of points for which multiplying many points simultaneously
+ * uses Pippenger's bucket method.
+ */
+#define RLC_EP_PIP_MIN			64
+
+/**
+ * Minimum number of points for which Pippenger's bucket method distributes
+ * the windows among multiple threads.
+ */
+#define RLC_EP_PIP_PAR			1024
+
+/**
+ * Minimum number of points decoded by each thread when reading a batch of
+ * points.
+ */
+#define RLC_EP_BATCH_PAR		64
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -342,9 +365,9 @@ typedef iso_st *iso_t;
  * @param[out] A			- the new point.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep_new(A)															\
-	A = (ep_t)calloc(1, sizeof(ep_st));										\
+	A = (ep_t)RLC_NEW(ep_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -359,10 +382,10 @@ typedef iso_st *iso_t;
  *
  * @param[out] A			- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep_free(A)															\
 	if (A != NULL) {														\
-		free(A);															\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}
 
@@ -872,6 +895,23 @@ size_t ep_size_bin(const ep_t a, int pack);
  */
 void ep_read_bin(ep_t a, const uint8_t *bin, size_t len);
 
+/**
+ * Reads a vector of prime elliptic curve points from consecutive encodings of
+ * the same length, without throwing errors for invalid encodings. Compressed
+ * points are decompressed together and large batches are split among threads.
+ * Invalid points are set to the point at infinity and flagged. Membership in
+ * the prime-order subgroup is not checked.
+ *
+ * @param[out] a			- the results.
+ * @param[out] v			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector with all the encodings.
+ * @param[in] len			- the length of each encoding.
+ * @param[in] n				- the number of points.
+ * @throw ERR_NO_BUFFER		- if the length of the encodings is invalid.
+ */
+void ep_read_bin_batch(ep_t *a, int *v, const uint8_t *bin, size_t len,
+		int n);
+
 /**
  * Writes a prime elliptic curve point to a byte vector in big-endian format
  * with optional point compression.
@@ -1196,6 +1236,44 @@ void ep_mul_fix_combd(ep_t r, const ep_t *t, const bn_t k);
  */
 void ep_mul_fix_lwnaf(ep_t r, const ep_t *t, const bn_t k);
 
+/**
+ * Returns the number of bytes of a serialized precomputation table for
+ * fixed-base multiplication with window width w in the current curve.
+ *
+ * @param[in] w				- the window width, between 2 and RLC_EP_BIN_MAX.
+ * @return the number of bytes, or zero if the width is invalid.
+ */
+size_t ep_mul_size_bin(int w);
+
+/**
+ * Builds a serialized precomputation table for fixed-base multiplication
+ * using the single-table comb method with window width w. The table stores a
+ * short header followed by the affine coordinates of the 2^w - 1 nonzero
+ * comb points in the internal field representation, so it can be generated
+ * offline, mapped read-only into memory and shared between processes. It is
+ * only valid for the same curve, digit size and field arithmetic backend.
+ *
+ * @param[out] bin			- the serialized table.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] p				- the point to multiply.
+ * @param[in] w				- the window width, between 2 and RLC_EP_BIN_MAX.
+ * @throw ERR_NO_VALID		- if the width or the point is invalid.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ */
+void ep_mul_pre_bin(uint8_t *bin, size_t len, const ep_t p, int w);
+
+/**
+ * Multiplies a fixed prime elliptic point using a serialized precomputation
+ * table, which is read in place.
+ *
+ * @param[out] r			- the result.
+ * @param[in] bin			- the serialized table.
+ * @param[in] len			- the number of bytes in the table.
+ * @param[in] k				- the integer.
+ * @throw ERR_NO_VALID		- if the table was not built for the current curve.
+ */
+void ep_mul_fix_bin(ep_t r, const uint8_t *bin, size_t len, const bn_t k);
+
 /**
  * Multiplies and adds two prime elliptic curve points simultaneously using
  * scalar multiplication and point addition.
@@ -1259,6 +1337,19 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
  */
 void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies and adds multiple elliptic curve points simultaneously using
+ * Pippenger's bucket method with batched affine additions. The windows are
+ * distributed among threads if multithreading is enabled.
+ * Computes R = \Sum_i=0..n [k_i]P_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep_mul_sim_pip(ep_t r, const ep_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [m]Q.
@@ -1298,6 +1389,39 @@ void ep_norm(ep_t r, const ep_t p);
  */
 void ep_norm_sim(ep_t *r, const ep_t *t, int n);
 
+/**
+ * Converts multiple points to affine coordinates, sharing a single inversion
+ * and processing the coordinates in blocks of eight.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to convert.
+ * @param[in] n				- the number of points.
+ */
+void ep_norm_batch(ep_t *r, const ep_t *p, int n);
+
+/**
+ * Adds multiple pairs of independent points. Computes R_i = P_i + Q_i for
+ * 0 <= i < n, processing the points in blocks of eight so that the field
+ * multiplications can be vectorized.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the first points to add.
+ * @param[in] q				- the second points to add.
+ * @param[in] n				- the number of points.
+ */
+void ep_add_batch(ep_t *r, const ep_t *p, const ep_t *q, int n);
+
+/**
+ * Doubles multiple independent points. Computes R_i = 2P_i for 0 <= i < n,
+ * processing the points in blocks of eight so that the field multiplications
+ * can be vectorized.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to double.
+ * @param[in] n				- the number of points.
+ */
+void ep_dbl_batch(ep_t *r, const ep_t *p, int n);
+
 /**
  * Maps a byte array to a point in a prime elliptic curve using the hash and
  * increment approach.
@@ -1343,6 +1467,18 @@ size_t ep_map_rnd_size(void);
  */
 void ep_map_rnd(ep_t p, const uint8_t *uniform_bytes, size_t len);
 
+/**
+ * Hashes multiple byte arrays to points in a prime elliptic curve, sharing
+ * the message expansion among them. Computes P_i = H(msg_i) with the same
+ * method as ep_map().
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ */
+void ep_map_batch(ep_t *p, const uint8_t *msg[], const size_t len[], int n);
+
 /**
  * Compresses a point.
  *
@@ -1360,4 +1496,15 @@ void ep_pck(ep_t r, const ep_t p);
  */
 int ep_upk(ep_t r, const ep_t p);
 
+/**
+ * Decompresses a vector of points, sharing the work of the square roots.
+ *
+ * @param[out] r			- the results.
+ * @param[out] v			- the flags indicating which decompressions
+ * 							  were successful.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ */
+void ep_upk_batch(ep_t *r, int *v, const ep_t *p, int n);
+
 #endif /* !RLC_EP_H */
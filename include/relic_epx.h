@@ -245,9 +245,9 @@ typedef iso2_st *iso2_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep2_new(A)															\
-	A = (ep2_t)calloc(1, sizeof(ep2_st));									\
+	A = (ep2_t)RLC_NEW(ep2_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -268,13 +268,13 @@ typedef iso2_st *iso2_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep2_free(A)															\
 	if (A != NULL) {														\
 		fp2_free((A)->x);													\
 		fp2_free((A)->y);													\
 		fp2_free((A)->z);													\
-		free(A);															\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}																		\
 
@@ -295,9 +295,9 @@ typedef iso2_st *iso2_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep3_new(A)															\
-	A = (ep3_t)calloc(1, sizeof(ep3_st));									\
+	A = (ep3_t)RLC_NEW(ep3_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -318,13 +318,13 @@ typedef iso2_st *iso2_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep3_free(A)															\
 	if (A != NULL) {														\
 		fp3_free((A)->x);													\
 		fp3_free((A)->y);													\
 		fp3_free((A)->z);													\
-		free(A);															\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}																		\
 
@@ -345,9 +345,9 @@ typedef iso2_st *iso2_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep4_new(A)															\
-	A = (ep4_t)calloc(1, sizeof(ep4_st));									\
+	A = (ep4_t)RLC_NEW(ep4_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -368,13 +368,13 @@ typedef iso2_st *iso2_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep4_free(A)															\
 	if (A != NULL) {														\
 		fp4_free((A)->x);													\
 		fp4_free((A)->y);													\
 		fp4_free((A)->z);													\
-		free(A);															\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}																		\
 
@@ -395,9 +395,9 @@ typedef iso2_st *iso2_t;
  * @param[out] A				- the new point.
  * @throw ERR_NO_MEMORY			- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep8_new(A)															\
-	A = (ep8_t)calloc(1, sizeof(ep8_st));									\
+	A = (ep8_t)RLC_NEW(ep8_st);												\
 	if (A == NULL) {														\
 		RLC_THROW(ERR_NO_MEMORY);											\
 	}																		\
@@ -418,13 +418,13 @@ typedef iso2_st *iso2_t;
  *
  * @param[out] A				- the point to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define ep8_free(A)															\
 	if (A != NULL) {														\
 		fp8_free((A)->x);													\
 		fp8_free((A)->y);													\
 		fp8_free((A)->z);													\
-		free(A);															\
+		RLC_DEL(A);															\
 		A = NULL;															\
 	}																		\
 
@@ -1145,6 +1145,22 @@ size_t ep2_size_bin(const ep2_t a, int pack);
  */
 void ep2_read_bin(ep2_t a, const uint8_t *bin, size_t len);
 
+/**
+ * Reads a vector of points in an elliptic curve over a quadratic extension
+ * from consecutive encodings of the same length, without throwing errors for
+ * invalid encodings. Invalid points are set to the point at infinity and
+ * flagged. Membership in the prime-order subgroup is not checked.
+ *
+ * @param[out] a			- the results.
+ * @param[out] v			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector with all the encodings.
+ * @param[in] len			- the length of each encoding.
+ * @param[in] n				- the number of points.
+ * @throw ERR_NO_BUFFER		- if the length of the encodings is invalid.
+ */
+void ep2_read_bin_batch(ep2_t *a, int *v, const uint8_t *bin, size_t len,
+		int n);
+
 /**
  * Writes a prime elliptic curve pointer over a quadratic extension to a byte
  * vector in big-endian format with optional point compression.
@@ -1329,6 +1345,17 @@ void ep2_mul_dig(ep2_t r, const ep2_t p, const dig_t k);
  */
 void ep2_mul_cof(ep2_t r, const ep2_t p);
 
+/**
+ * Multiplies multiple points in an elliptic curve over a quadratic extension
+ * field by the curve cofactor, sharing the inversions needed to normalize the
+ * intermediate values and the results. Computes R_i = ep2_mul_cof(P_i).
+ *
+ * @param[out] r				- the results.
+ * @param[in] p					- the points to multiply.
+ * @param[in] n					- the number of points.
+ */
+void ep2_mul_cof_sim(ep2_t *r, const ep2_t *p, int n);
+
 /**
  * Builds a precomputation table for multiplying a fixed prime elliptic point
  * using the binary method.
@@ -1504,6 +1531,19 @@ void ep2_mul_sim_joint(ep2_t r, const ep2_t p, const bn_t k, const ep2_t q,
  */
 void ep2_mul_sim_lot(ep2_t r, const ep2_t p[], const bn_t k[], size_t n);
 
+/**
+ * Multiplies and adds multiple elliptic curve points simultaneously using
+ * Pippenger's bucket method with batched affine additions. The windows are
+ * distributed among threads if multithreading is enabled.
+ * Computes R = \Sum_i=0..n [k_i]P_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep2_mul_sim_pip(ep2_t r, const ep2_t p[], const bn_t k[], size_t n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [l]Q.
@@ -1572,6 +1612,18 @@ void ep2_map_sswum(ep2_t p, const uint8_t *msg, size_t len);
  */
 void ep2_map_swift(ep2_t p, const uint8_t *msg, size_t len);
 
+/**
+ * Hashes multiple byte arrays to points in an elliptic curve over a quadratic
+ * extension, sharing the message expansion, the field inversions and the
+ * cofactor clearing among them. Computes P_i = ep2_map(msg_i).
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ */
+void ep2_map_batch(ep2_t *p, const uint8_t *msg[], const size_t len[], int n);
+
 /**
  * Computes a power of the Gailbraith-Lin-Scott homomorphism of a point
  * represented in affine coordinates on a twisted elliptic curve over a
@@ -1603,6 +1655,18 @@ void ep2_pck(ep2_t r, const ep2_t p);
  */
 int ep2_upk(ep2_t r, const ep2_t p);
 
+/**
+ * Decompresses a vector of points in an elliptic curve over a quadratic
+ * extension, sharing the work of the square roots.
+ *
+ * @param[out] r			- the results.
+ * @param[out] v			- the flags indicating which decompressions
+ * 							  were successful.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ */
+void ep2_upk_batch(ep2_t *r, int *v, const ep2_t *p, int n);
+
 /**
  * Initializes the elliptic curve over cubic extension.
  */
@@ -42,7 +42,7 @@
 #include "relic_util.h"
 #include "relic_label.h"
 
-#ifdef CHECK
+#if defined(CHECK) && !defined(NOJMP)
 #include <setjmp.h>
 #endif
 
@@ -107,8 +107,13 @@ typedef int err_t;
 typedef struct _sts_t {
 	/** Error occurred. */
 	err_t *error;
+#ifdef NOJMP
+	/** Flag to tell if an error was thrown inside the try-catch block. */
+	int flag;
+#else
 	/** Pointer to the program location where the error occurred. */
 	jmp_buf addr;
+#endif
 	/** Flag to tell if there is a surrounding try-catch block. */
 	int block;
 } sts_t;
@@ -119,6 +124,86 @@ typedef struct _sts_t {
 /* Macro definitions                                                          */
 /*============================================================================*/
 
+#ifdef NOJMP
+
+/**
+ * Implements the TRY clause of the error-handling routines without setjmp().
+ *
+ * The program block is always executed until its end. Errors thrown inside
+ * it are recorded in a sticky flag of the current error state instead of
+ * unwinding the stack, so entering a block costs only a few stores.
+ */
+#define RLC_ERR_TRY														\
+	{																	\
+		sts_t *_last, _this;											\
+		ctx_t *_ctx = core_get();										\
+		_last = _ctx->last; 											\
+		_this.block = 1;												\
+		_this.flag = 0;													\
+		_ctx->last = &_this; 											\
+		for (int _z = 0; ; _z = 1) 										\
+			if (_z) { 													\
+				{ 														\
+					if (1)												\
+
+/**
+ * Implements the CATCH clause of the error-handling routines without
+ * setjmp().
+ *
+ * After the program block finishes, the caught flag is copied from the sticky
+ * flag and the last error is restored. If some error was caught, the execution
+ * resumes inside the RLC_CATCH block.
+ *
+ * @param[in] ADDR	- the address of the exception being caught
+ */
+#define RLC_ERR_CATCH(ADDR)												\
+					else { } 											\
+				}														\
+				_ctx->caught = _this.flag;								\
+				_ctx->last = _last;										\
+				break; 													\
+			} else {													\
+				_this.error = ADDR; 									\
+			}															\
+	} 																	\
+	for (int _z = 0; _z < 2; _z++) 										\
+		if (_z == 1 && core_get()->caught) 								\
+
+/**
+ * Implements the THROW clause of the error-handling routines without
+ * longjmp().
+ *
+ * Outside of a TRY-CATCH block, the error is stored in the library context and
+ * an error message is printed. Inside a block, only the first error is printed
+ * and stored, and the sticky flag is raised so the CATCH clause is executed
+ * when the block ends. The caller keeps running after the throw, as it happens
+ * when error-checking support is turned off.
+ *
+ * @param[in] E		- the exception being caught.
+ */
+#define RLC_ERR_THROW(E)												\
+	{																	\
+		ctx_t *_ctx = core_get();										\
+		_ctx->code = RLC_ERR;											\
+		if (_ctx->last == NULL) {										\
+			_ctx->last = &(_ctx->error);								\
+			_ctx->error.error = &(_ctx->number);						\
+			_ctx->error.block = 0;										\
+			_ctx->number = E;											\
+			RLC_ERR_PRINT(E);											\
+		} else if (_ctx->last->block == 1 && _ctx->last->flag == 0) {	\
+			_ctx->last->flag = 1;										\
+			RLC_ERR_PRINT(E);											\
+			if (_ctx->last->error) {									\
+				if (E != ERR_CAUGHT) {									\
+					*(_ctx->last->error) = E;							\
+				}														\
+			}															\
+		}																\
+	}																	\
+
+#else
+
 /**
  * Implements the TRY clause of the error-handling routines.
  *
@@ -208,6 +293,8 @@ typedef struct _sts_t {
 		}																\
 	}																	\
 
+#endif /* NOJMP */
+
 #ifdef CHECK
 /**
  * Implements a TRY clause.
@@ -275,6 +362,23 @@ typedef struct _sts_t {
 #endif
 #endif
 
+#if defined(CHECK) && defined(NOJMP)
+/**
+ * Tests if an error was thrown so far inside the innermost TRY block. Callers
+ * that keep using a result after a throwing call must check it, since the
+ * execution continues after the throw.
+ */
+#define RLC_THROWN															\
+	(core_get()->last != NULL && core_get()->last->block == 1 &&			\
+	core_get()->last->flag == 1)
+#else
+/**
+ * Stub for the RLC_THROWN test, as the execution never continues after an
+ * error is thrown inside a TRY block.
+ */
+#define RLC_THROWN				0
+#endif
+
 /**
  * Treats an error jumping to the argument.
  *
@@ -192,7 +192,7 @@ typedef rlc_align dig_t fb_st[RLC_FB_DIGS + RLC_PAD(RLC_FB_BYTES) / (RLC_DIG / 8
  * @param[out] A			- the new binary field element.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define fb_new(A)			dv_new_dynam((dv_t *)&(A), RLC_FB_DIGS)
 #elif ALLOC == AUTO
 #define fb_new(A)			/* empty */
@@ -203,7 +203,7 @@ typedef rlc_align dig_t fb_st[RLC_FB_DIGS + RLC_PAD(RLC_FB_BYTES) / (RLC_DIG / 8
  *
  * @param[out] A			- the binary field element to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define fb_free(A)			dv_free_dynam((dv_t *)&(A))
 #elif ALLOC == AUTO
 #define fb_free(A)			/* empty */
@@ -240,7 +240,7 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
  *
  * @param[out] A			- the new prime field element.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define fp_new(A)			dv_new_dynam((dv_t *)&(A), RLC_FP_DIGS)
 #elif ALLOC == AUTO
 #define fp_new(A)			/* empty */
@@ -251,7 +251,7 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
  *
  * @param[out] A			- the prime field element to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define fp_free(A)			dv_free_dynam((dv_t *)&(A))
 #elif ALLOC == AUTO
 #define fp_free(A)			/* empty */
@@ -1001,6 +1001,17 @@ void fp_mul_karat(fp_t c, const fp_t a, const fp_t b);
  */
 void fp_mul_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Multiplies eight pairs of prime field elements at once. Computes
+ * c[i] = a[i] * b[i] for 0 <= i < 8, using vector instructions when the
+ * arithmetic backend supports them.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to multiply.
+ * @param[in] b				- the second prime field elements to multiply.
+ */
+void fp_mul_x8(fp_t *c, const fp_t *a, const fp_t *b);
+
 /**
  * Squares a prime field element using Schoolbook squaring.
  *
@@ -1034,6 +1045,16 @@ void fp_sqr_integ(fp_t c, const fp_t a);
  */
 void fp_sqr_karat(fp_t c, const fp_t a);
 
+/**
+ * Squares eight prime field elements at once. Computes c[i] = a[i]^2 for
+ * 0 <= i < 8, using vector instructions when the arithmetic backend supports
+ * them.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the prime field elements to square.
+ */
+void fp_sqr_x8(fp_t *c, const fp_t *a);
+
 /**
  * Shifts a prime field element number to the left. Computes
  * c = a * 2^bits.
@@ -1244,6 +1265,18 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
  */
 void fp_exp_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Exponentiates multiple prime field elements by a common exponent using the
+ * sliding window method. The window recoding is shared and the elements are
+ * processed eight at a time with fp_mul_x8() and fp_sqr_x8().
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponent.
+ * @param[in] n				- the number of bases.
+ */
+void fp_exp_batch(fp_t *c, const fp_t *a, const bn_t b, int n);
+
 /**
  * Tests if a prime field element is a quadratic residue.
  *
@@ -1262,6 +1295,18 @@ int fp_is_sqr(const fp_t a);
  */
 int fp_srt(fp_t c, const fp_t a);
 
+/**
+ * Extracts the square roots of multiple prime field elements. Computes
+ * c[i] = sqrt(a[i]) and sets r[i] to 1 if there is a square root, 0 otherwise.
+ * The exponentiations are batched with fp_exp_batch() when p = 3 mod 4.
+ *
+ * @param[out] c			- the results.
+ * @param[out] r			- the flags indicating which roots exist.
+ * @param[in] a				- the prime field elements.
+ * @param[in] n				- the number of elements.
+ */
+void fp_srt_batch(fp_t *c, int *r, const fp_t *a, int n);
+
 /**
  * Tests if a prime field element is a cubic residue.
  *
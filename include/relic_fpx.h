@@ -1794,6 +1794,19 @@ int fp2_is_cub(const fp2_t a);
  */
 int fp2_srt(fp2_t c, const fp2_t a);
 
+/**
+ * Extracts the square roots of multiple quadratic extension field elements.
+ * Computes c[i] = sqrt(a[i]) and sets r[i] to 1 if there is a square root,
+ * 0 otherwise. The exponentiations in the prime field are batched with
+ * fp_exp_batch() when p = 3 mod 4.
+ *
+ * @param[out] c			- the results.
+ * @param[out] r			- the flags indicating which roots exist.
+ * @param[in] a				- the extension field elements.
+ * @param[in] n				- the number of elements.
+ */
+void fp2_srt_batch(fp2_t *c, int *r, const fp2_t *a, int n);
+
 /**
  * Compresses an extension field element.
  *
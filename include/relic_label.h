@@ -59,19 +59,40 @@
 #undef core_clean
 #undef core_get
 #undef core_set
+#undef core_share
+#undef core_new
+#undef core_free
 #undef core_set_thread_initializer
+#undef core_run
 
 #define core_init 	RLC_PREFIX(core_init)
 #define core_clean 	RLC_PREFIX(core_clean)
 #define core_get 	RLC_PREFIX(core_get)
 #define core_set 	RLC_PREFIX(core_set)
+#define core_share 	RLC_PREFIX(core_share)
+#define core_new 	RLC_PREFIX(core_new)
+#define core_free 	RLC_PREFIX(core_free)
 #define core_set_thread_initializer 	RLC_PREFIX(core_set_thread_initializer)
+#define core_run 	RLC_PREFIX(core_run)
+
+#undef pool_alloc
+#undef pool_calloc
+#undef pool_realloc
+#undef pool_free
+#undef pool_clean
+
+#define pool_alloc 	RLC_PREFIX(pool_alloc)
+#define pool_calloc 	RLC_PREFIX(pool_calloc)
+#define pool_realloc 	RLC_PREFIX(pool_realloc)
+#define pool_free 	RLC_PREFIX(pool_free)
+#define pool_clean 	RLC_PREFIX(pool_clean)
 
 #undef arch_init
 #undef arch_clean
 #undef arch_cycles
 #undef arch_lzcnt
 #undef arch_tzcnt
+#undef arch_isa
 #undef arch_copy_rom
 
 #define arch_init 	RLC_PREFIX(arch_init)
@@ -79,27 +100,34 @@
 #define arch_cycles 	RLC_PREFIX(arch_cycles)
 #define arch_lzcnt 	RLC_PREFIX(arch_lzcnt)
 #define arch_tzcnt 	RLC_PREFIX(arch_tzcnt)
+#define arch_isa 	RLC_PREFIX(arch_isa)
 #define arch_copy_rom 	RLC_PREFIX(arch_copy_rom)
 
 #undef bench_init
 #undef bench_clean
 #undef bench_overhead
 #undef bench_reset
+#undef bench_label
 #undef bench_before
 #undef bench_after
 #undef bench_compute
 #undef bench_print
 #undef bench_total
+#undef bench_thread
+#undef bench_stats
 
 #define bench_init 	RLC_PREFIX(bench_init)
 #define bench_clean 	RLC_PREFIX(bench_clean)
 #define bench_overhead 	RLC_PREFIX(bench_overhead)
 #define bench_reset 	RLC_PREFIX(bench_reset)
+#define bench_label 	RLC_PREFIX(bench_label)
 #define bench_before 	RLC_PREFIX(bench_before)
 #define bench_after 	RLC_PREFIX(bench_after)
 #define bench_compute 	RLC_PREFIX(bench_compute)
 #define bench_print 	RLC_PREFIX(bench_print)
 #define bench_total 	RLC_PREFIX(bench_total)
+#define bench_thread 	RLC_PREFIX(bench_thread)
+#define bench_stats 	RLC_PREFIX(bench_stats)
 
 #undef err_simple_msg
 #undef err_full_msg
@@ -301,6 +329,16 @@
 #undef bn_rec_sac
 #undef bn_lag
 #undef bn_evl
+#undef bn_pol_pre
+#undef bn_pol_set
+#undef bn_pol_get
+#undef bn_pol_ntt
+#undef bn_pol_itt
+#undef bn_pol_mul
+#undef bn_pol_div
+#undef bn_pol_lag
+#undef bn_pol_evl
+#undef bn_pol_itp
 
 #define bn_make 	RLC_PREFIX(bn_make)
 #define bn_clean 	RLC_PREFIX(bn_clean)
@@ -415,6 +453,16 @@
 #define bn_rec_sac 	RLC_PREFIX(bn_rec_sac)
 #define bn_lag 	RLC_PREFIX(bn_lag)
 #define bn_evl 	RLC_PREFIX(bn_evl)
+#define bn_pol_pre 	RLC_PREFIX(bn_pol_pre)
+#define bn_pol_set 	RLC_PREFIX(bn_pol_set)
+#define bn_pol_get 	RLC_PREFIX(bn_pol_get)
+#define bn_pol_ntt 	RLC_PREFIX(bn_pol_ntt)
+#define bn_pol_itt 	RLC_PREFIX(bn_pol_itt)
+#define bn_pol_mul 	RLC_PREFIX(bn_pol_mul)
+#define bn_pol_div 	RLC_PREFIX(bn_pol_div)
+#define bn_pol_lag 	RLC_PREFIX(bn_pol_lag)
+#define bn_pol_evl 	RLC_PREFIX(bn_pol_evl)
+#define bn_pol_itp 	RLC_PREFIX(bn_pol_itp)
 
 #undef bn_add1_low
 #undef bn_addn_low
@@ -535,10 +583,12 @@
 #undef fp_mul_integ
 #undef fp_mul_karat
 #undef fp_mul_dig
+#undef fp_mul_x8
 #undef fp_sqr_basic
 #undef fp_sqr_comba
 #undef fp_sqr_integ
 #undef fp_sqr_karat
+#undef fp_sqr_x8
 #undef fp_lsh
 #undef fp_rsh
 #undef fp_rdc_basic
@@ -562,8 +612,10 @@
 #undef fp_exp_slide
 #undef fp_exp_monty
 #undef fp_exp_dig
+#undef fp_exp_batch
 #undef fp_is_sqr
 #undef fp_srt
+#undef fp_srt_batch
 #undef fp_is_cub
 #undef fp_crt
 
@@ -635,10 +687,12 @@
 #define fp_mul_integ 	RLC_PREFIX(fp_mul_integ)
 #define fp_mul_karat 	RLC_PREFIX(fp_mul_karat)
 #define fp_mul_dig 	RLC_PREFIX(fp_mul_dig)
+#define fp_mul_x8 	RLC_PREFIX(fp_mul_x8)
 #define fp_sqr_basic 	RLC_PREFIX(fp_sqr_basic)
 #define fp_sqr_comba 	RLC_PREFIX(fp_sqr_comba)
 #define fp_sqr_integ 	RLC_PREFIX(fp_sqr_integ)
 #define fp_sqr_karat 	RLC_PREFIX(fp_sqr_karat)
+#define fp_sqr_x8 	RLC_PREFIX(fp_sqr_x8)
 #define fp_lsh 	RLC_PREFIX(fp_lsh)
 #define fp_rsh 	RLC_PREFIX(fp_rsh)
 #define fp_rdc_basic 	RLC_PREFIX(fp_rdc_basic)
@@ -662,8 +716,10 @@
 #define fp_exp_slide 	RLC_PREFIX(fp_exp_slide)
 #define fp_exp_monty 	RLC_PREFIX(fp_exp_monty)
 #define fp_exp_dig 	RLC_PREFIX(fp_exp_dig)
+#define fp_exp_batch 	RLC_PREFIX(fp_exp_batch)
 #define fp_is_sqr 	RLC_PREFIX(fp_is_sqr)
 #define fp_srt 	RLC_PREFIX(fp_srt)
+#define fp_srt_batch 	RLC_PREFIX(fp_srt_batch)
 #define fp_is_cub 	RLC_PREFIX(fp_is_cub)
 #define fp_crt 	RLC_PREFIX(fp_crt)
 
@@ -692,8 +748,27 @@
 #undef fp_mulm_low
 #undef fp_sqrn_low
 #undef fp_sqrm_low
+#undef fp_mulm_x8_low
+#undef fp_sqrm_x8_low
+#undef fp_expm_x8_low
 #undef fp_rdcs_low
 #undef fp_rdcn_low
+#undef fp_muln_low_base
+#undef fp_mulm_low_base
+#undef fp_sqrn_low_base
+#undef fp_sqrm_low_base
+#undef fp_rdcn_low_base
+#undef fp_muln_low_bmi2
+#undef fp_mulm_low_bmi2
+#undef fp_sqrn_low_bmi2
+#undef fp_sqrm_low_bmi2
+#undef fp_rdcn_low_bmi2
+#undef fp_mulm_x8_low_base
+#undef fp_sqrm_x8_low_base
+#undef fp_expm_x8_low_base
+#undef fp_mulm_x8_low_ifma
+#undef fp_sqrm_x8_low_ifma
+#undef fp_expm_x8_low_ifma
 #undef fp_invm_low
 #undef fp_smbm_low
 
@@ -722,8 +797,27 @@
 #define fp_mulm_low 	RLC_PREFIX(fp_mulm_low)
 #define fp_sqrn_low 	RLC_PREFIX(fp_sqrn_low)
 #define fp_sqrm_low 	RLC_PREFIX(fp_sqrm_low)
+#define fp_mulm_x8_low 	RLC_PREFIX(fp_mulm_x8_low)
+#define fp_sqrm_x8_low 	RLC_PREFIX(fp_sqrm_x8_low)
+#define fp_expm_x8_low 	RLC_PREFIX(fp_expm_x8_low)
 #define fp_rdcs_low 	RLC_PREFIX(fp_rdcs_low)
 #define fp_rdcn_low 	RLC_PREFIX(fp_rdcn_low)
+#define fp_muln_low_base 	RLC_PREFIX(fp_muln_low_base)
+#define fp_mulm_low_base 	RLC_PREFIX(fp_mulm_low_base)
+#define fp_sqrn_low_base 	RLC_PREFIX(fp_sqrn_low_base)
+#define fp_sqrm_low_base 	RLC_PREFIX(fp_sqrm_low_base)
+#define fp_rdcn_low_base 	RLC_PREFIX(fp_rdcn_low_base)
+#define fp_muln_low_bmi2 	RLC_PREFIX(fp_muln_low_bmi2)
+#define fp_mulm_low_bmi2 	RLC_PREFIX(fp_mulm_low_bmi2)
+#define fp_sqrn_low_bmi2 	RLC_PREFIX(fp_sqrn_low_bmi2)
+#define fp_sqrm_low_bmi2 	RLC_PREFIX(fp_sqrm_low_bmi2)
+#define fp_rdcn_low_bmi2 	RLC_PREFIX(fp_rdcn_low_bmi2)
+#define fp_mulm_x8_low_base 	RLC_PREFIX(fp_mulm_x8_low_base)
+#define fp_sqrm_x8_low_base 	RLC_PREFIX(fp_sqrm_x8_low_base)
+#define fp_expm_x8_low_base 	RLC_PREFIX(fp_expm_x8_low_base)
+#define fp_mulm_x8_low_ifma 	RLC_PREFIX(fp_mulm_x8_low_ifma)
+#define fp_sqrm_x8_low_ifma 	RLC_PREFIX(fp_sqrm_x8_low_ifma)
+#define fp_expm_x8_low_ifma 	RLC_PREFIX(fp_expm_x8_low_ifma)
 #define fp_invm_low 	RLC_PREFIX(fp_invm_low)
 #define fp_smbm_low 	RLC_PREFIX(fp_smbm_low)
 
@@ -972,6 +1066,7 @@
 #undef ep_print
 #undef ep_size_bin
 #undef ep_read_bin
+#undef ep_read_bin_batch
 #undef ep_write_bin
 #undef ep_neg
 #undef ep_add_basic
@@ -1007,22 +1102,31 @@
 #undef ep_mul_fix_combs
 #undef ep_mul_fix_combd
 #undef ep_mul_fix_lwnaf
+#undef ep_mul_size_bin
+#undef ep_mul_pre_bin
+#undef ep_mul_fix_bin
 #undef ep_mul_sim_basic
 #undef ep_mul_sim_trick
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_lot
+#undef ep_mul_sim_pip
 #undef ep_mul_sim_gen
 #undef ep_mul_sim_dig
 #undef ep_norm
 #undef ep_norm_sim
+#undef ep_norm_batch
+#undef ep_add_batch
+#undef ep_dbl_batch
 #undef ep_map_basic
 #undef ep_map_sswum
 #undef ep_map_swift
 #undef ep_map_rnd_size
 #undef ep_map_rnd
+#undef ep_map_batch
 #undef ep_pck
 #undef ep_upk
+#undef ep_upk_batch
 
 #define ep_curve_init 	RLC_PREFIX(ep_curve_init)
 #define ep_curve_clean 	RLC_PREFIX(ep_curve_clean)
@@ -1071,6 +1175,7 @@
 #define ep_print 	RLC_PREFIX(ep_print)
 #define ep_size_bin 	RLC_PREFIX(ep_size_bin)
 #define ep_read_bin 	RLC_PREFIX(ep_read_bin)
+#define ep_read_bin_batch 	RLC_PREFIX(ep_read_bin_batch)
 #define ep_write_bin 	RLC_PREFIX(ep_write_bin)
 #define ep_neg 	RLC_PREFIX(ep_neg)
 #define ep_add_basic 	RLC_PREFIX(ep_add_basic)
@@ -1106,22 +1211,31 @@
 #define ep_mul_fix_combs 	RLC_PREFIX(ep_mul_fix_combs)
 #define ep_mul_fix_combd 	RLC_PREFIX(ep_mul_fix_combd)
 #define ep_mul_fix_lwnaf 	RLC_PREFIX(ep_mul_fix_lwnaf)
+#define ep_mul_size_bin 	RLC_PREFIX(ep_mul_size_bin)
+#define ep_mul_pre_bin 	RLC_PREFIX(ep_mul_pre_bin)
+#define ep_mul_fix_bin 	RLC_PREFIX(ep_mul_fix_bin)
 #define ep_mul_sim_basic 	RLC_PREFIX(ep_mul_sim_basic)
 #define ep_mul_sim_trick 	RLC_PREFIX(ep_mul_sim_trick)
 #define ep_mul_sim_inter 	RLC_PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	RLC_PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_lot 	RLC_PREFIX(ep_mul_sim_lot)
+#define ep_mul_sim_pip 	RLC_PREFIX(ep_mul_sim_pip)
 #define ep_mul_sim_gen 	RLC_PREFIX(ep_mul_sim_gen)
 #define ep_mul_sim_dig 	RLC_PREFIX(ep_mul_sim_dig)
 #define ep_norm 	RLC_PREFIX(ep_norm)
 #define ep_norm_sim 	RLC_PREFIX(ep_norm_sim)
+#define ep_norm_batch 	RLC_PREFIX(ep_norm_batch)
+#define ep_add_batch 	RLC_PREFIX(ep_add_batch)
+#define ep_dbl_batch 	RLC_PREFIX(ep_dbl_batch)
 #define ep_map_basic 	RLC_PREFIX(ep_map_basic)
 #define ep_map_sswum 	RLC_PREFIX(ep_map_sswum)
 #define ep_map_swift 	RLC_PREFIX(ep_map_swift)
 #define ep_map_rnd_size 	RLC_PREFIX(ep_map_rnd_size)
 #define ep_map_rnd 	RLC_PREFIX(ep_map_rnd)
+#define ep_map_batch 	RLC_PREFIX(ep_map_batch)
 #define ep_pck 	RLC_PREFIX(ep_pck)
 #define ep_upk 	RLC_PREFIX(ep_upk)
+#define ep_upk_batch 	RLC_PREFIX(ep_upk_batch)
 
 #undef ed_st
 #undef ed_t
@@ -1449,6 +1563,7 @@
 #undef ep2_print
 #undef ep2_size_bin
 #undef ep2_read_bin
+#undef ep2_read_bin_batch
 #undef ep2_write_bin
 #undef ep2_neg
 #undef ep2_add_basic
@@ -1468,6 +1583,7 @@
 #undef ep2_mul_gen
 #undef ep2_mul_dig
 #undef ep2_mul_cof
+#undef ep2_mul_cof_sim
 #undef ep2_mul_pre_basic
 #undef ep2_mul_pre_yaowi
 #undef ep2_mul_pre_nafwi
@@ -1485,6 +1601,7 @@
 #undef ep2_mul_sim_inter
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_lot
+#undef ep2_mul_sim_pip
 #undef ep2_mul_sim_gen
 #undef ep2_mul_sim_dig
 #undef ep2_norm
@@ -1492,9 +1609,11 @@
 #undef ep2_map_basic
 #undef ep2_map_sswum
 #undef ep2_map_swift
+#undef ep2_map_batch
 #undef ep2_frb
 #undef ep2_pck
 #undef ep2_upk
+#undef ep2_upk_batch
 
 #define ep2_curve_init 	RLC_PREFIX(ep2_curve_init)
 #define ep2_curve_clean 	RLC_PREFIX(ep2_curve_clean)
@@ -1525,6 +1644,7 @@
 #define ep2_print 	RLC_PREFIX(ep2_print)
 #define ep2_size_bin 	RLC_PREFIX(ep2_size_bin)
 #define ep2_read_bin 	RLC_PREFIX(ep2_read_bin)
+#define ep2_read_bin_batch 	RLC_PREFIX(ep2_read_bin_batch)
 #define ep2_write_bin 	RLC_PREFIX(ep2_write_bin)
 #define ep2_neg 	RLC_PREFIX(ep2_neg)
 #define ep2_add_basic 	RLC_PREFIX(ep2_add_basic)
@@ -1544,6 +1664,7 @@
 #define ep2_mul_gen 	RLC_PREFIX(ep2_mul_gen)
 #define ep2_mul_dig 	RLC_PREFIX(ep2_mul_dig)
 #define ep2_mul_cof 	RLC_PREFIX(ep2_mul_cof)
+#define ep2_mul_cof_sim 	RLC_PREFIX(ep2_mul_cof_sim)
 #define ep2_mul_pre_basic 	RLC_PREFIX(ep2_mul_pre_basic)
 #define ep2_mul_pre_yaowi 	RLC_PREFIX(ep2_mul_pre_yaowi)
 #define ep2_mul_pre_nafwi 	RLC_PREFIX(ep2_mul_pre_nafwi)
@@ -1561,6 +1682,7 @@
 #define ep2_mul_sim_inter 	RLC_PREFIX(ep2_mul_sim_inter)
 #define ep2_mul_sim_joint 	RLC_PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_lot 	RLC_PREFIX(ep2_mul_sim_lot)
+#define ep2_mul_sim_pip 	RLC_PREFIX(ep2_mul_sim_pip)
 #define ep2_mul_sim_gen 	RLC_PREFIX(ep2_mul_sim_gen)
 #define ep2_mul_sim_dig 	RLC_PREFIX(ep2_mul_sim_dig)
 #define ep2_norm 	RLC_PREFIX(ep2_norm)
@@ -1568,9 +1690,11 @@
 #define ep2_map_basic 	RLC_PREFIX(ep2_map_basic)
 #define ep2_map_sswum 	RLC_PREFIX(ep2_map_sswum)
 #define ep2_map_swift 	RLC_PREFIX(ep2_map_swift)
+#define ep2_map_batch 	RLC_PREFIX(ep2_map_batch)
 #define ep2_frb 	RLC_PREFIX(ep2_frb)
 #define ep2_pck 	RLC_PREFIX(ep2_pck)
 #define ep2_upk 	RLC_PREFIX(ep2_upk)
+#define ep2_upk_batch 	RLC_PREFIX(ep2_upk_batch)
 
 #undef ep3_st
 #undef ep3_t
@@ -2126,6 +2250,7 @@
 #undef fp2_crt
 #undef fp2_is_cub
 #undef fp2_srt
+#undef fp2_srt_batch
 #undef fp2_pck
 #undef fp2_upk
 
@@ -2175,6 +2300,7 @@
 #define fp2_crt 	RLC_PREFIX(fp2_crt)
 #define fp2_is_cub 	RLC_PREFIX(fp2_is_cub)
 #define fp2_srt 	RLC_PREFIX(fp2_srt)
+#define fp2_srt_batch 	RLC_PREFIX(fp2_srt_batch)
 #define fp2_pck 	RLC_PREFIX(fp2_pck)
 #define fp2_upk 	RLC_PREFIX(fp2_upk)
 
@@ -3137,20 +3263,33 @@
 #undef pp_map_sim_weilp_k12
 #undef pp_map_oatep_k12
 #undef pp_map_sim_oatep_k12
+#undef pp_map_par_oatep_k12
+#undef pp_prep_k12
+#undef pp_map_prep_k12
+#undef pp_map_sim_prep_k12
 #undef pp_map_tatep_k16
 #undef pp_map_sim_tatep_k16
 #undef pp_map_weilp_k16
 #undef pp_map_sim_weilp_k16
 #undef pp_map_oatep_k16
 #undef pp_map_sim_oatep_k16
+#undef pp_prep_k16
+#undef pp_map_prep_k16
+#undef pp_map_sim_prep_k16
 #undef pp_map_tatep_k18
 #undef pp_map_sim_tatep_k18
 #undef pp_map_weilp_k18
 #undef pp_map_sim_weilp_k18
 #undef pp_map_oatep_k18
 #undef pp_map_sim_oatep_k18
+#undef pp_prep_k18
+#undef pp_map_prep_k18
+#undef pp_map_sim_prep_k18
 #undef pp_map_k24
 #undef pp_map_sim_k24
+#undef pp_prep_k24
+#undef pp_map_prep_k24
+#undef pp_map_sim_prep_k24
 #undef pp_map_k48
 #undef pp_map_sim_k48
 #undef pp_map_k54
@@ -3242,20 +3381,33 @@
 #define pp_map_sim_weilp_k12 	RLC_PREFIX(pp_map_sim_weilp_k12)
 #define pp_map_oatep_k12 	RLC_PREFIX(pp_map_oatep_k12)
 #define pp_map_sim_oatep_k12 	RLC_PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_par_oatep_k12 	RLC_PREFIX(pp_map_par_oatep_k12)
+#define pp_prep_k12 	RLC_PREFIX(pp_prep_k12)
+#define pp_map_prep_k12 	RLC_PREFIX(pp_map_prep_k12)
+#define pp_map_sim_prep_k12 	RLC_PREFIX(pp_map_sim_prep_k12)
 #define pp_map_tatep_k16 	RLC_PREFIX(pp_map_tatep_k16)
 #define pp_map_sim_tatep_k16 	RLC_PREFIX(pp_map_sim_tatep_k16)
 #define pp_map_weilp_k16 	RLC_PREFIX(pp_map_weilp_k16)
 #define pp_map_sim_weilp_k16 	RLC_PREFIX(pp_map_sim_weilp_k16)
 #define pp_map_oatep_k16 	RLC_PREFIX(pp_map_oatep_k16)
 #define pp_map_sim_oatep_k16 	RLC_PREFIX(pp_map_sim_oatep_k16)
+#define pp_prep_k16 	RLC_PREFIX(pp_prep_k16)
+#define pp_map_prep_k16 	RLC_PREFIX(pp_map_prep_k16)
+#define pp_map_sim_prep_k16 	RLC_PREFIX(pp_map_sim_prep_k16)
 #define pp_map_tatep_k18 	RLC_PREFIX(pp_map_tatep_k18)
 #define pp_map_sim_tatep_k18 	RLC_PREFIX(pp_map_sim_tatep_k18)
 #define pp_map_weilp_k18 	RLC_PREFIX(pp_map_weilp_k18)
 #define pp_map_sim_weilp_k18 	RLC_PREFIX(pp_map_sim_weilp_k18)
 #define pp_map_oatep_k18 	RLC_PREFIX(pp_map_oatep_k18)
 #define pp_map_sim_oatep_k18 	RLC_PREFIX(pp_map_sim_oatep_k18)
+#define pp_prep_k18 	RLC_PREFIX(pp_prep_k18)
+#define pp_map_prep_k18 	RLC_PREFIX(pp_map_prep_k18)
+#define pp_map_sim_prep_k18 	RLC_PREFIX(pp_map_sim_prep_k18)
 #define pp_map_k24 	RLC_PREFIX(pp_map_k24)
 #define pp_map_sim_k24 	RLC_PREFIX(pp_map_sim_k24)
+#define pp_prep_k24 	RLC_PREFIX(pp_prep_k24)
+#define pp_map_prep_k24 	RLC_PREFIX(pp_map_prep_k24)
+#define pp_map_sim_prep_k24 	RLC_PREFIX(pp_map_sim_prep_k24)
 #define pp_map_k48 	RLC_PREFIX(pp_map_k48)
 #define pp_map_sim_k48 	RLC_PREFIX(pp_map_sim_k48)
 #define pp_map_k54 	RLC_PREFIX(pp_map_k54)
@@ -3263,10 +3415,20 @@
 #undef pc_core_init
 #undef pc_core_calc
 #undef pc_core_clean
+#undef pc_core_reset
+#undef pc_dlog_size
+#undef pc_dlog_write
+#undef pc_dlog_read
+#undef pc_dlog_free
 
 #define pc_core_init 	RLC_PREFIX(pc_core_init)
 #define pc_core_calc 	RLC_PREFIX(pc_core_calc)
 #define pc_core_clean 	RLC_PREFIX(pc_core_clean)
+#define pc_core_reset 	RLC_PREFIX(pc_core_reset)
+#define pc_dlog_size 	RLC_PREFIX(pc_dlog_size)
+#define pc_dlog_write 	RLC_PREFIX(pc_dlog_write)
+#define pc_dlog_read 	RLC_PREFIX(pc_dlog_read)
+#define pc_dlog_free 	RLC_PREFIX(pc_dlog_free)
 
 #undef mpc_mt_gen
 #undef mpc_mt_lcl
@@ -3330,6 +3492,12 @@
 #undef cp_ecss_gen
 #undef cp_ecss_sig
 #undef cp_ecss_ver
+#undef cp_ecpk_pre
+#undef cp_ecpk_init
+#undef cp_ecpk_clean
+#undef cp_ecpk_get
+#undef cp_ecdsa_ver_pre
+#undef cp_ecss_ver_pre
 #undef cp_pdpub_gen
 #undef cp_pdpub_ask
 #undef cp_pdpub_ans
@@ -3381,6 +3549,7 @@
 #undef cp_bls_ver
 #undef cp_bls_agg_sig
 #undef cp_bls_agg_ver
+#undef cp_bls_batch_ver
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
@@ -3435,6 +3604,19 @@
 #undef cp_etrs_ext
 #undef cp_etrs_uni
 #undef cp_ped_com
+#undef cp_ipa_gen
+#undef cp_ipa_prv
+#undef cp_ipa_ver
+#undef cp_kzg_gen
+#undef cp_kzg_size
+#undef cp_kzg_write
+#undef cp_kzg_read
+#undef cp_kzg_com
+#undef cp_kzg_prv
+#undef cp_kzg_ver
+#undef cp_kzg_prv_sim
+#undef cp_kzg_ver_sim
+#undef cp_kzg_ver_lot
 #undef cp_oprf_ask
 #undef cp_oprf_ans
 #undef cp_oprf_res
@@ -3464,6 +3646,7 @@
 #undef cp_pbpsi_gen
 #undef cp_pbpsi_ask
 #undef cp_pbpsi_ans
+#undef cp_pbpsi_ans_str
 #undef cp_pbpsi_int
 
 #define cp_rsa_gen 	RLC_PREFIX(cp_rsa_gen)
@@ -3501,6 +3684,12 @@
 #define cp_ecss_gen 	RLC_PREFIX(cp_ecss_gen)
 #define cp_ecss_sig 	RLC_PREFIX(cp_ecss_sig)
 #define cp_ecss_ver 	RLC_PREFIX(cp_ecss_ver)
+#define cp_ecpk_pre 	RLC_PREFIX(cp_ecpk_pre)
+#define cp_ecpk_init 	RLC_PREFIX(cp_ecpk_init)
+#define cp_ecpk_clean 	RLC_PREFIX(cp_ecpk_clean)
+#define cp_ecpk_get 	RLC_PREFIX(cp_ecpk_get)
+#define cp_ecdsa_ver_pre 	RLC_PREFIX(cp_ecdsa_ver_pre)
+#define cp_ecss_ver_pre 	RLC_PREFIX(cp_ecss_ver_pre)
 #define cp_pdpub_gen 	RLC_PREFIX(cp_pdpub_gen)
 #define cp_pdpub_ask 	RLC_PREFIX(cp_pdpub_ask)
 #define cp_pdpub_ans 	RLC_PREFIX(cp_pdpub_ans)
@@ -3552,6 +3741,7 @@
 #define cp_bls_ver 	RLC_PREFIX(cp_bls_ver)
 #define cp_bls_agg_sig 	RLC_PREFIX(cp_bls_agg_sig)
 #define cp_bls_agg_ver 	RLC_PREFIX(cp_bls_agg_ver)
+#define cp_bls_batch_ver 	RLC_PREFIX(cp_bls_batch_ver)
 #define cp_bbs_gen 	RLC_PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	RLC_PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	RLC_PREFIX(cp_bbs_ver)
@@ -3606,6 +3796,19 @@
 #define cp_etrs_ext 	RLC_PREFIX(cp_etrs_ext)
 #define cp_etrs_uni 	RLC_PREFIX(cp_etrs_uni)
 #define cp_ped_com 	RLC_PREFIX(cp_ped_com)
+#define cp_ipa_gen 	RLC_PREFIX(cp_ipa_gen)
+#define cp_ipa_prv 	RLC_PREFIX(cp_ipa_prv)
+#define cp_ipa_ver 	RLC_PREFIX(cp_ipa_ver)
+#define cp_kzg_gen 	RLC_PREFIX(cp_kzg_gen)
+#define cp_kzg_size 	RLC_PREFIX(cp_kzg_size)
+#define cp_kzg_write 	RLC_PREFIX(cp_kzg_write)
+#define cp_kzg_read 	RLC_PREFIX(cp_kzg_read)
+#define cp_kzg_com 	RLC_PREFIX(cp_kzg_com)
+#define cp_kzg_prv 	RLC_PREFIX(cp_kzg_prv)
+#define cp_kzg_ver 	RLC_PREFIX(cp_kzg_ver)
+#define cp_kzg_prv_sim 	RLC_PREFIX(cp_kzg_prv_sim)
+#define cp_kzg_ver_sim 	RLC_PREFIX(cp_kzg_ver_sim)
+#define cp_kzg_ver_lot 	RLC_PREFIX(cp_kzg_ver_lot)
 #define cp_oprf_ask 	RLC_PREFIX(cp_oprf_ask)
 #define cp_oprf_ans 	RLC_PREFIX(cp_oprf_ans)
 #define cp_oprf_res 	RLC_PREFIX(cp_oprf_res)
@@ -3635,10 +3838,12 @@
 #define cp_pbpsi_gen 	RLC_PREFIX(cp_pbpsi_gen)
 #define cp_pbpsi_ask 	RLC_PREFIX(cp_pbpsi_ask)
 #define cp_pbpsi_ans 	RLC_PREFIX(cp_pbpsi_ans)
+#define cp_pbpsi_ans_str 	RLC_PREFIX(cp_pbpsi_ans_str)
 #define cp_pbpsi_int 	RLC_PREFIX(cp_pbpsi_int)
 
 #undef md_map_sh224
 #undef md_map_sh256
+#undef md_map_sh256_batch
 #undef md_map_sh384
 #undef md_map_sh512
 #undef md_map_b2s160
@@ -3650,9 +3855,11 @@
 #undef md_xmd_sh256
 #undef md_xmd_sh384
 #undef md_xmd_sh512
+#undef md_xmd_batch
 
 #define md_map_sh224 	RLC_PREFIX(md_map_sh224)
 #define md_map_sh256 	RLC_PREFIX(md_map_sh256)
+#define md_map_sh256_batch 	RLC_PREFIX(md_map_sh256_batch)
 #define md_map_sh384 	RLC_PREFIX(md_map_sh384)
 #define md_map_sh512 	RLC_PREFIX(md_map_sh512)
 #define md_map_b2s160 	RLC_PREFIX(md_map_b2s160)
@@ -3664,6 +3871,7 @@
 #define md_xmd_sh256 	RLC_PREFIX(md_xmd_sh256)
 #define md_xmd_sh384 	RLC_PREFIX(md_xmd_sh384)
 #define md_xmd_sh512 	RLC_PREFIX(md_xmd_sh512)
+#define md_xmd_batch 	RLC_PREFIX(md_xmd_batch)
 
 #endif /* LABEL */
 
@@ -145,6 +145,19 @@ void md_map_sh224(uint8_t *hash, const uint8_t *msg, size_t len);
  */
 void md_map_sh256(uint8_t *hash, const uint8_t *msg, size_t len);
 
+/**
+ * Computes the SHA-256 hash function on multiple independent messages,
+ * hashing up to eight of them in parallel when vector instructions are
+ * available.
+ *
+ * @param[out] hash				- the digests, stored consecutively.
+ * @param[in] msg				- the messages to hash.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] n					- the number of messages.
+ */
+void md_map_sh256_batch(uint8_t *hash, const uint8_t *msg[],
+		const size_t len[], int n);
+
 /**
  * Computes the SHA-384 hash function.
  *
@@ -271,4 +284,20 @@ void md_xmd_sh384(uint8_t *buf, size_t buf_len, const uint8_t *in,
 void md_xmd_sh512(uint8_t *buf, size_t buf_len, const uint8_t *in,
 		size_t in_len, const uint8_t *dst, size_t dst_len);
 
+/**
+ * Maps multiple byte vectors and a common domain separation tag to
+ * arbitrary-length pseudorandom outputs using the chosen hash function.
+ * Computes the same outputs as md_xmd() on each message.
+ *
+ * @param[out] buf					- the outputs, stored consecutively.
+ * @param[in] buf_len				- the requested size of each output.
+ * @param[in] in					- the messages to hash.
+ * @param[in] in_len				- the message lengths in bytes.
+ * @param[in] n						- the number of messages.
+ * @param[in] dst					- the domain separation tag.
+ * @param[in] dst_len				- the domain separation tag length in bytes.
+ */
+void md_xmd_batch(uint8_t *buf, size_t buf_len, const uint8_t *in[],
+		const size_t in_len[], int n, const uint8_t *dst, size_t dst_len);
+
 #endif /* !RLC_MD_H */
@@ -116,7 +116,7 @@ typedef pt_st *pt_t;
  * @param[in,out] A			- the multiple precision integer to initialize.
  * @throw ERR_NO_MEMORY		- if there is no available memory.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define mt_new(A)															\
 	A = (mt_t)calloc(1, sizeof(mt_st));										\
 	if ((A) == NULL) {														\
@@ -142,7 +142,7 @@ typedef pt_st *pt_t;
  *
  * @param[in,out] A			- the multiple precision integer to free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define mt_free(A)															\
 	if (A != NULL) {														\
 		bn_free((A)->a);													\
@@ -173,7 +173,7 @@ typedef pt_st *pt_t;
  *
  * @param[out] A			- the new pairing triple.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define pt_new(A)															\
 	A = (pt_t)calloc(1, sizeof(pt_st));										\
 	if (A == NULL) {														\
@@ -193,7 +193,7 @@ typedef pt_st *pt_t;
  *
  * @param[out] A			- the pairing triple to clean and free.
  */
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 #define pt_free(A)															\
 	if (A != NULL) {														\
 		g1_free((A)->a);													\
@@ -123,6 +123,28 @@
  */
 #define RLC_G2_TABLE			RLC_CAT(RLC_CAT(RLC_, RLC_G2_UPPER), _TABLE)
 
+/**
+ * Number of entries in the table of elements known to be in G_1 or G_2.
+ */
+#define RLC_PC_VAL				256
+
+/**
+ * Size in bytes of the SHA-256 digests identifying elements in that table.
+ */
+#define RLC_PC_VLEN				32
+
+/**
+ * Maximum number of baby steps in the temporary tables built for computing
+ * discrete logarithms when no precomputed table is given.
+ */
+#define RLC_PC_DLOG_MAX			(1 << 16)
+
+/**
+ * Number of attempts with different pseudo-random walks before the kangaroo
+ * method gives up on finding a discrete logarithm.
+ */
+#define RLC_PC_DLOG_TRY			8
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -152,6 +174,35 @@ typedef RLC_CAT(RLC_G2_LOWER, st) g2_st;
  */
 typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
 
+/**
+ * Represents a G_2 element with precomputed line functions for pairings.
+ */
+typedef pp_prep_t g2_prep_t;
+
+/**
+ * Represents a table of baby steps for computing discrete logarithms to a
+ * fixed base in G_1, G_2 or G_T.
+ */
+typedef struct {
+	/** The fingerprint of the base of the logarithms. */
+	uint64_t id;
+	/** The number of baby steps. */
+	uint64_t m;
+	/** The number of slots in the hash table, a power of two. */
+	uint64_t len;
+	/** The fingerprints of the baby steps, indexed by their hash. */
+	uint64_t *key;
+	/** The exponents of the baby steps, zero for empty slots. */
+	uint32_t *val;
+	/** The flag indicating if the slots are owned by the table. */
+	int own;
+} pc_dlog_st;
+
+/**
+ * Pointer to a table of baby steps.
+ */
+typedef pc_dlog_st pc_dlog_t[1];
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -222,6 +273,28 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define gt_free(A)			RLC_CAT(RLC_GT_LOWER, free)(A)
 
+/**
+ * Initializes a precomputed G_2 element with a null value.
+ *
+ * @param[out] A			- the element to initialize.
+ */
+#define g2_prep_null(A)		pp_prep_null(A)
+
+/**
+ * Calls a function to allocate a precomputed G_2 element.
+ *
+ * @param[out] A			- the new element.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define g2_prep_new(A)		pp_prep_new(A)
+
+/**
+ * Calls a function to clean and free a precomputed G_2 element.
+ *
+ * @param[out] A			- the element to clean and free.
+ */
+#define g2_prep_free(A)		pp_prep_free(A)
+
 /**
  * Returns the generator of the group G_1.
  *
@@ -553,6 +626,36 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g2_read_bin(P, B, L) 	RLC_CAT(RLC_G2_LOWER, read_bin)(P, B, L)
 
+/**
+ * Reads a vector of G_1 elements from consecutive encodings of the same length,
+ * flagging invalid encodings instead of throwing errors. Subgroup membership is
+ * not checked, see g1_is_valid_batch().
+ *
+ * @param[out] P			- the results.
+ * @param[out] V			- the flags indicating which encodings are valid.
+ * @param[in] B				- the byte vector.
+ * @param[in] L				- the length of each encoding.
+ * @param[in] N				- the number of elements.
+ * @throw ERR_NO_BUFFER		- if the length of the encodings is invalid.
+ */
+#define g1_read_bin_batch(P, V, B, L, N)									\
+	RLC_CAT(RLC_G1_LOWER, read_bin_batch)(P, V, B, L, N)
+
+/**
+ * Reads a vector of G_2 elements from consecutive encodings of the same length,
+ * flagging invalid encodings instead of throwing errors. Subgroup membership is
+ * not checked, see g2_is_valid_batch().
+ *
+ * @param[out] P			- the results.
+ * @param[out] V			- the flags indicating which encodings are valid.
+ * @param[in] B				- the byte vector.
+ * @param[in] L				- the length of each encoding.
+ * @param[in] N				- the number of elements.
+ * @throw ERR_NO_BUFFER		- if the length of the encodings is invalid.
+ */
+#define g2_read_bin_batch(P, V, B, L, N)									\
+	RLC_CAT(RLC_G2_LOWER, read_bin_batch)(P, V, B, L, N)
+
 /**
  * Reads a G_T element from a byte vector in big-endian format.
  *
@@ -826,6 +929,36 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g2_mul_fix(R, T, K)	RLC_CAT(RLC_G2_LOWER, mul_fix)(R, T, K)
 
+/**
+ * Returns the number of bytes of a serialized precomputation table for
+ * multiplying an element from G_1.
+ *
+ * @param[in] W				- the window width.
+ */
+#define g1_mul_size_bin(W)	RLC_CAT(RLC_G1_LOWER, mul_size_bin)(W)
+
+/**
+ * Builds a serialized precomputation table for multiplying an element from
+ * G_1, which can be stored and later mapped into memory.
+ *
+ * @param[out] B			- the serialized table.
+ * @param[in] L				- the buffer capacity.
+ * @param[in] P				- the element to multiply.
+ * @param[in] W				- the window width.
+ */
+#define g1_mul_pre_bin(B, L, P, W)	RLC_CAT(RLC_G1_LOWER, mul_pre_bin)(B, L, P, W)
+
+/**
+ * Multiplies an element from G_1 using a serialized precomputation table.
+ * Computes R = [k]P.
+ *
+ * @param[out] R			- the result.
+ * @param[in] B				- the serialized table.
+ * @param[in] L				- the number of bytes in the table.
+ * @param[in] K				- the integer.
+ */
+#define g1_mul_fix_bin(R, B, L, K)	RLC_CAT(RLC_G1_LOWER, mul_fix_bin)(R, B, L, K)
+
 /**
  * Multiplies simultaneously two elements from G_1. Computes R = [k]P + [l]Q.
  *
@@ -973,6 +1106,52 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define pc_map_sim(R, P, Q, M)  RLC_CAT(pp_map_sim_k, RLC_GT_EMBED)(R, P, Q, M)
 
+/**
+ * Computes the multi-pairing of G_1 elements and G_2 elements, evaluating the
+ * Miller loops in parallel when supported. Computes R = \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M 			- the number of pairing arguments.
+ */
+#if RLC_GT_EMBED == 12
+#define pc_map_par(R, P, Q, M)  pp_map_par_k12(R, P, Q, M)
+#else
+#define pc_map_par(R, P, Q, M)  pc_map_sim(R, P, Q, M)
+#endif
+
+/**
+ * Precomputes the line functions of a G_2 element used as a fixed pairing
+ * argument. Only available for embedding degrees 12, 16, 18 and 24.
+ *
+ * @param[out] R			- the precomputed element.
+ * @param[in] Q				- the G_2 element.
+ */
+#define g2_prep(R, Q)	RLC_CAT(pp_prep_k, RLC_GT_EMBED)(R, Q)
+
+/**
+ * Computes the optimal ate pairing of a G_1 element and a precomputed G_2
+ * element. Computes R = e(P, Q).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first element.
+ * @param[in] Q				- the precomputed second element.
+ */
+#define pc_map_prep(R, P, Q)	RLC_CAT(pp_map_prep_k, RLC_GT_EMBED)(R, P, Q)
+
+/**
+ * Computes the optimal ate multi-pairing of G_1 elements and precomputed G_2
+ * elements. Computes R = \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the precomputed second pairing arguments.
+ * @param[in] M 			- the number of pairing arguments.
+ */
+#define pc_map_sim_prep(R, P, Q, M)											\
+	RLC_CAT(pp_map_sim_prep_k, RLC_GT_EMBED)(R, P, Q, M)
+
 /**
  * Computes the final exponentiation of the pairing.
  *
@@ -1000,6 +1179,12 @@ void pc_core_calc(void);
  */
 void pc_core_clean(void);
 
+/**
+ * Forgets all elements previously found to be valid in G_1 or G_2, forcing
+ * their next validity tests to be computed in full.
+ */
+void pc_core_reset(void);
+
 
 /**
  * Assigns a random value to an element from G_T.
@@ -1110,6 +1295,26 @@ int g1_is_valid(const g1_t a);
  */
 int g2_is_valid(const g2_t a);
 
+/**
+ * Checks if a vector of elements from G_1 is valid, distributing the checks
+ * among threads for large batches.
+ *
+ * @param[out] r			- the flags indicating which elements are valid.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ */
+void g1_is_valid_batch(int *r, const g1_t *a, int n);
+
+/**
+ * Checks if a vector of elements from G_2 is valid, distributing the checks
+ * among threads for large batches.
+ *
+ * @param[out] r			- the flags indicating which elements are valid.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ */
+void g2_is_valid_batch(int *r, const g2_t *a, int n);
+
 /**
  * Checks if an element form G_T is valid (has the right order).
  *
@@ -1117,4 +1322,122 @@ int g2_is_valid(const g2_t a);
  */
 int gt_is_valid(const gt_t a);
 
+/**
+ * Builds a table with the first baby steps to a base in G_1, to be used in
+ * later discrete logarithm computations to the same base. The table must be
+ * freed with pc_dlog_free().
+ *
+ * @param[out] t			- the table.
+ * @param[in] s				- the base of the logarithms.
+ * @param[in] m				- the number of baby steps, smaller than 2^32.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int g1_dlog_pre(pc_dlog_t t, const g1_t s, dig_t m);
+
+/**
+ * Builds a table with the first baby steps to a base in G_2, to be used in
+ * later discrete logarithm computations to the same base. The table must be
+ * freed with pc_dlog_free().
+ *
+ * @param[out] t			- the table.
+ * @param[in] s				- the base of the logarithms.
+ * @param[in] m				- the number of baby steps, smaller than 2^32.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int g2_dlog_pre(pc_dlog_t t, const g2_t s, dig_t m);
+
+/**
+ * Builds a table with the first baby steps to a base in G_T, to be used in
+ * later discrete logarithm computations to the same base. The table must be
+ * freed with pc_dlog_free().
+ *
+ * @param[out] t			- the table.
+ * @param[in] s				- the base of the logarithms.
+ * @param[in] m				- the number of baby steps, smaller than 2^32.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int gt_dlog_pre(pc_dlog_t t, const gt_t s, dig_t m);
+
+/**
+ * Computes a discrete logarithm in G_1 known to lie in a range. Uses the
+ * baby-step giant-step method with the given table when it has at least
+ * sqrt(r)/2 baby steps. Without a table, tables are built for ranges growing
+ * up to r, so the cost depends on the logarithm instead of the bound, and the
+ * Pollard kangaroo method is used when those tables would be too large.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] a				- the element to compute the logarithm of.
+ * @param[in] s				- the base of the logarithm.
+ * @param[in] t				- the table of baby steps to the base, or NULL.
+ * @param[in] r				- the upper bound of the range, exclusive.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int g1_dlog(dig_t *k, const g1_t a, const g1_t s, const pc_dlog_t t, dig_t r);
+
+/**
+ * Computes a discrete logarithm in G_2 known to lie in a range, as in
+ * g1_dlog().
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] a				- the element to compute the logarithm of.
+ * @param[in] s				- the base of the logarithm.
+ * @param[in] t				- the table of baby steps to the base, or NULL.
+ * @param[in] r				- the upper bound of the range, exclusive.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int g2_dlog(dig_t *k, const g2_t a, const g2_t s, const pc_dlog_t t, dig_t r);
+
+/**
+ * Computes a discrete logarithm in G_T known to lie in a range, as in
+ * g1_dlog().
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] a				- the element to compute the logarithm of.
+ * @param[in] s				- the base of the logarithm.
+ * @param[in] t				- the table of baby steps to the base, or NULL.
+ * @param[in] r				- the upper bound of the range, exclusive.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int gt_dlog(dig_t *k, const gt_t a, const gt_t s, const pc_dlog_t t, dig_t r);
+
+/**
+ * Returns the number of bytes necessary to store a table of baby steps.
+ *
+ * @param[in] t				- the table.
+ * @return the number of bytes.
+ */
+size_t pc_dlog_size(const pc_dlog_t t);
+
+/**
+ * Writes a table of baby steps to a byte vector, in the native byte order.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the table.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is insufficient.
+ */
+void pc_dlog_write(uint8_t *bin, size_t len, const pc_dlog_t t);
+
+/**
+ * Reads a table of baby steps from a byte vector without copying it, so a
+ * memory-mapped file can be used directly. The byte vector must be aligned to
+ * 8 bytes and remain available while the table is in use. The header, the
+ * capacity and the load factor are checked, and all slots are scanned once to
+ * make sure that lookups terminate.
+ *
+ * @param[out] t			- the table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is insufficient.
+ * @throw ERR_NO_VALID		- if the byte vector is not a valid table.
+ */
+void pc_dlog_read(pc_dlog_t t, const uint8_t *bin, size_t len);
+
+/**
+ * Frees a table of baby steps.
+ *
+ * @param[in,out] t			- the table.
+ */
+void pc_dlog_free(pc_dlog_t t);
+
 #endif /* !RLC_PC_H */
@@ -41,10 +41,92 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Type definitions                                                           */
+/*============================================================================*/
+
+/**
+ * Represents a pairing argument with precomputed line functions. The line
+ * coefficients that depend only on the argument are stored as a sequence of
+ * prime field elements, in the order they are evaluated in the Miller loop.
+ */
+typedef struct {
+	/** The line coefficients. */
+	dig_t *c;
+	/** The number of precomputed lines, zero for the point at infinity. */
+	int n;
+} pp_prep_st;
+
+/**
+ * Pointer to a pairing argument with precomputed line functions.
+ */
+#if ALLOC == AUTO
+typedef pp_prep_st pp_prep_t[1];
+#else
+typedef pp_prep_st *pp_prep_t;
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
 
+/**
+ * Initializes a precomputed pairing argument with a null value.
+ *
+ * @param[out] A			- the precomputed argument to initialize.
+ */
+#if ALLOC == AUTO
+#define pp_prep_null(A)														\
+	{																		\
+		(A)->c = NULL;														\
+		(A)->n = 0;															\
+	}
+#else
+#define pp_prep_null(A)		RLC_NULL(A)
+#endif
+
+/**
+ * Calls a function to allocate and initialize a precomputed pairing argument.
+ *
+ * @param[out] A			- the new precomputed argument.
+ */
+#if ALLOC != AUTO
+#define pp_prep_new(A)														\
+	A = (pp_prep_t)calloc(1, sizeof(pp_prep_st));							\
+	if (A == NULL) {														\
+		RLC_THROW(ERR_NO_MEMORY);											\
+	}																		\
+
+#elif ALLOC == AUTO
+#define pp_prep_new(A)														\
+	{																		\
+		(A)->c = NULL;														\
+		(A)->n = 0;															\
+	}
+#endif
+
+/**
+ * Calls a function to clean and free a precomputed pairing argument.
+ *
+ * @param[out] A			- the precomputed argument to clean and free.
+ */
+#if ALLOC != AUTO
+#define pp_prep_free(A)														\
+	if (A != NULL) {														\
+		free((A)->c);														\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define pp_prep_free(A)														\
+	{																		\
+		free((A)->c);														\
+		(A)->c = NULL;														\
+		(A)->n = 0;															\
+	}
+#endif
+
 /**
  * Adds two points and evaluates the corresponding line function at another
  * point on an elliptic curve with embedding degree 1.
@@ -623,6 +705,22 @@
 #define pp_map_sim_k12(R, P, Q, M)	pp_map_sim_oatep_k12(R, P, Q, M)
 #endif
 
+/**
+ * Computes a multi-pairing of elliptic curve points defined on an elliptic
+ * curve of embedding degree 12, splitting the Miller loops among the available
+ * cores. Computes \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M 			- the number of pairings to evaluate.
+ */
+#if PP_MAP == OATEP
+#define pp_map_par_k12(R, P, Q, M)	pp_map_par_oatep_k12(R, P, Q, M)
+#else
+#define pp_map_par_k12(R, P, Q, M)	pp_map_sim_k12(R, P, Q, M)
+#endif
+
 /**
  * Computes a multi-pairing of elliptic curve points defined on an elliptic
  * curve of embedding degree 16. Computes \prod e(P_i, Q_i).
@@ -1616,6 +1714,48 @@ void pp_map_oatep_k12(fp12_t r, const ep_t p, const ep2_t q);
  */
 void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m);
 
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic
+ * curve with embedding degree 12, evaluating the Miller loops of disjoint
+ * blocks of pairs in parallel and sharing a single final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] q				- the first pairing arguments.
+ * @param[in] p				- the second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_par_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m);
+
+/**
+ * Precomputes the line functions of the optimal ate pairing for a fixed
+ * argument in a parameterized elliptic curve with embedding degree 12.
+ *
+ * @param[out] r			- the precomputed argument.
+ * @param[in] q				- the elliptic curve point.
+ */
+void pp_prep_k12(pp_prep_t r, const ep2_t q);
+
+/**
+ * Computes the optimal ate pairing in a parameterized elliptic curve with
+ * embedding degree 12 using a precomputed argument.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the precomputed second argument.
+ */
+void pp_map_prep_k12(fp12_t r, const ep_t p, const pp_prep_t q);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 12 using precomputed arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_prep_k12(fp12_t r, const ep_t *p, const pp_prep_t *q, int m);
+
 /**
  * Computes the Tate pairing of two points in a parameterized elliptic curve
  * with embedding degree 16.
@@ -1679,6 +1819,36 @@ void pp_map_oatep_k16(fp16_t r, const ep_t p, const ep4_t q);
  */
 void pp_map_sim_oatep_k16(fp16_t r, const ep_t *p, const ep4_t *q, int m);
 
+/**
+ * Precomputes the line functions of the optimal ate pairing for a fixed
+ * argument in a parameterized elliptic curve with embedding degree 16.
+ *
+ * @param[out] r			- the precomputed argument.
+ * @param[in] q				- the elliptic curve point.
+ */
+void pp_prep_k16(pp_prep_t r, const ep4_t q);
+
+/**
+ * Computes the optimal ate pairing in a parameterized elliptic curve with
+ * embedding degree 16 using a precomputed argument.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the precomputed second argument.
+ */
+void pp_map_prep_k16(fp16_t r, const ep_t p, const pp_prep_t q);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 16 using precomputed arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_prep_k16(fp16_t r, const ep_t *p, const pp_prep_t *q, int m);
+
 /**
  * Computes the Tate pairing of two points in a parameterized elliptic curve
  * with embedding degree 18.
@@ -1742,6 +1912,36 @@ void pp_map_oatep_k18(fp18_t r, const ep_t p, const ep3_t q);
  */
 void pp_map_sim_oatep_k18(fp18_t r, const ep_t *p, const ep3_t *q, int m);
 
+/**
+ * Precomputes the line functions of the optimal ate pairing for a fixed
+ * argument in a parameterized elliptic curve with embedding degree 18.
+ *
+ * @param[out] r			- the precomputed argument.
+ * @param[in] q				- the elliptic curve point.
+ */
+void pp_prep_k18(pp_prep_t r, const ep3_t q);
+
+/**
+ * Computes the optimal ate pairing in a parameterized elliptic curve with
+ * embedding degree 18 using a precomputed argument.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the precomputed second argument.
+ */
+void pp_map_prep_k18(fp18_t r, const ep_t p, const pp_prep_t q);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 18 using precomputed arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_prep_k18(fp18_t r, const ep_t *p, const pp_prep_t *q, int m);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 24.
@@ -1763,6 +1963,36 @@ void pp_map_k24(fp24_t r, const ep_t p, const ep4_t q);
  */
 void pp_map_sim_k24(fp24_t r, const ep_t *p, const ep4_t *q, int m);
 
+/**
+ * Precomputes the line functions of the optimal ate pairing for a fixed
+ * argument in a parameterized elliptic curve with embedding degree 24.
+ *
+ * @param[out] r			- the precomputed argument.
+ * @param[in] q				- the elliptic curve point.
+ */
+void pp_prep_k24(pp_prep_t r, const ep4_t q);
+
+/**
+ * Computes the optimal ate pairing in a parameterized elliptic curve with
+ * embedding degree 24 using a precomputed argument.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the precomputed second argument.
+ */
+void pp_map_prep_k24(fp24_t r, const ep_t p, const pp_prep_t q);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 24 using precomputed arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_prep_k24(fp24_t r, const ep_t *p, const pp_prep_t *q, int m);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 48.
@@ -35,6 +35,10 @@
 #include "relic_arch.h"
 #include "relic_core.h"
 
+#if ARITH == X64_DISPATCH && defined(WITH_FP)
+#include "relic_fp_low.h"
+#endif
+
 #include "lzcnt.inc"
 #include "tzcnt.inc"
 
@@ -43,6 +47,25 @@
  */
 #define asm					__asm__ volatile
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Queries the processor for a leaf of identification information.
+ *
+ * @param[out] r			- the EAX, EBX, ECX and EDX registers.
+ * @param[in] leaf			- the leaf to query.
+ * @param[in] sub			- the subleaf to query.
+ */
+static void arch_cpuid(uint32_t r[4], uint32_t leaf, uint32_t sub) {
+	asm (
+		"cpuid"
+		: "=a" (r[0]), "=b" (r[1]), "=c" (r[2]), "=d" (r[3])
+		: "a" (leaf), "c" (sub)
+	);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -54,6 +77,33 @@ void arch_init(void) {
 			(has_lzcnt_hard() ? lzcnt64_hard : lzcnt64_soft);
 		core_get()->tzcnt_ptr =
 			(has_tzcnt_hard() ? tzcnt64_hard : tzcnt64_soft);
+#if ARITH == X64_DISPATCH && defined(WITH_FP)
+		uint_t isa = arch_isa();
+#if defined(FP_LOW_BMI2)
+		/* Single elements are only dispatched if there is a faster tier. */
+		ctx->fp_muln_ptr = fp_muln_low_base;
+		ctx->fp_mulm_ptr = fp_mulm_low_base;
+		ctx->fp_sqrn_ptr = fp_sqrn_low_base;
+		ctx->fp_sqrm_ptr = fp_sqrm_low_base;
+		ctx->fp_rdcn_ptr = fp_rdcn_low_base;
+		if (isa & RLC_ISA_BMI2) {
+			ctx->fp_muln_ptr = fp_muln_low_bmi2;
+			ctx->fp_mulm_ptr = fp_mulm_low_bmi2;
+			ctx->fp_sqrn_ptr = fp_sqrn_low_bmi2;
+			ctx->fp_sqrm_ptr = fp_sqrm_low_bmi2;
+			ctx->fp_rdcn_ptr = fp_rdcn_low_bmi2;
+		}
+#endif
+		if (isa & RLC_ISA_IFMA) {
+			ctx->fp_mulm_x8_ptr = fp_mulm_x8_low_ifma;
+			ctx->fp_sqrm_x8_ptr = fp_sqrm_x8_low_ifma;
+			ctx->fp_expm_x8_ptr = fp_expm_x8_low_ifma;
+		} else {
+			ctx->fp_mulm_x8_ptr = fp_mulm_x8_low_base;
+			ctx->fp_sqrm_x8_ptr = fp_sqrm_x8_low_base;
+			ctx->fp_expm_x8_ptr = fp_expm_x8_low_base;
+		}
+#endif
 	}
 }
 
@@ -99,6 +149,11 @@ ull_t arch_cycles(void) {
 
 		result += offset;
 		result &= RLC_MASK(48); /* Get lower 48 bits only. */
+	} else {
+		uint32_t hi, lo;
+		/* Use the time-stamp counter if perf is not available. */
+		asm ("rdtsc" : "=a" (lo), "=d" (hi));
+		result = ((ull_t) lo) | (((ull_t) hi) << 32);
 	}
 	return result;
 }
@@ -111,3 +166,30 @@ uint_t arch_lzcnt(dig_t x) {
 uint_t arch_tzcnt(dig_t x) {
 	return core_get()->tzcnt_ptr(x);
 }
+
+uint_t arch_isa(void) {
+	uint32_t r[4], lo, hi;
+	uint_t isa = 0;
+	int os;
+
+	arch_cpuid(r, 0, 0);
+	if (r[0] < 7) {
+		return isa;
+	}
+	/* Check if the operating system saves the AVX-512 register state. */
+	arch_cpuid(r, 1, 0);
+	os = (r[2] >> 27) & 1;
+	if (os) {
+		asm ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+		os = ((lo & 0xE6) == 0xE6);
+	}
+
+	arch_cpuid(r, 7, 0);
+	if (((r[1] >> 8) & 1) && ((r[1] >> 19) & 1)) {
+		isa |= RLC_ISA_BMI2;
+	}
+	if (os && ((r[1] >> 16) & 1) && ((r[1] >> 21) & 1)) {
+		isa |= RLC_ISA_IFMA;
+	}
+	return isa;
+}
@@ -33,18 +33,22 @@
 #include "relic_bn.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-void bn_lag(bn_t *c, const bn_t *a, const bn_t b, size_t n) {
+/**
+ * Computes the coefficients of the polynomial with the given roots by
+ * multiplying the linear factors one at a time.
+ *
+ * @param[out] c			- the coefficients of the polynomial.
+ * @param[in] a				- the set of roots.
+ * @param[in] b				- the modulus.
+ * @param[in] n				- the number of roots to interpolate.
+ */
+static void lag_basic(bn_t *c, const bn_t *a, const bn_t b, size_t n) {
     int i, j;
 	bn_t *t = RLC_ALLOCA(bn_t, n + 1);
 
-    if (n == 0) {
-        bn_zero(c[0]);
-        return;
-    }
-
 	RLC_TRY {
 		if (t == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
@@ -84,11 +88,47 @@ void bn_lag(bn_t *c, const bn_t *a, const bn_t b, size_t n) {
 	}
 }
 
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void bn_lag(bn_t *c, const bn_t *a, const bn_t b, size_t n) {
+	bn_pol_t p;
+	dig_t *t = NULL;
+
+	if (n == 0) {
+		bn_zero(c[0]);
+		return;
+	}
+
+	if (n < RLC_BN_POL || bn_is_even(b) || b->used > RLC_BN_DIGS) {
+		lag_basic(c, a, b, n);
+		return;
+	}
+
+	RLC_TRY {
+		bn_pol_pre(p, b);
+		t = (dig_t *)calloc((2 * n + 1) * p->w, sizeof(dig_t));
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		} else {
+			bn_pol_set(t, a, n, p);
+			bn_pol_lag(t + n * p->w, t, n, p);
+			bn_pol_get(c, t + n * p->w, n + 1, p);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		free(t);
+	}
+}
+
 void bn_evl(bn_t c, const bn_t *a, const bn_t x, const bn_t b, size_t n) {
     bn_zero(c);
     for (int j = n - 1; j >= 0; j--) {
         bn_mul(c, c, x);
-        bn_mod(c, c, b);
         bn_add(c, c, a[j]);
         bn_mod(c, c, b);
     }
@@ -0,0 +1,900 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2024 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of polynomial arithmetic modulo an odd integer.
+ *
+ * @ingroup bn
+ */
+
+#include "relic_core.h"
+#include "relic_bn_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum number of levels in a product tree.
+ */
+#define POL_LEVELS		(8 * sizeof(size_t) + 1)
+
+/**
+ * Number of small integers tried when searching for a quadratic non-residue.
+ */
+#define POL_TRIES		64
+
+/**
+ * Returns the address of the i-th coefficient of a polynomial.
+ */
+#define POL(A, I, P)	((A) + (I) * (P)->w)
+
+/**
+ * Allocates space for n coefficients, returning NULL on failure.
+ *
+ * @param[in] n				- the number of coefficients.
+ * @param[in] p				- the precomputed constants.
+ * @return the allocated space.
+ */
+static dig_t *pol_new(size_t n, const bn_pol_t p) {
+	return (dig_t *)calloc(RLC_MAX(n, 1) * p->w, sizeof(dig_t));
+}
+
+/**
+ * Adds two coefficients.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first coefficient.
+ * @param[in] b				- the second coefficient.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_add(dig_t *c, const dig_t *a, const dig_t *b,
+		const bn_pol_t p) {
+	if (bn_addn_low(c, a, b, p->w) ||
+			bn_cmpn_low(c, p->w, p->m, p->w) != RLC_LT) {
+		bn_subn_low(c, c, p->m, p->w);
+	}
+}
+
+/**
+ * Subtracts two coefficients.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first coefficient.
+ * @param[in] b				- the second coefficient.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_sub(dig_t *c, const dig_t *a, const dig_t *b,
+		const bn_pol_t p) {
+	if (bn_subn_low(c, a, b, p->w)) {
+		bn_addn_low(c, c, p->m, p->w);
+	}
+}
+
+/**
+ * Multiplies two coefficients in Montgomery form.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first coefficient.
+ * @param[in] b				- the second coefficient.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_mul(dig_t *c, const dig_t *a, const dig_t *b,
+		const bn_pol_t p) {
+	rlc_align dig_t t[2 * RLC_BN_DIGS], r[2 * RLC_BN_DIGS];
+
+	bn_muln_low(t, a, b, p->w);
+	/* Some backends use the whole input length of the result as scratch. */
+	bn_modn_low(r, t, 2 * p->w, p->m, p->w, p->u);
+	if (bn_cmpn_low(r, p->w, p->m, p->w) != RLC_LT) {
+		bn_subn_low(r, r, p->m, p->w);
+	}
+	dv_copy(c, r, p->w);
+}
+
+/**
+ * Halves a coefficient.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the coefficient to halve.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_hlv(dig_t *c, const dig_t *a, const bn_pol_t p) {
+	dig_t carry = 0;
+
+	if (a[0] & 1) {
+		carry = bn_addn_low(c, a, p->m, p->w);
+	} else {
+		dv_copy(c, a, p->w);
+	}
+	bn_rsh1_low(c, c, p->w);
+	c[p->w - 1] |= carry << (RLC_DIG - 1);
+}
+
+/**
+ * Imports a multiple precision integer into a coefficient, without
+ * converting it to Montgomery form.
+ *
+ * @param[out] c			- the coefficient.
+ * @param[in] a				- the integer to import.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_read(dig_t *c, const bn_t a, const bn_pol_t p) {
+	bn_t m, t;
+
+	bn_null(m);
+	bn_null(t);
+
+	RLC_TRY {
+		if (bn_sign(a) == RLC_POS && a->used <= p->w &&
+				bn_cmpn_low(a->dp, a->used, p->m, p->w) == RLC_LT) {
+			dv_zero(c, p->w);
+			dv_copy(c, a->dp, a->used);
+		} else {
+			bn_new(m);
+			bn_new(t);
+			bn_read_raw(m, p->m, p->w);
+			bn_mod(t, a, m);
+			bn_write_raw(c, p->w, t);
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(m);
+		bn_free(t);
+	}
+}
+
+/**
+ * Inverts a coefficient in Montgomery form.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the coefficient to invert.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_inv(dig_t *c, const dig_t *a, const bn_pol_t p) {
+	dig_t t[RLC_BN_DIGS] = { 1 };
+	bn_t m, v;
+
+	bn_null(m);
+	bn_null(v);
+
+	RLC_TRY {
+		bn_new(m);
+		bn_new(v);
+		pol_mul(t, a, t, p);
+		bn_read_raw(m, p->m, p->w);
+		bn_read_raw(v, t, p->w);
+		if (bn_is_zero(v)) {
+			RLC_THROW(ERR_NO_VALID);
+		} else {
+			bn_mod_inv(v, v, m);
+			bn_write_raw(t, p->w, v);
+			pol_mul(c, t, p->r2, p);
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(m);
+		bn_free(v);
+	}
+}
+
+/**
+ * Multiplies two polynomials with the schoolbook method.
+ *
+ * @param[out] c			- the result, not overlapping the inputs.
+ * @param[in] a				- the first polynomial.
+ * @param[in] na			- the number of coefficients of the first polynomial.
+ * @param[in] b				- the second polynomial.
+ * @param[in] nb			- the number of coefficients of the second polynomial.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_mul_basic(dig_t *c, const dig_t *a, size_t na, const dig_t *b,
+		size_t nb, const bn_pol_t p) {
+	dig_t t[RLC_BN_DIGS];
+
+	memset(c, 0, (na + nb - 1) * p->w * sizeof(dig_t));
+	for (size_t i = 0; i < na; i++) {
+		for (size_t j = 0; j < nb; j++) {
+			pol_mul(t, POL(a, i, p), POL(b, j, p), p);
+			pol_add(POL(c, i + j, p), POL(c, i + j, p), t, p);
+		}
+	}
+}
+
+/**
+ * Computes the transform of a vector in place with a precomputed table of
+ * twiddle factors, producing outputs in natural order.
+ *
+ * @param[in,out] a			- the vector.
+ * @param[in] n				- the length of the vector.
+ * @param[in] w				- the n/2 first powers of an n-th root of unity.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_ntt(dig_t *a, size_t n, const dig_t *w, const bn_pol_t p) {
+	dig_t u[RLC_BN_DIGS], v[RLC_BN_DIGS];
+	size_t i, j, k, l;
+
+	for (i = 1, j = 0; i < n; i++) {
+		for (k = n >> 1; j & k; k >>= 1) {
+			j ^= k;
+		}
+		j ^= k;
+		if (i < j) {
+			dv_swap_sec(POL(a, i, p), POL(a, j, p), p->w, 1);
+		}
+	}
+
+	for (l = 1; l < n; l <<= 1) {
+		for (i = 0; i < n; i += 2 * l) {
+			for (j = 0; j < l; j++) {
+				dig_t *x = POL(a, i + j, p), *y = POL(a, i + j + l, p);
+				pol_mul(v, y, POL(w, j * (n / (2 * l)), p), p);
+				dv_copy(u, x, p->w);
+				pol_add(x, u, v, p);
+				pol_sub(y, u, v, p);
+			}
+		}
+	}
+}
+
+/**
+ * Computes the inverse transform of a vector in place with the table of
+ * twiddle factors used by the forward transform.
+ *
+ * @param[in,out] a			- the vector.
+ * @param[in] n				- the length of the vector.
+ * @param[in] w				- the n/2 first powers of an n-th root of unity.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_itt(dig_t *a, size_t n, const dig_t *w, const bn_pol_t p) {
+	dig_t t[RLC_BN_DIGS];
+	size_t i;
+
+	/* Transforming with the inverse root is the same as transforming with
+	 * the root and reversing the last n - 1 outputs. */
+	pol_ntt(a, n, w, p);
+	for (i = 1; i < n - i; i++) {
+		dv_swap_sec(POL(a, i, p), POL(a, n - i, p), p->w, 1);
+	}
+
+	dv_copy(t, p->one, p->w);
+	for (i = 1; i < n; i <<= 1) {
+		pol_hlv(t, t, p);
+	}
+	for (i = 0; i < n; i++) {
+		pol_mul(POL(a, i, p), POL(a, i, p), t, p);
+	}
+}
+
+/**
+ * Computes the first n/2 powers of an n-th root of unity derived from the
+ * principal (2^s)-th root of unity.
+ *
+ * @param[out] w			- the powers.
+ * @param[in] n				- the order of the root.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_roots(dig_t *w, size_t n, const bn_pol_t p) {
+	dig_t t[RLC_BN_DIGS];
+
+	dv_copy(t, p->root, p->w);
+	for (size_t i = n; i < ((size_t)1 << p->s); i <<= 1) {
+		pol_mul(t, t, t, p);
+	}
+	dv_copy(w, p->one, p->w);
+	for (size_t i = 1; i < n / 2; i++) {
+		pol_mul(POL(w, i, p), POL(w, i - 1, p), t, p);
+	}
+}
+
+/**
+ * Checks if a transform length is supported by the modulus.
+ *
+ * @param[in] n				- the length.
+ * @param[in] p				- the precomputed constants.
+ * @return a boolean value indicating if the length is supported.
+ */
+static int pol_len(size_t n, const bn_pol_t p) {
+	if (n == 0 || (n & (n - 1)) != 0) {
+		return 0;
+	}
+	return (n <= ((size_t)1 << p->s));
+}
+
+/**
+ * Computes the inverse of a polynomial with constant coefficient one modulo
+ * x^k with Newton iteration.
+ *
+ * @param[out] h			- the k coefficients of the inverse.
+ * @param[in] g				- the polynomial to invert.
+ * @param[in] ng			- the number of coefficients of the polynomial.
+ * @param[in] k				- the precision of the inverse.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_srs(dig_t *h, const dig_t *g, size_t ng, size_t k,
+		const bn_pol_t p) {
+	dig_t z[RLC_BN_DIGS] = { 0 }, *e = pol_new(2 * k, p);
+	dig_t *f = pol_new(2 * k, p);
+	size_t i, l, t;
+
+	if (e == NULL || f == NULL) {
+		free(e);
+		free(f);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	memset(h, 0, k * p->w * sizeof(dig_t));
+	dv_copy(h, p->one, p->w);
+	for (l = 1; l < k; l = t) {
+		t = RLC_MIN(2 * l, k);
+		/* Compute e = 2 - g * h mod x^t. */
+		memset(e, 0, t * p->w * sizeof(dig_t));
+		bn_pol_mul(e, g, RLC_MIN(ng, t), h, l, p);
+		for (i = 0; i < t; i++) {
+			pol_sub(POL(e, i, p), z, POL(e, i, p), p);
+		}
+		pol_add(e, e, p->one, p);
+		pol_add(e, e, p->one, p);
+		/* Compute h = h * e mod x^t. */
+		bn_pol_mul(f, h, l, e, t, p);
+		dv_copy(h, f, t * p->w);
+	}
+
+	free(e);
+	free(f);
+}
+
+
+/**
+ * Multiplies two monic polynomials. Writing a = a' + x^na and b = b' + x^nb,
+ * only the product a' * b' is computed in full, which keeps transforms at
+ * half the length needed for a generic product of the same degree.
+ *
+ * @param[out] c			- the na + nb + 1 coefficients of the result.
+ * @param[in] a				- the first polynomial.
+ * @param[in] na			- the degree of the first polynomial.
+ * @param[in] b				- the second polynomial.
+ * @param[in] nb			- the degree of the second polynomial.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_mon(dig_t *c, const dig_t *a, size_t na, const dig_t *b,
+		size_t nb, const bn_pol_t p) {
+	size_t i;
+
+	bn_pol_mul(c, a, na, b, nb, p);
+	dv_zero(POL(c, na + nb - 1, p), p->w);
+	for (i = 0; i < nb; i++) {
+		pol_add(POL(c, na + i, p), POL(c, na + i, p), POL(b, i, p), p);
+	}
+	for (i = 0; i < na; i++) {
+		pol_add(POL(c, nb + i, p), POL(c, nb + i, p), POL(a, i, p), p);
+	}
+	dv_copy(POL(c, na + nb, p), p->one, p->w);
+}
+
+/**
+ * Returns the number of points covered by a node of a product tree.
+ *
+ * @param[in] j				- the index of the node.
+ * @param[in] l				- the level of the node.
+ * @param[in] n				- the number of points.
+ * @return the number of points.
+ */
+static size_t pol_cnt(size_t j, size_t l, size_t n) {
+	return RLC_MIN((size_t)1 << l, n - (j << l));
+}
+
+/**
+ * Builds a product tree, where node j at level l is the product of the
+ * linear factors for points j * 2^l to (j + 1) * 2^l - 1 and is stored at
+ * offset j * (2^l + 1) in the buffer of the level.
+ *
+ * @param[out] t			- the levels of the tree.
+ * @param[in] x				- the points.
+ * @param[in] n				- the number of points.
+ * @param[in] keep			- the flag to keep all levels instead of the root.
+ * @param[in] p				- the precomputed constants.
+ * @return the level of the root, or POL_LEVELS on failure.
+ */
+static size_t pol_tree(dig_t **t, const dig_t *x, size_t n, int keep,
+		const bn_pol_t p) {
+	size_t i, j, l, s, cl, cr;
+
+	t[0] = pol_new(2 * n, p);
+	if (t[0] == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return POL_LEVELS;
+	}
+	for (i = 0; i < n; i++) {
+		dv_zero(POL(t[0], 2 * i, p), p->w);
+		pol_sub(POL(t[0], 2 * i, p), POL(t[0], 2 * i, p), POL(x, i, p), p);
+		dv_copy(POL(t[0], 2 * i + 1, p), p->one, p->w);
+	}
+
+	for (l = 0; ((size_t)1 << l) < n; l++) {
+		s = (size_t)1 << l;
+		j = (n + 2 * s - 1) / (2 * s);
+		t[l + 1] = pol_new(j * (2 * s + 1), p);
+		if (t[l + 1] == NULL) {
+			for (i = (keep ? 0 : l); i <= l; i++) {
+				free(t[i]);
+			}
+			RLC_THROW(ERR_NO_MEMORY);
+			return POL_LEVELS;
+		}
+		for (i = 0; i < j; i++) {
+			cl = pol_cnt(2 * i, l, n);
+			if ((2 * i + 1) * s < n) {
+				cr = pol_cnt(2 * i + 1, l, n);
+				pol_mon(POL(t[l + 1], i * (2 * s + 1), p),
+						POL(t[l], 2 * i * (s + 1), p), cl,
+						POL(t[l], (2 * i + 1) * (s + 1), p), cr, p);
+			} else {
+				dv_copy(POL(t[l + 1], i * (2 * s + 1), p),
+						POL(t[l], 2 * i * (s + 1), p), (cl + 1) * p->w);
+			}
+		}
+		if (!keep) {
+			free(t[l]);
+			t[l] = NULL;
+		}
+	}
+	return l;
+}
+
+/**
+ * Evaluates a polynomial on the points of a product tree.
+ *
+ * @param[out] c			- the evaluations.
+ * @param[in] a				- the polynomial.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] t				- the levels of the product tree.
+ * @param[in] d				- the level of the root.
+ * @param[in] x				- the points.
+ * @param[in] m				- the number of points.
+ * @param[in] p				- the precomputed constants.
+ */
+static void pol_down(dig_t *c, const dig_t *a, size_t n, dig_t **t, size_t d,
+		const dig_t *x, size_t m, const bn_pol_t p) {
+	dig_t *r = pol_new(m, p), *s = pol_new(m, p), *u;
+	size_t i, j, k, l, cnt;
+
+	if (r == NULL || s == NULL) {
+		free(r);
+		free(s);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	/* Remainders at level l are stored at offset j * 2^l. */
+	bn_pol_div(NULL, r, a, n, t[d], m + 1, p);
+	for (l = d; l > 0 && ((size_t)1 << l) > RLC_BN_POL; l--) {
+		for (j = 0; (j << (l - 1)) < m; j++) {
+			cnt = pol_cnt(j, l - 1, m);
+			bn_pol_div(NULL, POL(s, j << (l - 1), p),
+					POL(r, (j >> 1) << l, p), pol_cnt(j >> 1, l, m),
+					POL(t[l - 1], j * (((size_t)1 << (l - 1)) + 1), p),
+					cnt + 1, p);
+		}
+		u = r;
+		r = s;
+		s = u;
+	}
+
+	for (j = 0; (j << l) < m; j++) {
+		cnt = pol_cnt(j, l, m);
+		for (i = j << l; i < (j << l) + cnt; i++) {
+			dv_zero(POL(c, i, p), p->w);
+			for (k = cnt; k > 0; k--) {
+				pol_mul(POL(c, i, p), POL(c, i, p), POL(x, i, p), p);
+				pol_add(POL(c, i, p), POL(c, i, p), POL(r, (j << l) + k - 1, p),
+						p);
+			}
+		}
+	}
+
+	free(r);
+	free(s);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void bn_pol_pre(bn_pol_t p, const bn_t m) {
+	bn_t e, g, t;
+	size_t i;
+
+	if (bn_is_even(m) || bn_sign(m) != RLC_POS || bn_cmp_dig(m, 3) == RLC_LT ||
+			m->used > RLC_BN_DIGS) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_null(e);
+	bn_null(g);
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(e);
+		bn_new(g);
+		bn_new(t);
+
+		memset(p, 0, sizeof(bn_pol_st));
+		p->w = m->used;
+		dv_copy(p->m, m->dp, p->w);
+		bn_mod_pre_monty(t, m);
+		p->u = t->dp[0];
+
+		/* Compute R mod m and R^2 mod m by repeated doubling. */
+		p->one[0] = 1;
+		for (i = 0; i < p->w * RLC_DIG; i++) {
+			pol_add(p->one, p->one, p->one, p);
+		}
+		dv_copy(p->r2, p->one, p->w);
+		for (i = 0; i < p->w * RLC_DIG; i++) {
+			pol_add(p->r2, p->r2, p->r2, p);
+		}
+
+		/* Find a quadratic non-residue g, so that g^((m - 1)/2^s) has order
+		 * 2^s if m is prime. Requiring g^((m - 1)/2) = -1 makes the root
+		 * principal for any odd modulus. */
+		bn_sub_dig(e, m, 1);
+		for (p->s = 0; !bn_get_bit(e, p->s); p->s++);
+		bn_hlv(e, e);
+		for (i = 2; i < POL_TRIES; i++) {
+			bn_set_dig(g, i);
+			bn_mxp(t, g, e, m);
+			bn_add_dig(t, t, 1);
+			if (bn_cmp(t, m) == RLC_EQ) {
+				break;
+			}
+		}
+		if (i == POL_TRIES) {
+			p->s = 0;
+		} else {
+			bn_sub_dig(e, m, 1);
+			bn_rsh(e, e, p->s);
+			bn_mxp(t, g, e, m);
+			bn_write_raw(p->root, p->w, t);
+			pol_mul(p->root, p->root, p->r2, p);
+			for (; p->s > POL_LEVELS - 3; p->s--) {
+				pol_mul(p->root, p->root, p->root, p);
+			}
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(e);
+		bn_free(g);
+		bn_free(t);
+	}
+}
+
+void bn_pol_set(dig_t *c, const bn_t *a, size_t n, const bn_pol_t p) {
+	for (size_t i = 0; i < n; i++) {
+		pol_read(POL(c, i, p), a[i], p);
+		pol_mul(POL(c, i, p), POL(c, i, p), p->r2, p);
+	}
+}
+
+void bn_pol_get(bn_t *c, const dig_t *a, size_t n, const bn_pol_t p) {
+	dig_t t[RLC_BN_DIGS];
+
+	for (size_t i = 0; i < n; i++) {
+		dv_zero(t, p->w);
+		t[0] = 1;
+		pol_mul(t, POL(a, i, p), t, p);
+		bn_read_raw(c[i], t, p->w);
+	}
+}
+
+void bn_pol_ntt(dig_t *a, size_t n, const bn_pol_t p) {
+	dig_t *w;
+
+	if (!pol_len(n, p)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	w = pol_new(n / 2, p);
+	if (w == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+	pol_roots(w, n, p);
+	pol_ntt(a, n, w, p);
+	free(w);
+}
+
+void bn_pol_itt(dig_t *a, size_t n, const bn_pol_t p) {
+	dig_t *w;
+
+	if (!pol_len(n, p)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	w = pol_new(n / 2, p);
+	if (w == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+	pol_roots(w, n, p);
+	pol_itt(a, n, w, p);
+	free(w);
+}
+
+void bn_pol_mul(dig_t *c, const dig_t *a, size_t na, const dig_t *b, size_t nb,
+		const bn_pol_t p) {
+	dig_t *t, *u, *w;
+	size_t i, n;
+
+	if (na == 0 || nb == 0) {
+		return;
+	}
+
+	for (n = 1; n < na + nb - 1; n <<= 1);
+
+	if (RLC_MIN(na, nb) < RLC_BN_POL || !pol_len(n, p)) {
+		t = pol_new(na + nb - 1, p);
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+			return;
+		}
+		pol_mul_basic(t, a, na, b, nb, p);
+		dv_copy(c, t, (na + nb - 1) * p->w);
+		free(t);
+		return;
+	}
+
+	t = pol_new(n, p);
+	u = pol_new(n, p);
+	w = pol_new(n / 2, p);
+	if (t == NULL || u == NULL || w == NULL) {
+		free(t);
+		free(u);
+		free(w);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	dv_copy(t, a, na * p->w);
+	dv_copy(u, b, nb * p->w);
+	pol_roots(w, n, p);
+	pol_ntt(t, n, w, p);
+	pol_ntt(u, n, w, p);
+	for (i = 0; i < n; i++) {
+		pol_mul(POL(t, i, p), POL(t, i, p), POL(u, i, p), p);
+	}
+	pol_itt(t, n, w, p);
+	dv_copy(c, t, (na + nb - 1) * p->w);
+
+	free(t);
+	free(u);
+	free(w);
+}
+
+void bn_pol_div(dig_t *q, dig_t *r, const dig_t *f, size_t nf, const dig_t *g,
+		size_t ng, const bn_pol_t p) {
+	dig_t t[RLC_BN_DIGS], *u, *v, *h;
+	size_t i, j, k;
+
+	if (nf < ng) {
+		if (r != NULL) {
+			memset(r, 0, (ng - 1) * p->w * sizeof(dig_t));
+			dv_copy(r, f, nf * p->w);
+		}
+		return;
+	}
+
+	k = nf - ng + 1;
+	if (k < RLC_BN_POL || ng < RLC_BN_POL) {
+		/* Schoolbook long division by a monic polynomial. */
+		u = pol_new(nf, p);
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+			return;
+		}
+		dv_copy(u, f, nf * p->w);
+		for (i = nf - 1; i >= ng - 1; i--) {
+			for (j = 0; j < ng - 1; j++) {
+				pol_mul(t, POL(u, i, p), POL(g, j, p), p);
+				pol_sub(POL(u, i - ng + 1 + j, p), POL(u, i - ng + 1 + j, p),
+						t, p);
+			}
+			if (i == 0) {
+				break;
+			}
+		}
+		if (q != NULL) {
+			dv_copy(q, POL(u, ng - 1, p), k * p->w);
+		}
+		if (r != NULL) {
+			dv_copy(r, u, (ng - 1) * p->w);
+		}
+		free(u);
+		return;
+	}
+
+	/* Compute the quotient from the reversed polynomials and a power series
+	 * inverse, then the remainder r = f - q * g. */
+	u = pol_new(nf + ng, p);
+	v = pol_new(2 * k, p);
+	h = pol_new(k, p);
+	if (u == NULL || v == NULL || h == NULL) {
+		free(u);
+		free(v);
+		free(h);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (i = 0; i < ng; i++) {
+		dv_copy(POL(u, i, p), POL(g, ng - 1 - i, p), p->w);
+	}
+	pol_srs(h, u, RLC_MIN(ng, k), k, p);
+	for (i = 0; i < k; i++) {
+		dv_copy(POL(u, i, p), POL(f, nf - 1 - i, p), p->w);
+	}
+	bn_pol_mul(v, u, k, h, k, p);
+	for (i = 0; i < k; i++) {
+		dv_copy(POL(h, i, p), POL(v, k - 1 - i, p), p->w);
+	}
+	if (q != NULL) {
+		dv_copy(q, h, k * p->w);
+	}
+	if (r != NULL) {
+		bn_pol_mul(u, h, k, g, ng - 1, p);
+		for (i = 0; i < ng - 1; i++) {
+			pol_sub(POL(r, i, p), POL(f, i, p), POL(u, i, p), p);
+		}
+	}
+
+	free(u);
+	free(v);
+	free(h);
+}
+
+void bn_pol_lag(dig_t *c, const dig_t *a, size_t n, const bn_pol_t p) {
+	dig_t *t[POL_LEVELS];
+	size_t d;
+
+	if (n == 0) {
+		dv_copy(c, p->one, p->w);
+		return;
+	}
+
+	d = pol_tree(t, a, n, 0, p);
+	if (d < POL_LEVELS) {
+		dv_copy(c, t[d], (n + 1) * p->w);
+		free(t[d]);
+	}
+}
+
+void bn_pol_evl(dig_t *c, const dig_t *a, size_t n, const dig_t *x, size_t m,
+		const bn_pol_t p) {
+	dig_t *t[POL_LEVELS];
+	size_t i, d;
+
+	if (m == 0) {
+		return;
+	}
+
+	if (m <= RLC_BN_POL || n <= RLC_BN_POL) {
+		/* Use Horner's rule on each point. */
+		for (i = 0; i < m; i++) {
+			dv_zero(POL(c, i, p), p->w);
+			for (size_t k = n; k > 0; k--) {
+				pol_mul(POL(c, i, p), POL(c, i, p), POL(x, i, p), p);
+				pol_add(POL(c, i, p), POL(c, i, p), POL(a, k - 1, p), p);
+			}
+		}
+		return;
+	}
+
+	d = pol_tree(t, x, m, 1, p);
+	if (d < POL_LEVELS) {
+		pol_down(c, a, n, t, d, x, m, p);
+		for (i = 0; i <= d; i++) {
+			free(t[i]);
+		}
+	}
+}
+
+void bn_pol_itp(dig_t *c, const dig_t *x, const dig_t *y, size_t n,
+		const bn_pol_t p) {
+	dig_t k[RLC_BN_DIGS], *t[POL_LEVELS], *u, *v, *r;
+	size_t i, j, l, d, s, cl, cr;
+
+	if (n == 0) {
+		return;
+	}
+
+	d = pol_tree(t, x, n, 1, p);
+	if (d == POL_LEVELS) {
+		return;
+	}
+
+	u = pol_new(n + 1, p);
+	v = pol_new(n + 1, p);
+	r = pol_new(n + 1, p);
+	if (u == NULL || v == NULL || r == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+	} else {
+		/* Evaluate the derivative of the root on the points. */
+		dv_copy(k, p->one, p->w);
+		for (i = 0; i < n; i++) {
+			pol_mul(POL(u, i, p), POL(t[d], i + 1, p), k, p);
+			pol_add(k, k, p->one, p);
+		}
+		pol_down(v, u, n, t, d, x, n, p);
+
+		/* Compute the weights y_i / M'(x_i) with a single inversion. */
+		dv_copy(u, v, p->w);
+		for (i = 1; i < n; i++) {
+			pol_mul(POL(u, i, p), POL(u, i - 1, p), POL(v, i, p), p);
+		}
+		pol_inv(k, POL(u, n - 1, p), p);
+		for (i = n - 1; i > 0; i--) {
+			pol_mul(POL(r, i, p), k, POL(u, i - 1, p), p);
+			pol_mul(k, k, POL(v, i, p), p);
+		}
+		dv_copy(r, k, p->w);
+		for (i = 0; i < n; i++) {
+			pol_mul(POL(r, i, p), POL(r, i, p), POL(y, i, p), p);
+		}
+
+		/* Combine up the tree, with node j at level l stored at j * 2^l. */
+		for (l = 0; l < d; l++) {
+			s = (size_t)1 << l;
+			for (j = 0; (2 * j) * s < n; j++) {
+				cl = pol_cnt(2 * j, l, n);
+				if ((2 * j + 1) * s < n) {
+					cr = pol_cnt(2 * j + 1, l, n);
+					bn_pol_mul(u, POL(r, 2 * j * s, p), cl,
+							POL(t[l], (2 * j + 1) * (s + 1), p), cr + 1, p);
+					bn_pol_mul(v, POL(r, (2 * j + 1) * s, p), cr,
+							POL(t[l], 2 * j * (s + 1), p), cl + 1, p);
+					for (i = 0; i < cl + cr; i++) {
+						pol_add(POL(r, 2 * j * s + i, p), POL(u, i, p),
+								POL(v, i, p), p);
+					}
+				}
+			}
+		}
+		dv_copy(c, r, n * p->w);
+	}
+
+	for (i = 0; i <= d; i++) {
+		free(t[i]);
+	}
+	free(u);
+	free(v);
+	free(r);
+}
@@ -116,21 +116,19 @@ int cp_bgn_enc1(g1_t out[2], const dig_t in, const bgn_t pub) {
 
 int cp_bgn_dec1(dig_t *out, const g1_t in[2], const bgn_t prv) {
 	bn_t r, n;
-	g1_t s, t, u;
-	int i, result = RLC_ERR;
+	g1_t s, t;
+	int result = RLC_ERR;
 
 	bn_null(n);
 	bn_null(r);
 	g1_null(s);
 	g1_null(t);
-	g1_null(u);
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(r);
 		g1_new(s);
 		g1_new(t);
-		g1_new(u);
 
 		pc_get_ord(n);
 		/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
@@ -142,22 +140,9 @@ int cp_bgn_dec1(dig_t *out, const g1_t in[2], const bgn_t prv) {
 		bn_sub(r, r, prv->z);
 		bn_mod(r, r, n);
 		g1_mul_gen(s, r);
-		g1_copy(u, s);
-
-		if (g1_is_infty(t) == 1){
-			*out = 0;
-			result = RLC_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (g1_cmp(t, u) == RLC_EQ) {
-					*out = i + 1;
-					result = RLC_OK;
-					break;
-				}
-				g1_add(u, u, s);
-				g1_norm(u, u);
-			}
-		}
+
+		/* Find m in O(sqrt(m)) instead of trying every value. */
+		result = g1_dlog(out, t, s, NULL, (dig_t)INT_MAX + 1);
 	} RLC_CATCH_ANY {
 		result = RLC_ERR;
 	}
@@ -166,7 +151,6 @@ int cp_bgn_dec1(dig_t *out, const g1_t in[2], const bgn_t prv) {
 		bn_free(r);
 		g1_free(s);
 		g1_free(t);
-		g1_free(u);
 	}
 
 	return result;
@@ -215,21 +199,19 @@ int cp_bgn_enc2(g2_t out[2], const dig_t in, const bgn_t pub) {
 
 int cp_bgn_dec2(dig_t *out, const g2_t in[2], const bgn_t prv) {
 	bn_t r, n;
-	g2_t s, t, u;
-	int i, result = RLC_ERR;
+	g2_t s, t;
+	int result = RLC_ERR;
 
 	bn_null(n);
 	bn_null(r);
 	g2_null(s);
 	g2_null(t);
-	g2_null(u);
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(r);
 		g2_new(s);
 		g2_new(t);
-		g2_new(u);
 
 		pc_get_ord(n);
 		/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
@@ -241,22 +223,9 @@ int cp_bgn_dec2(dig_t *out, const g2_t in[2], const bgn_t prv) {
 		bn_sub(r, r, prv->z);
 		bn_mod(r, r, n);
 		g2_mul_gen(s, r);
-		g2_copy(u, s);
-
-		if (g2_is_infty(t) == 1) {
-			*out = 0;
-			result = RLC_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (g2_cmp(t, u) == RLC_EQ) {
-					*out = i + 1;
-					result = RLC_OK;
-					break;
-				}
-				g2_add(u, u, s);
-				g2_norm(u, u);
-			}
-		}
+
+		/* Find m in O(sqrt(m)) instead of trying every value. */
+		result = g2_dlog(out, t, s, NULL, (dig_t)INT_MAX + 1);
 	} RLC_CATCH_ANY {
 		result = RLC_ERR;
 	}
@@ -265,7 +234,6 @@ int cp_bgn_dec2(dig_t *out, const g2_t in[2], const bgn_t prv) {
 		bn_free(r);
 		g2_free(s);
 		g2_free(t);
-		g2_free(u);
 	}
 
 	return result;
@@ -339,21 +307,8 @@ int cp_bgn_dec(dig_t *out, const gt_t in[4], const bgn_t prv) {
 		pc_map(t[1], g, h);
 		gt_exp(t[1], t[1], r);
 
-		gt_copy(t[2], t[1]);
-
-		if (gt_is_unity(t[3]) == 1) {
-			*out = 0;
-			result = RLC_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (gt_cmp(t[2], t[3]) == RLC_EQ) {
-					*out = i + 1;
-					result = RLC_OK;
-					break;
-				}
-				gt_mul(t[2], t[2], t[1]);
-			}
-		}
+		/* Find m in O(sqrt(m)) instead of trying every value. */
+		result = gt_dlog(out, t[3], t[1], NULL, (dig_t)INT_MAX + 1);
 	} RLC_CATCH_ANY {
 		result = RLC_ERR;
 	} RLC_FINALLY {
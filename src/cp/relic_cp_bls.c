@@ -31,6 +31,98 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in bits of the random scalars used in batch verification.
+ */
+#define RAND_BITS		64
+
+/**
+ * Checks a contiguous range of a batch of signatures with a single
+ * multi-pairing. Signature i is stored randomized in p[i + 1] and its public
+ * key in r[i + 1], while slots p[lo] and r[lo] are borrowed temporarily to
+ * hold the combined signature and the negated generator.
+ *
+ * @param[in,out] p			- the randomized message hashes.
+ * @param[in,out] r			- the public keys.
+ * @param[in] s				- the signatures.
+ * @param[in] k				- the random scalars.
+ * @param[in] lo			- the first signature in the range.
+ * @param[in] n				- the number of signatures in the range.
+ * @return a boolean value indicating if the range is valid.
+ */
+static int bls_chk(g1_t *p, g2_t *r, const g1_t *s, const bn_t *k, size_t lo,
+		size_t n) {
+	g1_t u;
+	g2_t v;
+	gt_t e;
+	int result = 0;
+
+	g1_null(u);
+	g2_null(v);
+	gt_null(e);
+
+	RLC_TRY {
+		g1_new(u);
+		g2_new(v);
+		gt_new(e);
+
+		g1_copy(u, p[lo]);
+		g2_copy(v, r[lo]);
+		g1_mul_sim_lot(p[lo], s + lo, k + lo, n);
+		g2_get_gen(r[lo]);
+		g2_neg(r[lo], r[lo]);
+		pc_map_par(e, p + lo, r + lo, n + 1);
+		g1_copy(p[lo], u);
+		g2_copy(r[lo], v);
+		result = gt_is_unity(e);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g1_free(u);
+		g2_free(v);
+		gt_free(e);
+	}
+	return result;
+}
+
+/**
+ * Bisects a range of signatures known to be invalid as a whole, flagging the
+ * invalid signatures.
+ *
+ * @param[out] b			- the flags for each signature.
+ * @param[in,out] p			- the randomized message hashes.
+ * @param[in,out] r			- the public keys.
+ * @param[in] s				- the signatures.
+ * @param[in] k				- the random scalars.
+ * @param[in] lo			- the first signature in the range.
+ * @param[in] n				- the number of signatures in the range.
+ */
+static void bls_bis(int *b, g1_t *p, g2_t *r, const g1_t *s, const bn_t *k,
+		size_t lo, size_t n) {
+	size_t h = n / 2;
+
+	if (n == 1) {
+		b[lo] = 0;
+		return;
+	}
+
+	if (bls_chk(p, r, s, k, lo, h)) {
+		/* The product over the full range fails, so the right half must. */
+		bls_bis(b, p, r, s, k, lo + h, n - h);
+	} else {
+		bls_bis(b, p, r, s, k, lo, h);
+		if (!bls_chk(p, r, s, k, lo + h, n - h)) {
+			bls_bis(b, p, r, s, k, lo + h, n - h);
+		}
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -214,4 +306,84 @@ int cp_bls_agg_ver(const g1_t s, const uint8_t **m, const size_t *l,
 		RLC_FREE(r);
 	}
 	return result;
-}
\ No newline at end of file
+}
+
+int cp_bls_batch_ver(int *b, const g1_t s[], const uint8_t **m,
+		const size_t *l, size_t size, const g2_t q[]) {
+	g1_t *p = RLC_ALLOCA(g1_t, size + 1);
+	g2_t *r = RLC_ALLOCA(g2_t, size + 1);
+	bn_t *k = RLC_ALLOCA(bn_t, size);
+	int result = 1;
+
+	RLC_TRY {
+		if (p == NULL || r == NULL || k == NULL) {
+			RLC_FREE(p);
+			RLC_FREE(r);
+			RLC_FREE(k);
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		g1_null(p[0]);
+		g2_null(r[0]);
+		g1_new(p[0]);
+		g2_new(r[0]);
+		for (size_t i = 0; i < size; i++) {
+			g1_null(p[i + 1]);
+			g2_null(r[i + 1]);
+			bn_null(k[i]);
+		}
+		for (size_t i = 0; i < size; i++) {
+			g1_new(p[i + 1]);
+			g2_new(r[i + 1]);
+			bn_new(k[i]);
+		}
+
+		for (size_t i = 0; i < size; i++) {
+			if (b != NULL) {
+				b[i] = 1;
+			}
+			if (!g1_is_valid(s[i]) || !g2_is_valid(q[i])) {
+				/* Discard malformed inputs from the linear combination. */
+				if (b != NULL) {
+					b[i] = 0;
+				}
+				result = 0;
+				bn_zero(k[i]);
+				g1_set_infty(p[i + 1]);
+				g2_set_infty(r[i + 1]);
+				continue;
+			}
+			do {
+				bn_rand(k[i], RLC_POS, RAND_BITS);
+			} while (bn_is_zero(k[i]));
+			g1_map(p[i + 1], m[i], l[i]);
+			g1_mul(p[i + 1], p[i + 1], k[i]);
+			g2_copy(r[i + 1], q[i]);
+		}
+
+		if (size > 0 && !bls_chk(p, r, s, (const bn_t *)k, 0, size)) {
+			result = 0;
+			if (b != NULL) {
+				bls_bis(b, p, r, s, (const bn_t *)k, 0, size);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (p != NULL && r != NULL && k != NULL) {
+			g1_free(p[0]);
+			g2_free(r[0]);
+			for (size_t i = 0; i < size; i++) {
+				g1_free(p[i + 1]);
+				g2_free(r[i + 1]);
+				bn_free(k[i]);
+			}
+		}
+		RLC_FREE(p);
+		RLC_FREE(r);
+		RLC_FREE(k);
+	}
+	return result;
+}
@@ -31,6 +31,111 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Verifies a message signed with ECDSA, optionally using a precomputation
+ * table for the public key.
+ *
+ * @param[out] r			- the first component of the signature.
+ * @param[out] s			- the second component of the signature.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] q				- the public key.
+ * @param[in] t				- the precomputation table, or NULL.
+ * @return a boolean value indicating if the signature is valid.
+ */
+static int cp_ecdsa_ver_imp(const bn_t r, const bn_t s, const uint8_t *msg,
+		size_t len, int hash, const ec_t q, const ec_t *t) {
+	bn_t n, k, e, v;
+	ec_t p, w;
+	uint8_t h[RLC_MD_LEN];
+	int cmp, result = 0;
+
+	bn_null(n);
+	bn_null(k);
+	bn_null(e);
+	bn_null(v);
+	ec_null(p);
+	ec_null(w);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(e);
+		bn_new(v);
+		bn_new(k);
+		ec_new(p);
+		ec_new(w);
+
+		ec_curve_get_ord(n);
+
+		if (bn_sign(r) == RLC_POS && bn_sign(s) == RLC_POS &&
+				!bn_is_zero(r) && !bn_is_zero(s) && ec_on_curve(q)) {
+			if (bn_cmp(r, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
+				bn_mod_inv(k, s, n);
+
+				if (!hash) {
+					md_map(h, msg, len);
+					msg = h;
+					len = RLC_MD_LEN;
+				}
+
+				if (8 * len > bn_bits(n)) {
+					len = RLC_CEIL(bn_bits(n), 8);
+					bn_read_bin(e, msg, len);
+					bn_rsh(e, e, 8 * len - bn_bits(n));
+				} else {
+					bn_read_bin(e, msg, len);
+				}
+
+				bn_mul(e, e, k);
+				bn_mod(e, e, n);
+				bn_mul(v, r, k);
+				bn_mod(v, v, n);
+
+				if (t == NULL) {
+					ec_mul_sim_gen(p, e, q, v);
+				} else {
+					/* Two fixed-base multiplications beat one interleaved. */
+					ec_mul_gen(p, e);
+					ec_mul_fix(w, t, v);
+					ec_add(p, p, w);
+					ec_norm(p, p);
+				}
+				ec_get_x(v, p);
+
+				bn_mod(v, v, n);
+
+				cmp = dv_equ_sec(v->dp, r->dp, RLC_MIN(v->used, r->used));
+				result = (cmp == RLC_NE ? 0 : 1);
+
+				if (v->used != r->used) {
+					result = 0;
+				}
+
+				if (ec_is_infty(p)) {
+					result = 0;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(e);
+		bn_free(v);
+		bn_free(k);
+		ec_free(p);
+		ec_free(w);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -124,77 +229,10 @@ int cp_ecdsa_sig(bn_t r, bn_t s, const uint8_t *msg, size_t len, int hash,
 
 int cp_ecdsa_ver(const bn_t r, const bn_t s, const uint8_t *msg, size_t len,
 		int hash, const ec_t q) {
-	bn_t n, k, e, v;
-	ec_t p;
-	uint8_t h[RLC_MD_LEN];
-	int cmp, result = 0;
-
-	bn_null(n);
-	bn_null(k);
-	bn_null(e);
-	bn_null(v);
-	ec_null(p);
-
-	RLC_TRY {
-		bn_new(n);
-		bn_new(e);
-		bn_new(v);
-		bn_new(k);
-		ec_new(p);
-
-		ec_curve_get_ord(n);
-
-		if (bn_sign(r) == RLC_POS && bn_sign(s) == RLC_POS &&
-				!bn_is_zero(r) && !bn_is_zero(s) && ec_on_curve(q)) {
-			if (bn_cmp(r, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
-				bn_mod_inv(k, s, n);
-
-				if (!hash) {
-					md_map(h, msg, len);
-					msg = h;
-					len = RLC_MD_LEN;
-				}
-
-				if (8 * len > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(e, msg, len);
-					bn_rsh(e, e, 8 * len - bn_bits(n));
-				} else {
-					bn_read_bin(e, msg, len);
-				}
-
-				bn_mul(e, e, k);
-				bn_mod(e, e, n);
-				bn_mul(v, r, k);
-				bn_mod(v, v, n);
-
-				ec_mul_sim_gen(p, e, q, v);
-				ec_get_x(v, p);
-
-				bn_mod(v, v, n);
-
-				cmp = dv_equ_sec(v->dp, r->dp, RLC_MIN(v->used, r->used));
-				result = (cmp == RLC_NE ? 0 : 1);
-
-				if (v->used != r->used) {
-					result = 0;
-				}
+	return cp_ecdsa_ver_imp(r, s, msg, len, hash, q, NULL);
+}
 
-				if (ec_is_infty(p)) {
-					result = 0;
-				}
-			}
-		}
-	}
-	RLC_CATCH_ANY {
-		RLC_THROW(ERR_CAUGHT);
-	}
-	RLC_FINALLY {
-		bn_free(n);
-		bn_free(e);
-		bn_free(v);
-		bn_free(k);
-		ec_free(p);
-	}
-	return result;
+int cp_ecdsa_ver_pre(const bn_t r, const bn_t s, const uint8_t *msg,
+		size_t len, int hash, const ec_pubkey_t p) {
+	return cp_ecdsa_ver_imp(r, s, msg, len, hash, p->q, (const ec_t *)p->t);
 }
@@ -0,0 +1,193 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2024 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of precomputed public keys and their cache.
+ *
+ * @ingroup cp
+ */
+
+#include "relic.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of entries in each set of the cache.
+ */
+#define ECPK_WAYS		4
+
+/**
+ * Maximum length of a serialized public key.
+ */
+#define ECPK_BYTES		(2 * RLC_FC_BYTES + 1)
+
+/**
+ * Estimated memory used by each entry of the cache.
+ */
+#if ALLOC == AUTO
+#define ECPK_COST														\
+	(sizeof(ec_pubkey_st) + ECPK_BYTES + 2 * sizeof(size_t))
+#else
+#define ECPK_COST														\
+	(sizeof(ec_pubkey_st) + ECPK_BYTES + 2 * sizeof(size_t) +			\
+	(RLC_EC_TABLE + 1) * sizeof(RLC_CAT(RLC_EC_LOWER, st)))
+#endif
+
+/**
+ * Hashes a serialized public key to select a set in the cache.
+ *
+ * @param[in] bin			- the serialized public key.
+ * @param[in] len			- the number of bytes.
+ * @return the hash value.
+ */
+static size_t ecpk_hash(const uint8_t *bin, size_t len) {
+	/* FNV-1a, as public keys are already close to uniformly distributed. */
+	uint32_t h = 0x811C9DC5;
+
+	for (size_t i = 0; i < len; i++) {
+		h = (h ^ bin[i]) * 0x01000193;
+	}
+	return h;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int cp_ecpk_pre(ec_pubkey_t p, const ec_t q) {
+	int result = RLC_OK;
+
+	if (ec_is_infty(q) || !ec_on_curve(q)) {
+		return RLC_ERR;
+	}
+
+	RLC_TRY {
+		ec_norm(p->q, q);
+		ec_mul_pre(p->t, p->q);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_ecpk_init(ec_cache_t c, size_t size) {
+	size_t n = (size / ECPK_COST) / ECPK_WAYS * ECPK_WAYS;
+	int result = RLC_OK;
+
+	memset(c, 0, sizeof(ec_cache_st));
+	if (n == 0) {
+		return RLC_ERR;
+	}
+
+	c->k = (ec_pubkey_st *)calloc(n, sizeof(ec_pubkey_st));
+	c->b = (uint8_t *)calloc(n, ECPK_BYTES);
+	c->l = (size_t *)calloc(n, sizeof(size_t));
+	c->u = (size_t *)calloc(n, sizeof(size_t));
+	if (c->k == NULL || c->b == NULL || c->l == NULL || c->u == NULL) {
+		cp_ecpk_clean(c);
+		return RLC_ERR;
+	}
+
+	RLC_TRY {
+		for (size_t i = 0; i < n; i++) {
+			ec_null(c->k[i].q);
+			ec_new(c->k[i].q);
+			for (int j = 0; j < RLC_EC_TABLE; j++) {
+				ec_null(c->k[i].t[j]);
+				ec_new(c->k[i].t[j]);
+			}
+			c->n = i + 1;
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	if (result != RLC_OK) {
+		cp_ecpk_clean(c);
+	}
+	return result;
+}
+
+void cp_ecpk_clean(ec_cache_t c) {
+	if (c->k != NULL) {
+		for (size_t i = 0; i < c->n; i++) {
+			ec_free(c->k[i].q);
+			for (int j = 0; j < RLC_EC_TABLE; j++) {
+				ec_free(c->k[i].t[j]);
+			}
+		}
+	}
+	free(c->k);
+	free(c->b);
+	free(c->l);
+	free(c->u);
+	memset(c, 0, sizeof(ec_cache_st));
+}
+
+ec_pubkey_st *cp_ecpk_get(ec_cache_t c, const uint8_t *bin, size_t len) {
+	ec_pubkey_st *result = NULL;
+	size_t i, j, k;
+
+	if (c->n == 0 || len == 0 || len > ECPK_BYTES) {
+		return NULL;
+	}
+
+	j = (ecpk_hash(bin, len) % (c->n / ECPK_WAYS)) * ECPK_WAYS;
+	c->c++;
+	for (i = j; i < j + ECPK_WAYS; i++) {
+		if (c->l[i] == len && memcmp(c->b + i * ECPK_BYTES, bin, len) == 0) {
+			c->u[i] = c->c;
+			return &c->k[i];
+		}
+	}
+
+	/* Miss, so replace the least recently used entry in the set. */
+	for (i = k = j; i < j + ECPK_WAYS; i++) {
+		if (c->u[i] < c->u[k]) {
+			k = i;
+		}
+	}
+	j = k;
+	c->l[j] = 0;
+	c->u[j] = 0;
+
+	RLC_TRY {
+		ec_read_bin(c->k[j].q, bin, len);
+		if (!RLC_THROWN && cp_ecpk_pre(&c->k[j], c->k[j].q) == RLC_OK) {
+			memcpy(c->b + j * ECPK_BYTES, bin, len);
+			c->l[j] = len;
+			c->u[j] = c->c;
+			result = &c->k[j];
+		}
+	}
+	RLC_CATCH_ANY {
+		result = NULL;
+	}
+	return result;
+}
@@ -31,6 +31,99 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Verifies a message signed with the Elliptic Curve Schnorr Signature,
+ * optionally using a precomputation table for the public key.
+ *
+ * @param[out] e			- the first component of the signature.
+ * @param[out] s			- the second component of the signature.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the public key.
+ * @param[in] t				- the precomputation table, or NULL.
+ * @return a boolean value indicating if the signature is valid.
+ */
+static int cp_ecss_ver_imp(bn_t e, bn_t s, const uint8_t *msg, size_t len,
+		const ec_t q, const ec_t *t) {
+	bn_t n, ev, rv;
+	ec_t p, w;
+	uint8_t hash[RLC_MD_LEN];
+	uint8_t *m = RLC_ALLOCA(uint8_t, len + RLC_FC_BYTES);
+	int result = 0;
+
+	bn_null(n);
+	bn_null(ev);
+	bn_null(rv);
+	ec_null(p);
+	ec_null(w);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(ev);
+		bn_new(rv);
+		ec_new(p);
+		ec_new(w);
+		if (m == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		ec_curve_get_ord(n);
+
+		if (bn_sign(e) == RLC_POS && bn_sign(s) == RLC_POS && !bn_is_zero(s)) {
+			if (bn_cmp(e, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
+				if (t == NULL) {
+					ec_mul_sim_gen(p, s, q, e);
+				} else {
+					ec_mul_gen(p, s);
+					ec_mul_fix(w, t, e);
+					ec_add(p, p, w);
+					ec_norm(p, p);
+				}
+				ec_get_x(rv, p);
+
+				bn_mod(rv, rv, n);
+
+				memcpy(m, msg, len);
+				bn_write_bin(m + len, RLC_FC_BYTES, rv);
+				md_map(hash, m, len + RLC_FC_BYTES);
+
+				if (8 * RLC_MD_LEN > bn_bits(n)) {
+					len = RLC_CEIL(bn_bits(n), 8);
+					bn_read_bin(ev, hash, len);
+					bn_rsh(ev, ev, 8 * RLC_MD_LEN - bn_bits(n));
+				} else {
+					bn_read_bin(ev, hash, RLC_MD_LEN);
+				}
+
+				bn_mod(ev, ev, n);
+
+				result = dv_equ_sec(ev->dp, e->dp, RLC_MIN(ev->used, e->used));
+				result = (result == RLC_NE ? 0 : 1);
+
+				if (ev->used != e->used) {
+					result = 0;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(ev);
+		bn_free(rv);
+		ec_free(p);
+		ec_free(w);
+		RLC_FREE(m);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -123,67 +216,10 @@ int cp_ecss_sig(bn_t e, bn_t s, const uint8_t *msg, size_t len, const bn_t d) {
 }
 
 int cp_ecss_ver(bn_t e, bn_t s, const uint8_t *msg, size_t len, const ec_t q) {
-	bn_t n, ev, rv;
-	ec_t p;
-	uint8_t hash[RLC_MD_LEN];
-	uint8_t *m = RLC_ALLOCA(uint8_t, len + RLC_FC_BYTES);
-	int result = 0;
-
-	bn_null(n);
-	bn_null(ev);
-	bn_null(rv);
-	ec_null(p);
-
-	RLC_TRY {
-		bn_new(n);
-		bn_new(ev);
-		bn_new(rv);
-		ec_new(p);
-		if (m == NULL) {
-			RLC_THROW(ERR_NO_MEMORY);
-		}
-
-		ec_curve_get_ord(n);
-
-		if (bn_sign(e) == RLC_POS && bn_sign(s) == RLC_POS && !bn_is_zero(s)) {
-			if (bn_cmp(e, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
-				ec_mul_sim_gen(p, s, q, e);
-				ec_get_x(rv, p);
-
-				bn_mod(rv, rv, n);
-
-				memcpy(m, msg, len);
-				bn_write_bin(m + len, RLC_FC_BYTES, rv);
-				md_map(hash, m, len + RLC_FC_BYTES);
-
-				if (8 * RLC_MD_LEN > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(ev, hash, len);
-					bn_rsh(ev, ev, 8 * RLC_MD_LEN - bn_bits(n));
-				} else {
-					bn_read_bin(ev, hash, RLC_MD_LEN);
-				}
-
-				bn_mod(ev, ev, n);
-
-				result = dv_equ_sec(ev->dp, e->dp, RLC_MIN(ev->used, e->used));
-				result = (result == RLC_NE ? 0 : 1);
+	return cp_ecss_ver_imp(e, s, msg, len, q, NULL);
+}
 
-				if (ev->used != e->used) {
-					result = 0;
-				}
-			}
-		}
-	}
-	RLC_CATCH_ANY {
-		RLC_THROW(ERR_CAUGHT);
-	}
-	RLC_FINALLY {
-		bn_free(n);
-		bn_free(ev);
-		bn_free(rv);
-		ec_free(p);
-		RLC_FREE(m);
-	}
-	return result;
+int cp_ecss_ver_pre(bn_t e, bn_t s, const uint8_t *msg, size_t len,
+		const ec_pubkey_t p) {
+	return cp_ecss_ver_imp(e, s, msg, len, p->q, (const ec_t *)p->t);
 }
@@ -31,10 +31,391 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Initializes the transcript of an inner product argument, binding it to the
+ * commitment, the vector length and all the generators.
+ *
+ * @param[out] s			- the transcript state.
+ * @param[in] p				- the commitment to the vectors.
+ * @param[in] g				- the generators for the first vector.
+ * @param[in] h				- the generators for the second vector.
+ * @param[in] u				- the generator for the inner product.
+ * @param[in] n				- the length of the vectors.
+ * @throw ERR_NO_MEMORY		- if there is not enough memory.
+ */
+static void cp_ipa_init(uint8_t *s, const ec_t p, const ec_t *g,
+		const ec_t *h, const ec_t u, size_t n) {
+	size_t i, w = RLC_FC_BYTES + 1, len = 8 + (2 * n + 2) * w;
+	uint8_t *bin = (uint8_t *)calloc(len, sizeof(uint8_t));
+
+	if (bin == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (i = 0; i < 8; i++) {
+		bin[i] = (uint8_t)((uint64_t)n >> (56 - 8 * i));
+	}
+	ec_write_bin(bin + 8, ec_size_bin(p, 1), p, 1);
+	ec_write_bin(bin + 8 + w, ec_size_bin(u, 1), u, 1);
+	for (i = 0; i < n; i++) {
+		ec_write_bin(bin + 8 + (i + 2) * w, ec_size_bin(g[i], 1), g[i], 1);
+		ec_write_bin(bin + 8 + (n + i + 2) * w, ec_size_bin(h[i], 1), h[i], 1);
+	}
+	md_map(s, bin, len);
+	free(bin);
+}
+
+/**
+ * Derives the challenge of a round of the inner product argument.
+ *
+ * @param[out] c			- the challenge.
+ * @param[in,out] s			- the transcript state.
+ * @param[in] l				- the left cross term.
+ * @param[in] r				- the right cross term.
+ * @param[in] n				- the order of the group.
+ */
+static void cp_ipa_chl(bn_t c, uint8_t *s, const ec_t l, const ec_t r,
+		const bn_t n) {
+	uint8_t bin[RLC_MD_LEN + 2 * (RLC_FC_BYTES + 1)] = { 0 };
+	int len;
+
+	memcpy(bin, s, RLC_MD_LEN);
+	len = ec_size_bin(l, 1);
+	ec_write_bin(bin + RLC_MD_LEN, len, l, 1);
+	len = ec_size_bin(r, 1);
+	ec_write_bin(bin + RLC_MD_LEN + RLC_FC_BYTES + 1, len, r, 1);
+	md_map(s, bin, sizeof(bin));
+	bn_read_bin(c, s, RLC_MD_LEN);
+	bn_mod(c, c, n);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-int cp_ipa_prv(ec_t *g, ec_t *h, ec_t u, bn_t *a, bn_t *b, bn_t c, size_t n) {
+/*
+ * Source: "Bulletproofs: Short Proofs for Confidential Transactions and More"
+ * Authors: Benedikt Bünz, Jonathan Bootle, Dan Boneh, Andrew Poelstra,
+ * Pieter Wuille, Greg Maxwell (2018)
+ */
+
+int cp_ipa_gen(ec_t *g, ec_t *h, ec_t u, size_t n) {
+	uint8_t msg[] = { 'R', 'E', 'L', 'I', 'C', ' ', 'I', 'P', 'A', 0, 0, 0, 0 };
+	int result = RLC_OK;
+
+	RLC_TRY {
+		/* Derive the generators by hashing, so nobody knows their relations. */
+		for (size_t i = 0; i < n; i++) {
+			msg[10] = (uint8_t)(i >> 16);
+			msg[11] = (uint8_t)(i >> 8);
+			msg[12] = (uint8_t)i;
+			msg[9] = 'G';
+			ec_map(g[i], msg, sizeof(msg));
+			msg[9] = 'H';
+			ec_map(h[i], msg, sizeof(msg));
+		}
+		msg[9] = 'U';
+		ec_map(u, msg, sizeof(msg));
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_ipa_prv(ec_t *l, ec_t *r, bn_t x, bn_t y, const ec_t p, const ec_t *g,
+		const ec_t *h, const ec_t u, const bn_t *a, const bn_t *b, size_t n) {
+	bn_t e, f, o, sg, sh, *_a, *_b, *k;
+	ec_t t, *_g, *_h, *q;
+	const ec_t *gs = g, *hs = h;
+	uint8_t s[RLC_MD_LEN];
+	int result = RLC_OK;
+	size_t i, j, m;
+
+	if (n == 0 || (n & (n - 1)) != 0) {
+		return RLC_ERR;
+	}
+
+	bn_null(e);
+	bn_null(f);
+	bn_null(o);
+	bn_null(sg);
+	bn_null(sh);
+	ec_null(t);
+	/* Vectors are kept on the heap, as they grow with n. */
+	_a = (bn_t *)calloc(n, sizeof(bn_t));
+	_b = (bn_t *)calloc(n, sizeof(bn_t));
+	k = (bn_t *)calloc(n + 1, sizeof(bn_t));
+	_g = (ec_t *)calloc(n / 2 + 1, sizeof(ec_t));
+	_h = (ec_t *)calloc(n / 2 + 1, sizeof(ec_t));
+	q = (ec_t *)calloc(n + 1, sizeof(ec_t));
+
+	RLC_TRY {
+		if (_a == NULL || _b == NULL || k == NULL || _g == NULL ||
+				_h == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(e);
+		bn_new(f);
+		bn_new(o);
+		bn_new(sg);
+		bn_new(sh);
+		ec_new(t);
+		for (i = 0; i < n; i++) {
+			bn_null(_a[i]);
+			bn_null(_b[i]);
+			bn_new(_a[i]);
+			bn_new(_b[i]);
+			bn_copy(_a[i], a[i]);
+			bn_copy(_b[i], b[i]);
+		}
+		for (i = 0; i <= n; i++) {
+			bn_null(k[i]);
+			ec_null(q[i]);
+			bn_new(k[i]);
+			ec_new(q[i]);
+		}
+		for (i = 0; i <= n / 2; i++) {
+			ec_null(_g[i]);
+			ec_null(_h[i]);
+			ec_new(_g[i]);
+			ec_new(_h[i]);
+		}
+
+		ec_curve_get_ord(o);
+		cp_ipa_init(s, p, g, h, u, n);
+
+		/* The folded generators are kept as sg * g' and sh * h', so that
+		 * folding takes one point multiplication instead of two. */
+		bn_set_dig(sg, 1);
+		bn_set_dig(sh, 1);
+		for (j = 0, m = n / 2; m > 0; j++, m >>= 1) {
+			/* L = <a_lo, g_hi> + <b_hi, h_lo> + <a_lo, b_hi> * u. */
+			bn_zero(k[2 * m]);
+			for (i = 0; i < m; i++) {
+				ec_copy(q[i], gs[m + i]);
+				ec_copy(q[m + i], hs[i]);
+				bn_mul(k[i], _a[i], sg);
+				bn_mod(k[i], k[i], o);
+				bn_mul(k[m + i], _b[m + i], sh);
+				bn_mod(k[m + i], k[m + i], o);
+				bn_mul(e, _a[i], _b[m + i]);
+				bn_add(k[2 * m], k[2 * m], e);
+			}
+			bn_mod(k[2 * m], k[2 * m], o);
+			ec_copy(q[2 * m], u);
+			ec_mul_sim_lot(l[j], (const ec_t *)q, (const bn_t *)k, 2 * m + 1);
+
+			/* R = <a_hi, g_lo> + <b_lo, h_hi> + <a_hi, b_lo> * u. */
+			bn_zero(k[2 * m]);
+			for (i = 0; i < m; i++) {
+				ec_copy(q[i], gs[i]);
+				ec_copy(q[m + i], hs[m + i]);
+				bn_mul(k[i], _a[m + i], sg);
+				bn_mod(k[i], k[i], o);
+				bn_mul(k[m + i], _b[i], sh);
+				bn_mod(k[m + i], k[m + i], o);
+				bn_mul(e, _a[m + i], _b[i]);
+				bn_add(k[2 * m], k[2 * m], e);
+			}
+			bn_mod(k[2 * m], k[2 * m], o);
+			ec_mul_sim_lot(r[j], (const ec_t *)q, (const bn_t *)k, 2 * m + 1);
+
+			cp_ipa_chl(e, s, l[j], r[j], o);
+			bn_mod_inv(f, e, o);
+
+			/* Fold the vectors in half. */
+			for (i = 0; i < m; i++) {
+				bn_mul(_a[i], _a[i], e);
+				bn_mul(k[0], _a[m + i], f);
+				bn_add(_a[i], _a[i], k[0]);
+				bn_mod(_a[i], _a[i], o);
+				bn_mul(_b[i], _b[i], f);
+				bn_mul(k[0], _b[m + i], e);
+				bn_add(_b[i], _b[i], k[0]);
+				bn_mod(_b[i], _b[i], o);
+			}
+			if (m == 1) {
+				break;
+			}
+
+			/* g' = f * g_lo + e * g_hi = (f * sg) * (G_lo + e^2 * G_hi) and
+			 * h' = e * h_lo + f * h_hi = (e * sh) * (H_lo + f^2 * H_hi). */
+			bn_mul(sg, sg, f);
+			bn_mod(sg, sg, o);
+			bn_mul(sh, sh, e);
+			bn_mod(sh, sh, o);
+			bn_sqr(e, e);
+			bn_mod(e, e, o);
+			bn_sqr(f, f);
+			bn_mod(f, f, o);
+			for (i = 0; i < m; i++) {
+				ec_mul(t, gs[m + i], e);
+				ec_add(_g[i], t, gs[i]);
+				ec_mul(t, hs[m + i], f);
+				ec_add(_h[i], t, hs[i]);
+			}
+			ec_norm_sim(_g, (const ec_t *)_g, m);
+			ec_norm_sim(_h, (const ec_t *)_h, m);
+			gs = (const ec_t *)_g;
+			hs = (const ec_t *)_h;
+		}
+		bn_copy(x, _a[0]);
+		bn_copy(y, _b[0]);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		bn_free(f);
+		bn_free(o);
+		bn_free(sg);
+		bn_free(sh);
+		ec_free(t);
+		for (i = 0; _a != NULL && _b != NULL && i < n; i++) {
+			bn_free(_a[i]);
+			bn_free(_b[i]);
+		}
+		for (i = 0; k != NULL && q != NULL && i <= n; i++) {
+			bn_free(k[i]);
+			ec_free(q[i]);
+		}
+		for (i = 0; _g != NULL && _h != NULL && i <= n / 2; i++) {
+			ec_free(_g[i]);
+			ec_free(_h[i]);
+		}
+		free((void *)_a);
+		free((void *)_b);
+		free((void *)k);
+		free((void *)_g);
+		free((void *)_h);
+		free((void *)q);
+	}
+	return result;
+}
+
+int cp_ipa_ver(const ec_t p, const ec_t *l, const ec_t *r, const bn_t x,
+		const bn_t y, const ec_t *g, const ec_t *h, const ec_t u, size_t n) {
+	bn_t o, *e, *f, *k;
+	ec_t t, *q;
+	uint8_t s[RLC_MD_LEN];
+	size_t i, j, c = 0, m;
+	int result = 0;
+
+	if (n == 0 || (n & (n - 1)) != 0) {
+		return 0;
+	}
+	while (((size_t)1 << c) < n) {
+		c++;
+	}
+	m = 2 * n + 2 * c + 2;
+
+	bn_null(o);
+	ec_null(t);
+	e = (bn_t *)calloc(c + 1, sizeof(bn_t));
+	f = (bn_t *)calloc(c + 1, sizeof(bn_t));
+	k = (bn_t *)calloc(m, sizeof(bn_t));
+	q = (ec_t *)calloc(m, sizeof(ec_t));
+
+	RLC_TRY {
+		if (e == NULL || f == NULL || k == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(o);
+		ec_new(t);
+		for (j = 0; j <= c; j++) {
+			bn_null(e[j]);
+			bn_null(f[j]);
+			bn_new(e[j]);
+			bn_new(f[j]);
+		}
+		for (i = 0; i < m; i++) {
+			bn_null(k[i]);
+			ec_null(q[i]);
+			bn_new(k[i]);
+			ec_new(q[i]);
+		}
+
+		/* Replay the transcript to recover the challenges. */
+		ec_curve_get_ord(o);
+		cp_ipa_init(s, p, g, h, u, n);
+		for (j = 0; j < c; j++) {
+			cp_ipa_chl(e[j], s, l[j], r[j], o);
+			if (bn_is_zero(e[j])) {
+				RLC_THROW(ERR_NO_VALID);
+			}
+		}
+		if (c > 0) {
+			bn_mod_inv_sim(f, (const bn_t *)e, o, c);
+		}
+
+		/* Compute s_i = prod_j e_j^(+-1), so that g' = <s, g> and h' = <1/s, h>,
+		 * with s_i obtained from a previous entry by one multiplication. */
+		bn_set_dig(k[0], 1);
+		for (j = 0; j < c; j++) {
+			bn_mul(k[0], k[0], f[j]);
+			bn_mod(k[0], k[0], o);
+			bn_sqr(e[j], e[j]);
+			bn_mod(e[j], e[j], o);
+			bn_sqr(f[j], f[j]);
+			bn_mod(f[j], f[j], o);
+		}
+		for (i = 1; i < n; i++) {
+			j = util_bits_dig(i) - 1;
+			bn_mul(k[i], k[i - ((size_t)1 << j)], e[c - 1 - j]);
+			bn_mod(k[i], k[i], o);
+		}
+		/* The inverse of s_i is s_(n - 1 - i), so fill both halves at once. */
+		for (i = 0; i < n; i++) {
+			bn_mul(k[n + i], k[n - 1 - i], y);
+			bn_mod(k[n + i], k[n + i], o);
+		}
+		for (i = 0; i < n; i++) {
+			bn_mul(k[i], k[i], x);
+			bn_mod(k[i], k[i], o);
+			ec_copy(q[i], g[i]);
+			ec_copy(q[n + i], h[i]);
+		}
 
-}
\ No newline at end of file
+		/* Check that x * g' + y * h' + xy * u - sum(e^2 L + e^-2 R) - P = 0. */
+		bn_mul(k[2 * n], x, y);
+		bn_mod(k[2 * n], k[2 * n], o);
+		ec_copy(q[2 * n], u);
+		for (j = 0; j < c; j++) {
+			bn_sub(k[2 * n + 1 + j], o, e[j]);
+			ec_copy(q[2 * n + 1 + j], l[j]);
+			bn_sub(k[2 * n + 1 + c + j], o, f[j]);
+			ec_copy(q[2 * n + 1 + c + j], r[j]);
+		}
+		bn_sub_dig(k[m - 1], o, 1);
+		ec_copy(q[m - 1], p);
+		ec_mul_sim_lot(t, (const ec_t *)q, (const bn_t *)k, m);
+		result = ec_is_infty(t);
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+	}
+	RLC_FINALLY {
+		bn_free(o);
+		ec_free(t);
+		for (j = 0; e != NULL && f != NULL && j <= c; j++) {
+			bn_free(e[j]);
+			bn_free(f[j]);
+		}
+		for (i = 0; k != NULL && q != NULL && i < m; i++) {
+			bn_free(k[i]);
+			ec_free(q[i]);
+		}
+		free((void *)e);
+		free((void *)f);
+		free((void *)k);
+		free((void *)q);
+	}
+	return result;
+}
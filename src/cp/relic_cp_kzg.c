@@ -0,0 +1,569 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2024 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the KZG polynomial commitment scheme.
+ *
+ * @ingroup cp
+ */
+
+#include "relic.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Allocates and initializes a vector of multiple precision integers.
+ *
+ * @param[in] n				- the length of the vector.
+ * @return the vector, or NULL if no memory is available.
+ */
+static bn_t *cp_kzg_new(size_t n) {
+	bn_t *a = (bn_t *)calloc(RLC_MAX(n, 1), sizeof(bn_t));
+
+	if (a != NULL) {
+		for (size_t i = 0; i < n; i++) {
+			bn_null(a[i]);
+			bn_new(a[i]);
+		}
+	}
+	return a;
+}
+
+/**
+ * Frees a vector of multiple precision integers.
+ *
+ * @param[in] a				- the vector.
+ * @param[in] n				- the length of the vector.
+ */
+static void cp_kzg_free(bn_t *a, size_t n) {
+	if (a != NULL) {
+		for (size_t i = 0; i < n; i++) {
+			bn_free(a[i]);
+		}
+		free((void *)a);
+	}
+}
+
+/**
+ * Opens a polynomial at k points, computing the quotient by the vanishing
+ * polynomial of the points and the evaluations.
+ *
+ * @param[out] pi			- the proof.
+ * @param[out] v			- the evaluations, in Montgomery form.
+ * @param[in] a				- the coefficients of the polynomial.
+ * @param[in] n				- the number of coefficients.
+ * @param[in] z				- the points, in Montgomery form.
+ * @param[in] k				- the number of points.
+ * @param[in] s				- the powers of the secret in G_1.
+ * @param[in] p				- the precomputed constants for the group order.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int cp_kzg_open(g1_t pi, dig_t *v, const bn_t *a, size_t n,
+		const dig_t *z, size_t k, const g1_t *s, const bn_pol_t p) {
+	dig_t *f, *g, *r;
+	bn_t *q = NULL;
+	int result = RLC_OK;
+
+	f = (dig_t *)calloc((2 * n + 2 * k + 2) * p->w, sizeof(dig_t));
+	if (f == NULL) {
+		return RLC_ERR;
+	}
+	g = f + n * p->w;
+	r = g + (k + 1) * p->w;
+
+	RLC_TRY {
+		bn_pol_set(f, a, n, p);
+		bn_pol_lag(g, z, k, p);
+		bn_pol_div(r + k * p->w, r, f, n, g, k + 1, p);
+		bn_pol_evl(v, r, k, z, k, p);
+		if (n <= k) {
+			g1_set_infty(pi);
+		} else {
+			q = cp_kzg_new(n - k);
+			if (q == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			} else {
+				bn_pol_get(q, r + k * p->w, n - k, p);
+				g1_mul_sim_lot(pi, s, (const bn_t *)q, n - k);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		cp_kzg_free(q, n - k);
+		free(f);
+	}
+	return result;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+/*
+ * Source: "Constant-Size Commitments to Polynomials and Their Applications"
+ * Authors: Aniket Kate, Gregory M. Zaverucha, Ian Goldberg (ASIACRYPT 2010)
+ */
+
+int cp_kzg_gen(g1_t *s, size_t n, g2_t *t, size_t m) {
+	bn_t e, q, x;
+	int result = RLC_OK;
+
+	if (m < 2) {
+		return RLC_ERR;
+	}
+
+	bn_null(e);
+	bn_null(q);
+	bn_null(x);
+
+	RLC_TRY {
+		bn_new(e);
+		bn_new(q);
+		bn_new(x);
+
+		pc_get_ord(q);
+		bn_rand_mod(x, q);
+		bn_set_dig(e, 1);
+		for (size_t i = 0; i < RLC_MAX(n, m); i++) {
+			if (i < n) {
+				g1_mul_gen(s[i], e);
+			}
+			if (i < m) {
+				g2_mul_gen(t[i], e);
+			}
+			bn_mul(e, e, x);
+			bn_mod(e, e, q);
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_zero(e);
+		bn_zero(x);
+		bn_free(e);
+		bn_free(q);
+		bn_free(x);
+	}
+	return result;
+}
+
+size_t cp_kzg_size(size_t n, size_t m) {
+	size_t size = 0;
+	g1_t g;
+	g2_t h;
+
+	g1_null(g);
+	g2_null(h);
+
+	RLC_TRY {
+		g1_new(g);
+		g2_new(h);
+		g1_get_gen(g);
+		g2_get_gen(h);
+		size = n * g1_size_bin(g, 1) + m * g2_size_bin(h, 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g1_free(g);
+		g2_free(h);
+	}
+	return size;
+}
+
+int cp_kzg_write(uint8_t *bin, size_t len, const g1_t *s, size_t n,
+		const g2_t *t, size_t m) {
+	size_t l1, l2;
+	int result = RLC_OK;
+
+	if (len != cp_kzg_size(n, m)) {
+		return RLC_ERR;
+	}
+
+	RLC_TRY {
+		l1 = cp_kzg_size(1, 0);
+		l2 = cp_kzg_size(0, 1);
+		for (size_t i = 0; i < n; i++) {
+			g1_write_bin(bin + i * l1, l1, s[i], 1);
+		}
+		for (size_t i = 0; i < m; i++) {
+			g2_write_bin(bin + n * l1 + i * l2, l2, t[i], 1);
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_kzg_read(g1_t *s, size_t n, g2_t *t, size_t m, const uint8_t *bin,
+		size_t len) {
+	size_t l1, l2;
+	int *r, result = RLC_OK;
+
+	if (len != cp_kzg_size(n, m)) {
+		return RLC_ERR;
+	}
+
+	r = (int *)calloc(RLC_MAX(RLC_MAX(n, m), 1), sizeof(int));
+	if (r == NULL) {
+		return RLC_ERR;
+	}
+
+	RLC_TRY {
+		l1 = cp_kzg_size(1, 0);
+		l2 = cp_kzg_size(0, 1);
+		for (size_t i = 0; i < n; i++) {
+			g1_read_bin(s[i], bin + i * l1, l1);
+		}
+		for (size_t i = 0; i < m; i++) {
+			g2_read_bin(t[i], bin + n * l1 + i * l2, l2);
+		}
+		/* Check subgroup membership in batches, as the string is large. */
+		g1_is_valid_batch(r, s, n);
+		for (size_t i = 0; i < n; i++) {
+			if (r[i] == 0) {
+				result = RLC_ERR;
+			}
+		}
+		g2_is_valid_batch(r, t, m);
+		for (size_t i = 0; i < m; i++) {
+			if (r[i] == 0) {
+				result = RLC_ERR;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		free(r);
+	}
+	return result;
+}
+
+int cp_kzg_com(g1_t c, const bn_t *a, size_t n, const g1_t *s) {
+	int result = RLC_OK;
+
+	RLC_TRY {
+		g1_mul_sim_lot(c, s, a, n);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_kzg_prv(g1_t pi, bn_t y, const bn_t *a, size_t n, const bn_t z,
+		const g1_t *s) {
+	dig_t u[RLC_BN_DIGS], v[RLC_BN_DIGS];
+	bn_t q, t[1];
+	bn_pol_t p;
+	int result = RLC_OK;
+
+	bn_null(q);
+	bn_null(t[0]);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(t[0]);
+		pc_get_ord(q);
+		bn_pol_pre(p, q);
+		bn_copy(t[0], z);
+		bn_pol_set(u, (const bn_t *)t, 1, p);
+		result = cp_kzg_open(pi, v, a, n, u, 1, s, p);
+		bn_pol_get(t, v, 1, p);
+		bn_copy(y, t[0]);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		bn_free(t[0]);
+	}
+	return result;
+}
+
+int cp_kzg_ver(const g1_t c, const bn_t z, const bn_t y, const g1_t pi,
+		const g2_t *t) {
+	g1_t g, u[2];
+	g2_t h[2];
+	gt_t e;
+	bn_t q, v;
+	int result = 0;
+
+	bn_null(q);
+	bn_null(v);
+	g1_null(g);
+	g1_null(u[0]);
+	g1_null(u[1]);
+	g2_null(h[0]);
+	g2_null(h[1]);
+	gt_null(e);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(v);
+		g1_new(g);
+		g1_new(u[0]);
+		g1_new(u[1]);
+		g2_new(h[0]);
+		g2_new(h[1]);
+		gt_new(e);
+
+		/* Check e(c - y * g + z * pi, h) * e(-pi, x * h) = 1, which moves
+		 * the scalar multiplications from G_2 to G_1. */
+		pc_get_ord(q);
+		bn_mod(v, y, q);
+		bn_sub(v, q, v);
+		g1_get_gen(g);
+		g1_mul_sim(u[0], g, v, pi, z);
+		g1_add(u[0], u[0], c);
+		g1_norm(u[0], u[0]);
+		g1_neg(u[1], pi);
+		g2_copy(h[0], t[0]);
+		g2_copy(h[1], t[1]);
+		pc_map_sim(e, u, h, 2);
+		result = gt_is_unity(e);
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		bn_free(v);
+		g1_free(g);
+		g1_free(u[0]);
+		g1_free(u[1]);
+		g2_free(h[0]);
+		g2_free(h[1]);
+		gt_free(e);
+	}
+	return result;
+}
+
+int cp_kzg_prv_sim(g1_t pi, bn_t *y, const bn_t *a, size_t n, const bn_t *z,
+		size_t k, const g1_t *s) {
+	dig_t *u;
+	bn_t q;
+	bn_pol_t p;
+	int result = RLC_OK;
+
+	if (k == 0) {
+		return RLC_ERR;
+	}
+
+	u = (dig_t *)calloc(2 * k * RLC_BN_DIGS, sizeof(dig_t));
+	if (u == NULL) {
+		return RLC_ERR;
+	}
+
+	bn_null(q);
+
+	RLC_TRY {
+		bn_new(q);
+		pc_get_ord(q);
+		bn_pol_pre(p, q);
+		bn_pol_set(u, z, k, p);
+		result = cp_kzg_open(pi, u + k * p->w, a, n, u, k, s, p);
+		bn_pol_get(y, u + k * p->w, k, p);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		free(u);
+	}
+	return result;
+}
+
+int cp_kzg_ver_sim(const g1_t c, const bn_t *z, const bn_t *y, size_t k,
+		const g1_t pi, const g1_t *s, const g2_t *t) {
+	dig_t *u;
+	bn_t q, *f = NULL;
+	g1_t v[2];
+	g2_t w[2];
+	gt_t e;
+	bn_pol_t p;
+	int result = 0;
+
+	if (k == 0) {
+		return 0;
+	}
+
+	u = (dig_t *)calloc((4 * k + 1) * RLC_BN_DIGS, sizeof(dig_t));
+	if (u == NULL) {
+		return 0;
+	}
+
+	bn_null(q);
+	g1_null(v[0]);
+	g1_null(v[1]);
+	g2_null(w[0]);
+	g2_null(w[1]);
+	gt_null(e);
+
+	RLC_TRY {
+		bn_new(q);
+		g1_new(v[0]);
+		g1_new(v[1]);
+		g2_new(w[0]);
+		g2_new(w[1]);
+		gt_new(e);
+		f = cp_kzg_new(k + 1);
+		if (f == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		pc_get_ord(q);
+		bn_pol_pre(p, q);
+		bn_pol_set(u, z, k, p);
+		bn_pol_set(u + k * p->w, y, k, p);
+
+		/* Commit to the interpolating polynomial in G_1. */
+		bn_pol_itp(u + 2 * k * p->w, u, u + k * p->w, k, p);
+		bn_pol_get(f, u + 2 * k * p->w, k, p);
+		g1_mul_sim_lot(v[0], s, (const bn_t *)f, k);
+		g1_sub(v[0], c, v[0]);
+		g1_norm(v[0], v[0]);
+
+		/* Commit to the vanishing polynomial in G_2. */
+		bn_pol_lag(u + 2 * k * p->w, u, k, p);
+		bn_pol_get(f, u + 2 * k * p->w, k + 1, p);
+		g2_mul_sim_lot(w[1], t, (const bn_t *)f, k + 1);
+
+		g1_neg(v[1], pi);
+		g2_copy(w[0], t[0]);
+		pc_map_sim(e, v, w, 2);
+		result = gt_is_unity(e);
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		g1_free(v[0]);
+		g1_free(v[1]);
+		g2_free(w[0]);
+		g2_free(w[1]);
+		gt_free(e);
+		cp_kzg_free(f, k + 1);
+		free(u);
+	}
+	return result;
+}
+
+int cp_kzg_ver_lot(const g1_t *c, const bn_t *z, const bn_t *y,
+		const g1_t *pi, size_t l, const g2_t *t) {
+	g1_t *g, v[2];
+	g2_t w[2];
+	gt_t e;
+	bn_t q, u, *r;
+	int result = 0;
+
+	if (l == 0) {
+		return 1;
+	}
+
+	g = (g1_t *)calloc(2 * l + 1, sizeof(g1_t));
+	r = cp_kzg_new(2 * l + 1);
+	if (g == NULL || r == NULL) {
+		free((void *)g);
+		cp_kzg_free(r, 2 * l + 1);
+		return 0;
+	}
+
+	bn_null(q);
+	bn_null(u);
+	g1_null(v[0]);
+	g1_null(v[1]);
+	g2_null(w[0]);
+	g2_null(w[1]);
+	gt_null(e);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(u);
+		g1_new(v[0]);
+		g1_new(v[1]);
+		g2_new(w[0]);
+		g2_new(w[1]);
+		gt_new(e);
+		for (size_t i = 0; i <= 2 * l; i++) {
+			g1_null(g[i]);
+			g1_new(g[i]);
+		}
+
+		/* With random r_i, check that e(v0, h) * e(-v1, x * h) = 1 for
+		 * v0 = sum r_i * (c_i - y_i * g + z_i * pi_i), v1 = sum r_i * pi_i. */
+		pc_get_ord(q);
+		bn_zero(r[2 * l]);
+		for (size_t i = 0; i < l; i++) {
+			bn_rand_mod(r[i], q);
+			bn_mul(r[l + i], r[i], z[i]);
+			bn_mod(r[l + i], r[l + i], q);
+			bn_mul(u, r[i], y[i]);
+			bn_sub(r[2 * l], r[2 * l], u);
+			bn_mod(r[2 * l], r[2 * l], q);
+			g1_copy(g[i], c[i]);
+			g1_copy(g[l + i], pi[i]);
+		}
+		g1_get_gen(g[2 * l]);
+		g1_mul_sim_lot(v[0], (const g1_t *)g, (const bn_t *)r, 2 * l + 1);
+		g1_mul_sim_lot(v[1], (const g1_t *)g + l, (const bn_t *)r, l);
+		g1_neg(v[1], v[1]);
+		g2_copy(w[0], t[0]);
+		g2_copy(w[1], t[1]);
+		pc_map_sim(e, v, w, 2);
+		result = gt_is_unity(e);
+	}
+	RLC_CATCH_ANY {
+		result = 0;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		bn_free(u);
+		g1_free(v[0]);
+		g1_free(v[1]);
+		g2_free(w[0]);
+		g2_free(w[1]);
+		gt_free(e);
+		for (size_t i = 0; i <= 2 * l; i++) {
+			g1_free(g[i]);
+		}
+		free((void *)g);
+		cp_kzg_free(r, 2 * l + 1);
+	}
+	return result;
+}
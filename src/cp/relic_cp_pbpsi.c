@@ -31,6 +31,231 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Arguments shared by the workers answering or intersecting sets in PB-PSI.
+ */
+typedef struct {
+	/** The pairing results. */
+	gt_t *t;
+	/** The missing elements in the exponent. */
+	g1_t *u;
+	/** The random exponents. */
+	const bn_t *k;
+	/** The sender's input set. */
+	const bn_t *y;
+	/** The permutation applied to the sender's input set. */
+	const uint_t *s;
+	/** The precomputation table for the secret power. */
+	const g1_t *ss;
+	/** The pairing of the generator and the receiver's interpolation. */
+	const gt_t *e;
+	/** The polynomial interpolations in the exponent. */
+	const g2_t *d;
+	/** The number of matches found by each worker for each receiver element. */
+	size_t *c;
+	/** The receiver's input set size. */
+	size_t m;
+	/** The sender's input set size. */
+	size_t n;
+	/** The flags indicating if an error occurred, one per worker. */
+	int *code;
+} pbpsi_par_t;
+
+/**
+ * Answers the part of the sender's input set assigned to a worker.
+ *
+ * @param[in,out] arg		- the arguments of the computation.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void pbpsi_ans_job(void *arg, int id, int cores) {
+	pbpsi_par_t *b = (pbpsi_par_t *)arg;
+	size_t j, lo = b->n * id / cores, hi = b->n * (id + 1) / cores;
+	bn_t q, v;
+	g1_t w;
+
+	bn_null(q);
+	bn_null(v);
+	g1_null(w);
+
+	RLC_TRY {
+		bn_new(q);
+		bn_new(v);
+		g1_new(w);
+
+		pc_get_ord(q);
+		for (j = lo; j < hi; j++) {
+			/* Compute e(g1, d)^t = e([t]g1, d) and [t]ss - [t * y]g1. */
+			gt_exp(b->t[j], *b->e, b->k[j]);
+			g1_mul_fix(b->u[j], b->ss, b->k[j]);
+			bn_mul(v, b->k[j], b->y[b->s[j]]);
+			bn_mod(v, v, q);
+			g1_mul_gen(w, v);
+			g1_sub(b->u[j], b->u[j], w);
+		}
+		if (hi > lo) {
+			g1_norm_sim(b->u + lo, (const g1_t *)b->u + lo, hi - lo);
+		}
+	}
+	RLC_CATCH_ANY {
+		b->code[id] = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		bn_free(v);
+		g1_free(w);
+	}
+}
+
+/**
+ * Matches the part of the sender's answer assigned to a worker against the
+ * receiver's input set.
+ *
+ * @param[in,out] arg		- the arguments of the computation.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void pbpsi_int_job(void *arg, int id, int cores) {
+	pbpsi_par_t *b = (pbpsi_par_t *)arg;
+	size_t j, k, lo = b->n * id / cores, hi = b->n * (id + 1) / cores;
+	size_t *c = b->c + id * b->m;
+	gt_t e;
+
+	gt_null(e);
+
+	RLC_TRY {
+		gt_new(e);
+
+		for (j = lo; j < hi; j++) {
+			for (k = 0; k < b->m; k++) {
+				pc_map(e, b->u[j], b->d[k + 1]);
+				if (gt_cmp(e, b->t[j]) == RLC_EQ && !gt_is_unity(e)) {
+					c[k]++;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		b->code[id] = RLC_ERR;
+	}
+	RLC_FINALLY {
+		gt_free(e);
+	}
+}
+
+/**
+ * Computes the sender part of the PB-PSI protocol in blocks of consecutive
+ * elements. The shuffle is applied to the whole input set, so splitting the
+ * answer in blocks does not weaken it.
+ *
+ * @param[out] t			- the pairing results of a block.
+ * @param[out] u			- the missing elements in the exponent of a block.
+ * @param[in] ss			- the secret power.
+ * @param[in] d				- the polynomial interpolations in the exponent.
+ * @param[in] y				- the server's input set.
+ * @param[in] n				- the sender's input set size.
+ * @param[in] l				- the number of elements in each block.
+ * @param[in] f				- the function receiving each block, or NULL if
+ * 							  all the answer fits in t and u.
+ * @param[in] arg			- the argument passed to the function.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int pbpsi_ans(gt_t *t, g1_t *u, const g1_t ss, const g2_t d,
+		const bn_t *y, size_t n, size_t l, void (*f)(const gt_t *,
+		const g1_t *, size_t, void *), void *arg) {
+	int i, w = RLC_MAX(1, RLC_MIN(RLC_MIN(n, l) / RLC_CP_PSI_PAR, CORES));
+	int result = RLC_OK;
+	size_t j, lo, hi;
+	/* Buffers grow with the set, so they are kept on the heap. */
+	bn_t q, *k = (bn_t *)calloc(RLC_MAX(1, RLC_MIN(n, l)), sizeof(bn_t));
+	g1_t g1, *tab = RLC_ALLOCA(g1_t, RLC_G1_TABLE);
+	gt_t e;
+	uint_t *shuffle = (uint_t *)calloc(RLC_MAX(n, 1), sizeof(uint_t));
+	int *code = (int *)calloc(w, sizeof(int));
+	pbpsi_par_t b;
+
+	bn_null(q);
+	g1_null(g1);
+	gt_null(e);
+	for (j = 0; tab != NULL && j < RLC_G1_TABLE; j++) {
+		g1_null(tab[j]);
+	}
+
+	RLC_TRY {
+		bn_new(q);
+		g1_new(g1);
+		gt_new(e);
+		if (shuffle == NULL || k == NULL || tab == NULL || code == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (j = 0; j < RLC_G1_TABLE; j++) {
+			g1_new(tab[j]);
+		}
+		for (j = 0; j < RLC_MIN(n, l); j++) {
+			bn_null(k[j]);
+			bn_new(k[j]);
+		}
+
+		util_perm(shuffle, n);
+		pc_get_ord(q);
+
+		/* Share one pairing and one table for the secret power among all. */
+		g1_get_gen(g1);
+		pc_map(e, g1, d);
+		g1_mul_pre(tab, ss);
+
+		b.ss = (const g1_t *)tab;
+		b.e = (const gt_t *)&e;
+		b.y = y;
+		b.k = (const bn_t *)k;
+		b.code = code;
+		for (lo = 0; lo < n && result == RLC_OK; lo = hi) {
+			hi = RLC_MIN(n, lo + l);
+			/* Sample randomness before spawning workers with PRNG copies. */
+			for (j = 0; j < hi - lo; j++) {
+				bn_rand_mod(k[j], q);
+			}
+			b.t = (f == NULL ? t + lo : t);
+			b.u = (f == NULL ? u + lo : u);
+			b.s = shuffle + lo;
+			b.n = hi - lo;
+			core_run(pbpsi_ans_job, &b, w);
+			/* Each worker only writes its own flag, so reduce them here. */
+			for (i = 0; i < w; i++) {
+				if (code[i] != RLC_OK) {
+					result = RLC_ERR;
+				}
+			}
+			if (f != NULL && result == RLC_OK) {
+				f((const gt_t *)t, (const g1_t *)u, hi - lo, arg);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		g1_free(g1);
+		gt_free(e);
+		for (j = 0; k != NULL && j < RLC_MIN(n, l); j++) {
+			bn_free(k[j]);
+		}
+		for (j = 0; tab != NULL && j < RLC_G1_TABLE; j++) {
+			g1_free(tab[j]);
+		}
+		free((void *)k);
+		free((void *)shuffle);
+		free((void *)code);
+		RLC_FREE(tab);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -121,70 +346,87 @@ int cp_pbpsi_ask(g2_t *d, bn_t r, const bn_t *x, const g2_t *s, size_t m) {
 
 int cp_pbpsi_ans(gt_t *t, g1_t *u, const g1_t ss, const g2_t d,
 		const bn_t *y, size_t n) {
-	int j, result = RLC_OK;
-	bn_t q, tj;
-	g1_t g1;
-	g2_t g2;
-	uint_t *shuffle = RLC_ALLOCA(uint_t, n);
+	return pbpsi_ans(t, u, ss, d, y, n, n, NULL, NULL);
+}
 
-	bn_null(q);
-	bn_null(tj);
-	g1_null(g1);
-	g2_null(g2);
+int cp_pbpsi_ans_str(const g1_t ss, const g2_t d, const bn_t *y, size_t n,
+		size_t l, void (*f)(const gt_t *t, const g1_t *u, size_t len,
+		void *arg), void *arg) {
+	int result = RLC_OK;
+	size_t j;
+	gt_t *t;
+	g1_t *u;
 
-	RLC_TRY {
-		bn_new(q);
-		bn_new(tj);
-		g1_new(g1);
-		g2_new(g2);
-		if (shuffle == NULL) {
-			RLC_THROW(ERR_NO_MEMORY);
-		}
-
-		util_perm(shuffle, n);
+	if (f == NULL) {
+		return RLC_ERR;
+	}
+	l = RLC_MAX(1, RLC_MIN(l, n));
+	t = (gt_t *)calloc(l, sizeof(gt_t));
+	u = (g1_t *)calloc(l, sizeof(g1_t));
+	if (t == NULL || u == NULL) {
+		free((void *)t);
+		free((void *)u);
+		return RLC_ERR;
+	}
 
-		pc_get_ord(q);
-		g2_get_gen(g2);
-		for (j = 0; j < n; j++) {
-			bn_rand_mod(tj, q);
-			g1_mul_gen(g1, tj);
-			pc_map(t[j], g1, d);
-			g1_mul_gen(u[j], y[shuffle[j]]);
-			g1_sub(u[j], ss, u[j]);
-			g1_mul(u[j], u[j], tj);
+	RLC_TRY {
+		for (j = 0; j < l; j++) {
+			gt_null(t[j]);
+			g1_null(u[j]);
+			gt_new(t[j]);
+			g1_new(u[j]);
 		}
+		result = pbpsi_ans(t, u, ss, d, y, n, l, f, arg);
 	}
 	RLC_CATCH_ANY {
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		bn_free(q);
-		bn_free(tj);
-		g1_free(g1);
-		g2_free(g2);
-		RLC_FREE(shuffle);
+		for (j = 0; j < l; j++) {
+			gt_free(t[j]);
+			g1_free(u[j]);
+		}
+		free((void *)t);
+		free((void *)u);
 	}
 	return result;
 }
 
 int cp_pbpsi_int(bn_t *z, size_t *len, const g2_t *d, const bn_t *x,
 		size_t m, const gt_t *t, const g1_t *u, size_t n) {
-	int j, k, result = RLC_OK;
-	gt_t e;
-
-	gt_null(e);
+	int result = RLC_OK;
+	int w = RLC_MAX(1, RLC_MIN(n / RLC_CP_PSI_PAR, CORES));
+	size_t i, k, *c = (size_t *)calloc(RLC_MAX(w * m, 1), sizeof(size_t));
+	int *code = (int *)calloc(w, sizeof(int));
+	pbpsi_par_t b;
 
 	RLC_TRY {
-		gt_new(e);
-
 		*len = 0;
 		if (m > 0) {
+			if (c == NULL || code == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+
+			b.t = (gt_t *)t;
+			b.u = (g1_t *)u;
+			b.d = d;
+			b.c = c;
+			b.m = m;
+			b.n = n;
+			b.code = code;
+			core_run(pbpsi_int_job, &b, w);
+			for (i = 0; i < w; i++) {
+				if (code[i] != RLC_OK) {
+					result = RLC_ERR;
+				}
+			}
+
 			for (k = 0; k < m; k++) {
-				for (j = 0; j < n; j++) {
-					pc_map(e, u[j], d[k + 1]);
-					if (gt_cmp(e, t[j]) == RLC_EQ && !gt_is_unity(e)) {
+				for (i = 0; i < w; i++) {
+					while (c[i * m + k] > 0) {
 						bn_copy(z[*len], x[k]);
 						(*len)++;
+						c[i * m + k]--;
 					}
 				}
 			}
@@ -194,7 +436,8 @@ int cp_pbpsi_int(bn_t *z, size_t *len, const g2_t *d, const bn_t *x,
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		gt_free(e);
+		free((void *)c);
+		free((void *)code);
 	}
 	return result;
 }
@@ -40,6 +40,182 @@
  */
 #define STAT_SEC	40
 
+/**
+ * Arguments shared by the workers answering or intersecting sets in RSA-PSI.
+ */
+typedef struct {
+	/** The accumulator results. */
+	bn_t *t;
+	/** The missing elements in the exponent. */
+	bn_t *u;
+	/** The random exponents or the receiver primes. */
+	const bn_t *p;
+	/** The sender's input set. */
+	const bn_t *y;
+	/** The permutation applied to the sender's input set. */
+	const uint_t *s;
+	/** The generator. */
+	bn_st *g;
+	/** The receiver's accumulator or random nonce. */
+	bn_st *d;
+	/** The modulus. */
+	bn_st *n;
+	/** The number of matches found by each worker for each receiver prime. */
+	size_t *c;
+	/** The receiver's input set size. */
+	size_t m;
+	/** The sender's input set size. */
+	size_t l;
+	/** The flags indicating if an error occurred, one per worker. */
+	int *code;
+} rsapsi_par_t;
+
+/**
+ * Maps an element of the input set to a prime number.
+ *
+ * @param[out] p			- the resulting prime.
+ * @param[in] x				- the element to map.
+ */
+static void rsapsi_map(bn_t p, const bn_t x) {
+	int len = RLC_CEIL(RLC_BN_BITS, 8);
+	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
+
+	bn_write_bin(bin, len, x);
+	md_map(h, bin, len);
+	bn_read_bin(p, h, 2 * STAT_SEC / 8);
+	if (bn_is_even(p)) {
+		bn_add_dig(p, p, 1);
+	}
+	do {
+		bn_add_dig(p, p, 2);
+	} while (!bn_is_prime(p));
+}
+
+/**
+ * Raises an element to the product of all primes except one, for every choice
+ * of the excluded prime. Splitting the list in halves recursively takes
+ * O(m log m) exponentiations instead of the O(m^2) of the direct approach.
+ *
+ * @param[out] e			- the resulting powers.
+ * @param[in] f				- the element to exponentiate.
+ * @param[in] p				- the primes.
+ * @param[in] m				- the number of primes.
+ * @param[in] n				- the modulus.
+ */
+static void rsapsi_rft(bn_t *e, const bn_t f, const bn_t *p, size_t m,
+		const bn_t n) {
+	size_t i, h = m / 2;
+	bn_t a;
+
+	if (m == 1) {
+		bn_copy(e[0], f);
+		return;
+	}
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+
+		/* The left half excludes its own primes, so raise to the right ones. */
+		bn_copy(a, f);
+		for (i = h; i < m; i++) {
+			bn_mxp(a, a, p[i], n);
+		}
+		rsapsi_rft(e, a, p, h, n);
+		bn_copy(a, f);
+		for (i = 0; i < h; i++) {
+			bn_mxp(a, a, p[i], n);
+		}
+		rsapsi_rft(e + h, a, p + h, m - h, n);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(a);
+	}
+}
+
+/**
+ * Answers the part of the sender's input set assigned to a worker.
+ *
+ * @param[in,out] arg		- the arguments of the computation.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void rsapsi_ans_job(void *arg, int id, int cores) {
+	rsapsi_par_t *b = (rsapsi_par_t *)arg;
+	size_t j, lo = b->l * id / cores, hi = b->l * (id + 1) / cores;
+	bn_t p;
+
+	bn_null(p);
+
+	RLC_TRY {
+		bn_new(p);
+
+		for (j = lo; j < hi; j++) {
+			/* Compute (g^p)^t with a single exponentiation by pt. */
+			rsapsi_map(p, b->y[b->s[j]]);
+			bn_mul(p, p, b->t[j]);
+			bn_mxp(b->u[j], b->g, p, b->n);
+			bn_mxp(b->t[j], b->d, b->t[j], b->n);
+		}
+	}
+	RLC_CATCH_ANY {
+		b->code[id] = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(p);
+	}
+}
+
+/**
+ * Matches the part of the sender's answer assigned to a worker against the
+ * receiver's input set.
+ *
+ * @param[in,out] arg		- the arguments of the computation.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void rsapsi_int_job(void *arg, int id, int cores) {
+	rsapsi_par_t *b = (rsapsi_par_t *)arg;
+	size_t j, k, lo = b->l * id / cores, hi = b->l * (id + 1) / cores;
+	size_t *c = b->c + id * b->m;
+	bn_t f, *e = RLC_ALLOCA(bn_t, b->m);
+
+	bn_null(f);
+
+	RLC_TRY {
+		bn_new(f);
+		if (e == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < b->m; k++) {
+			bn_null(e[k]);
+			bn_new(e[k]);
+		}
+
+		for (j = lo; j < hi; j++) {
+			bn_mxp(f, b->u[j], b->d, b->n);
+			rsapsi_rft(e, f, b->p, b->m, b->n);
+			for (k = 0; k < b->m; k++) {
+				if (bn_cmp(e[k], b->t[j]) == RLC_EQ) {
+					c[k]++;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		b->code[id] = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(f);
+		for (k = 0; e != NULL && k < b->m; k++) {
+			bn_free(e[k]);
+		}
+		RLC_FREE(e);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -79,8 +255,7 @@ int cp_rsapsi_gen(bn_t g, bn_t n, size_t bits) {
 
 int cp_rsapsi_ask(bn_t d, bn_t r, bn_t *p, const bn_t g, const bn_t n,
 		const bn_t *x, size_t m) {
-	int i, result = RLC_OK, len = RLC_CEIL(RLC_BN_BITS, 8);
-	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
+	int i, result = RLC_OK;
 
 	/* Compute R = g^r mod N. */
 	bn_rand_mod(r, n);
@@ -88,15 +263,7 @@ int cp_rsapsi_ask(bn_t d, bn_t r, bn_t *p, const bn_t g, const bn_t n,
 
 	/* Now hash all x_i and accmulate on R. */
 	for (i = 0; i < m; i++) {
-		bn_write_bin(bin, len, x[i]);
-		md_map(h, bin, len);
-		bn_read_bin(p[i], h, 2 * STAT_SEC / 8);
-		if (bn_is_even(p[i])) {
-			bn_add_dig(p[i], p[i], 1);
-		}
-		do {
-			bn_add_dig(p[i], p[i], 2);
-		} while (!bn_is_prime(p[i]));
+		rsapsi_map(p[i], x[i]);
 		bn_mxp(d, d, p[i], n);
 	}
 
@@ -105,43 +272,47 @@ int cp_rsapsi_ask(bn_t d, bn_t r, bn_t *p, const bn_t g, const bn_t n,
 
 int cp_rsapsi_ans(bn_t *t, bn_t *u, const bn_t d, const bn_t g, const bn_t n,
 		const bn_t y[], size_t l) {
-	int j, result = RLC_OK, len = RLC_CEIL(RLC_BN_BITS, 8);
-	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
-	uint_t *shuffle = RLC_ALLOCA(uint_t, l);
-	bn_t p;
-
-	bn_null(p);
+	int w = RLC_MAX(1, RLC_MIN(l / RLC_CP_PSI_PAR, CORES)), result = RLC_OK;
+	uint_t *shuffle = (uint_t *)calloc(RLC_MAX(l, 1), sizeof(uint_t));
+	int *code = (int *)calloc(w, sizeof(int));
+	rsapsi_par_t b;
+	size_t j;
 
 	RLC_TRY {
-		bn_new(p);
-		if (shuffle == NULL) {
+		if (shuffle == NULL || code == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 
 		util_perm(shuffle, l);
 
+		/* Sample randomness before spawning workers with copies of the PRNG. */
 		for (j = 0; j < l; j++) {
-			bn_write_bin(bin, len, y[shuffle[j]]);
-			md_map(h, bin, len);
-			bn_read_bin(p, h, 2 * STAT_SEC / 8);
-			if (bn_is_even(p)) {
-				bn_add_dig(p, p, 1);
-			}
-			do {
-				bn_add_dig(p, p, 2);
-			} while (!bn_is_prime(p));
-			bn_mxp(p, g, p, n);
 			bn_rand_mod(t[j], n);
-			bn_mxp(u[j], p, t[j], n);
-			bn_mxp(t[j], d, t[j], n);
+		}
+
+		b.t = t;
+		b.u = u;
+		b.y = y;
+		b.s = shuffle;
+		b.g = (bn_st *)g;
+		b.d = (bn_st *)d;
+		b.n = (bn_st *)n;
+		b.l = l;
+		b.code = code;
+		core_run(rsapsi_ans_job, &b, w);
+		/* Each worker only writes its own flag, so reduce them here. */
+		for (j = 0; j < w; j++) {
+			if (code[j] != RLC_OK) {
+				result = RLC_ERR;
+			}
 		}
 	}
 	RLC_CATCH_ANY {
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		bn_free(p);
-		RLC_FREE(shuffle);
+		free((void *)shuffle);
+		free((void *)code);
 	}
 	return result;
 }
@@ -149,30 +320,41 @@ int cp_rsapsi_ans(bn_t *t, bn_t *u, const bn_t d, const bn_t g, const bn_t n,
 int cp_rsapsi_int(bn_t *z, size_t *len, const bn_t r, const bn_t *p,
 		const bn_t n, const bn_t *x, size_t m, const bn_t *t, const bn_t *u,
 		size_t l) {
-	int i, j, k, result = RLC_OK;
-	bn_t e, f;
-
-	bn_null(e);
-	bn_null(f);
+	int i, k, result = RLC_OK;
+	int w = RLC_MAX(1, RLC_MIN(l / RLC_CP_PSI_PAR, CORES));
+	size_t *c = (size_t *)calloc(RLC_MAX(w * m, 1), sizeof(size_t));
+	int *code = (int *)calloc(w, sizeof(int));
+	rsapsi_par_t b;
 
 	RLC_TRY {
-		bn_new(e);
-		bn_new(f);
-
 		*len = 0;
 		if (m > 0) {
-			for (j = 0; j < l; j++) {
-				bn_mxp(f, u[j], r, n);
-				for (k = 0; k < m; k++) {
-					bn_copy(e, f);
-					for (i = 0; i < m; i++) {
-						if (i != k) {
-							bn_mxp(e, e, p[i], n);
-						}
-					}
-					if (bn_cmp(e, t[j]) == RLC_EQ) {
+			if (c == NULL || code == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+
+			b.t = (bn_t *)t;
+			b.u = (bn_t *)u;
+			b.p = p;
+			b.d = (bn_st *)r;
+			b.n = (bn_st *)n;
+			b.c = c;
+			b.m = m;
+			b.l = l;
+			b.code = code;
+			core_run(rsapsi_int_job, &b, w);
+			for (i = 0; i < w; i++) {
+				if (code[i] != RLC_OK) {
+					result = RLC_ERR;
+				}
+			}
+
+			for (k = 0; k < m; k++) {
+				for (i = 0; i < w; i++) {
+					while (c[i * m + k] > 0) {
 						bn_copy(z[*len], x[k]);
 						(*len)++;
+						c[i * m + k]--;
 					}
 				}
 			}
@@ -182,8 +364,8 @@ int cp_rsapsi_int(bn_t *z, size_t *len, const bn_t r, const bn_t *p,
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		bn_free(e);
-		bn_free(f);
+		free((void *)c);
+		free((void *)code);
 	}
 	return result;
 }
@@ -40,6 +40,153 @@
  */
 #define STAT_SEC	(40)
 
+/**
+ * Arguments shared by the workers answering a SHI-PSI query.
+ */
+typedef struct {
+	/** The accumulator results. */
+	bn_t *t;
+	/** The sender's input set. */
+	const bn_t *y;
+	/** The permutation applied to the sender's input set. */
+	const uint_t *s;
+	/** The blinding exponent. */
+	bn_st *u;
+	/** The receiver's accumulator. */
+	bn_st *d;
+	/** The order of the multiplicative group. */
+	bn_st *f;
+	/** The parameters given by the trusted setup. */
+	crt_st *crt;
+	/** The sender's input set size. */
+	size_t l;
+	/** The flags indicating if an error occurred, one per worker. */
+	int *code;
+} shipsi_par_t;
+
+/**
+ * Maps an element of the input set to a prime number.
+ *
+ * @param[out] p			- the resulting prime.
+ * @param[in] x				- the element to map.
+ */
+static void shipsi_map(bn_t p, const bn_t x) {
+	int len = RLC_CEIL(RLC_BN_BITS, 8);
+	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
+
+	bn_write_bin(bin, len, x);
+	md_map(h, bin, len);
+	bn_read_bin(p, h, 2 * STAT_SEC / 8);
+	if (bn_is_even(p)) {
+		bn_add_dig(p, p, 1);
+	}
+	do {
+		bn_add_dig(p, p, 2);
+	} while (!bn_is_prime(p));
+}
+
+/**
+ * Raises an element to the product of all primes except one, for every choice
+ * of the excluded prime, by recursively splitting the list of primes.
+ *
+ * @param[out] e			- the resulting powers.
+ * @param[in] f				- the element to exponentiate.
+ * @param[in] p				- the primes.
+ * @param[in] m				- the number of primes.
+ * @param[in] n				- the modulus.
+ */
+static void shipsi_rft(bn_t *e, const bn_t f, const bn_t *p, size_t m,
+		const bn_t n) {
+	size_t i, h = m / 2;
+	bn_t a;
+
+	if (m == 1) {
+		bn_copy(e[0], f);
+		return;
+	}
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+
+		/* The left half excludes its own primes, so raise to the right ones. */
+		bn_copy(a, f);
+		for (i = h; i < m; i++) {
+			bn_mxp(a, a, p[i], n);
+		}
+		shipsi_rft(e, a, p, h, n);
+		bn_copy(a, f);
+		for (i = 0; i < h; i++) {
+			bn_mxp(a, a, p[i], n);
+		}
+		shipsi_rft(e + h, a, p + h, m - h, n);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(a);
+	}
+}
+
+/**
+ * Compares two accumulator results referenced by pointers, for sorting.
+ *
+ * @param[in] a				- the first pointer.
+ * @param[in] b				- the second pointer.
+ * @return the result of the comparison.
+ */
+static int shipsi_cmp(const void *a, const void *b) {
+	return bn_cmp(*(bn_st **)a, *(bn_st **)b);
+}
+
+/**
+ * Answers the part of the sender's input set assigned to a worker.
+ *
+ * @param[in,out] arg		- the arguments of the computation.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void shipsi_ans_job(void *arg, int id, int cores) {
+	shipsi_par_t *b = (shipsi_par_t *)arg;
+	size_t j, lo = b->l * id / cores, hi = b->l * (id + 1) / cores;
+	bn_t p, q;
+
+	bn_null(p);
+	bn_null(q);
+
+	RLC_TRY {
+		bn_new(p);
+		bn_new(q);
+
+		for (j = lo; j < hi; j++) {
+			shipsi_map(p, b->y[b->s[j]]);
+#if !defined(CP_CRT)
+			bn_mod_inv(p, p, b->f);
+			bn_mul(p, p, b->u);
+			bn_mod(p, p, b->f);
+			bn_mxp(b->t[j], b->d, p, b->crt->n);
+#else
+			bn_mod_inv(q, p, b->crt->dq);
+			bn_mul(q, q, b->u);
+			bn_mod(q, q, b->crt->dq);
+
+			bn_mod_inv(p, p, b->crt->dp);
+			bn_mul(p, p, b->u);
+			bn_mod(p, p, b->crt->dp);
+
+			bn_mxp_crt(b->t[j], b->d, p, q, b->crt, 0);
+#endif /* CP_CRT */
+		}
+	}
+	RLC_CATCH_ANY {
+		b->code[id] = RLC_ERR;
+	}
+	RLC_FINALLY {
+		bn_free(p);
+		bn_free(q);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -76,8 +223,7 @@ int cp_shipsi_gen(bn_t g, crt_t crt, size_t bits) {
 
 int cp_shipsi_ask(bn_t d, bn_t r, bn_t p[], const bn_t g, const bn_t n,
 		const bn_t x[], size_t m) {
-	int i, result = RLC_OK, len = RLC_CEIL(RLC_BN_BITS, 8);
-	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
+	int i, result = RLC_OK;
 
 	/* Compute R = g^r mod N. */
 	bn_rand_mod(r, n);
@@ -85,15 +231,7 @@ int cp_shipsi_ask(bn_t d, bn_t r, bn_t p[], const bn_t g, const bn_t n,
 
 	/* Now hash all x_i and accmulate on R. */
 	for (i = 0; i < m; i++) {
-		bn_write_bin(bin, len, x[i]);
-		md_map(h, bin, len);
-		bn_read_bin(p[i], h, 2 * STAT_SEC / 8);
-		if (bn_is_even(p[i])) {
-			bn_add_dig(p[i], p[i], 1);
-		}
-		do {
-			bn_add_dig(p[i], p[i], 2);
-		} while (!bn_is_prime(p[i]));
+		shipsi_map(p[i], x[i]);
 		bn_mxp(d, d, p[i], n);
 	}
 
@@ -102,9 +240,10 @@ int cp_shipsi_ask(bn_t d, bn_t r, bn_t p[], const bn_t g, const bn_t n,
 
 int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, const bn_t g, const crt_t crt,
 		const bn_t y[], size_t n) {
-	int j, result = RLC_OK, len = RLC_CEIL(RLC_BN_BITS, 8);
-	uint8_t h[RLC_MD_LEN], bin[RLC_CEIL(RLC_BN_BITS, 8)];
-	uint_t *shuffle = RLC_ALLOCA(uint_t, n);
+	int w = RLC_MAX(1, RLC_MIN(n / RLC_CP_PSI_PAR, CORES)), result = RLC_OK;
+	uint_t *shuffle = (uint_t *)calloc(RLC_MAX(n, 1), sizeof(uint_t));
+	int *code = (int *)calloc(w, sizeof(int));
+	shipsi_par_t b;
 	bn_t p, q;
 
 	bn_null(p);
@@ -113,41 +252,31 @@ int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, const bn_t g, const crt_t crt,
 	RLC_TRY {
 		bn_new(p);
 		bn_new(q);
-		if (shuffle == NULL) {
+		if (shuffle == NULL || code == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 
 		util_perm(shuffle, n);
 
 		bn_rand_mod(u, crt->n);
-		for (j = 0; j < n; j++) {
-			bn_write_bin(bin, len, y[shuffle[j]]);
-			md_map(h, bin, len);
-			bn_read_bin(p, h, 2 * STAT_SEC / 8);
-			if (bn_is_even(p)) {
-				bn_add_dig(p, p, 1);
-			}
-			do {
-				bn_add_dig(p, p, 2);
-			} while (!bn_is_prime(p));
+		/* Compute phi(N) once instead of for every element. */
+		bn_mul(q, crt->dp, crt->dq);
 
-#if !defined(CP_CRT)
-			bn_mul(q, crt->dp, crt->dq);
-			bn_mod_inv(p, p, q);
-			bn_mul(p, p, u);
-			bn_mod(p, p, q);
-			bn_mxp(t[j], d, p, crt->n);
-#else
-			bn_mod_inv(q, p, crt->dq);
-			bn_mul(q, q, u);
-			bn_mod(q, q, crt->dq);
-
-			bn_mod_inv(p, p, crt->dp);
-			bn_mul(p, p, u);
-			bn_mod(p, p, crt->dp);
-
-			bn_mxp_crt(t[j], d, p, q, crt, 0);
-#endif /* CP_CRT */
+		b.t = t;
+		b.y = y;
+		b.s = shuffle;
+		b.u = (bn_st *)u;
+		b.d = (bn_st *)d;
+		b.f = (bn_st *)q;
+		b.crt = (crt_st *)crt;
+		b.l = n;
+		b.code = code;
+		core_run(shipsi_ans_job, &b, w);
+		/* Each worker only writes its own flag, so reduce them here. */
+		for (int i = 0; i < w; i++) {
+			if (code[i] != RLC_OK) {
+				result = RLC_ERR;
+			}
 		}
 
 #if !defined(CP_CRT)
@@ -165,7 +294,8 @@ int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, const bn_t g, const crt_t crt,
 	RLC_FINALLY {
 		bn_free(p);
 		bn_free(q);
-		RLC_FREE(shuffle);
+		free((void *)shuffle);
+		free((void *)code);
 	}
 	return result;
 }
@@ -173,31 +303,49 @@ int cp_shipsi_ans(bn_t t[], bn_t u, bn_t d, const bn_t g, const crt_t crt,
 int cp_shipsi_int(bn_t z[], size_t *len, const bn_t r, const bn_t p[],
 		const bn_t n, const bn_t x[], size_t m, const bn_t t[], const bn_t u,
 		size_t l) {
-	int i, j, k, result = RLC_OK;
-	bn_t e, f;
+	int result = RLC_OK;
+	size_t j, k, lo, hi;
+	bn_st **s = RLC_ALLOCA(bn_st *, l);
+	bn_t f, *e = RLC_ALLOCA(bn_t, m);
 
-	bn_null(e);
 	bn_null(f);
 
 	RLC_TRY {
-		bn_new(e);
 		bn_new(f);
+		if ((s == NULL && l > 0) || (e == NULL && m > 0)) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < m; k++) {
+			bn_null(e[k]);
+			bn_new(e[k]);
+		}
 
 		*len = 0;
 		if (m > 0) {
 			bn_mxp(f, u, r, n);
+			shipsi_rft(e, f, p, m, n);
+
+			/* Sort the answer to find each element with a binary search. */
+			for (j = 0; j < l; j++) {
+				s[j] = (bn_st *)t[j];
+			}
+			qsort(s, l, sizeof(bn_st *), shipsi_cmp);
+
 			for (k = 0; k < m; k++) {
-				bn_copy(e, f);
-				for (i = 0; i < m; i++) {
-					if (i != k) {
-						bn_mxp(e, e, p[i], n);
+				lo = 0;
+				hi = l;
+				while (lo < hi) {
+					j = lo + (hi - lo) / 2;
+					if (bn_cmp(s[j], e[k]) == RLC_LT) {
+						lo = j + 1;
+					} else {
+						hi = j;
 					}
 				}
-				for (j = 0; j < l; j++) {
-					if (bn_cmp(e, t[j]) == RLC_EQ) {
-						bn_copy(z[*len], x[k]);
-						(*len)++;
-					}
+				while (lo < l && bn_cmp(s[lo], e[k]) == RLC_EQ) {
+					bn_copy(z[*len], x[k]);
+					(*len)++;
+					lo++;
 				}
 			}
 		}
@@ -206,8 +354,12 @@ int cp_shipsi_int(bn_t z[], size_t *len, const bn_t r, const bn_t p[],
 		result = RLC_ERR;
 	}
 	RLC_FINALLY {
-		bn_free(e);
 		bn_free(f);
+		for (k = 0; e != NULL && k < m; k++) {
+			bn_free(e[k]);
+		}
+		RLC_FREE(e);
+		RLC_FREE(s);
 	}
 	return result;
 }
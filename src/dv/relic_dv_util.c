@@ -52,7 +52,7 @@ void dv_print(const dig_t *a, size_t digits) {
 void dv_zero(dig_t *a, size_t digits) {
 	int i;
 
-#if ALLOC != DYNAMIC
+#if ALLOC == AUTO
 	if (digits > RLC_DV_DIGS) {
 		RLC_THROW(ERR_NO_PRECI);
 		return;
@@ -67,7 +67,7 @@ void eb_curve_init(void) {
 	ctx_t *ctx = core_get();
 #ifdef EB_PRECO
 	for (int i = 0; i < RLC_EB_TABLE; i++) {
-		ctx->eb_ptr[i] = &(ctx->eb_pre[i]);
+		ctx->eb_ptr[i] = &(ctx->pre->eb_pre[i]);
 	}
 #endif
 	fb_zero(ctx->eb_g.x);
@@ -36,7 +36,7 @@ void ed_curve_init(void) {
 	ctx_t *ctx = core_get();
 #ifdef ED_PRECO
 	for (int i = 0; i < RLC_ED_TABLE; i++) {
-		ctx->ed_ptr[i] = &(ctx->ed_pre[i]);
+		ctx->ed_ptr[i] = &(ctx->pre->ed_pre[i]);
 	}
 #endif
 	ed_set_infty(&ctx->ed_g);
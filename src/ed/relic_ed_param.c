@@ -112,7 +112,7 @@ void ed_param_set(int param) {
 
 #ifdef ED_PRECO
 		for (int i = 0; i < RLC_ED_TABLE; i++) {
-			ctx->ed_ptr[i] = &(ctx->ed_pre[i]);
+			ctx->ed_ptr[i] = &(ctx->pre->ed_pre[i]);
 		}
 		ed_mul_pre((ed_t *)ed_curve_get_tab(), &ctx->ed_g);
 #endif
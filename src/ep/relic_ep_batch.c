@@ -0,0 +1,435 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of batched point arithmetic on prime elliptic curves.
+ *
+ * Points are processed in blocks of eight, with coordinates transposed into
+ * structure-of-arrays form so that every field multiplication in the formulas
+ * becomes a single call to fp_mul_x8() or fp_sqr_x8().
+ *
+ * @ingroup ep
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of points processed simultaneously, matching the batched field
+ * multiplication.
+ */
+#define LANES		8
+
+/**
+ * Number of coordinate vectors needed by the batched formulas.
+ */
+#define VECS		12
+
+#if EP_ADD == PROJC
+
+/**
+ * Adds two vectors of prime field elements lane by lane.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first vector to add.
+ * @param[in] b				- the second vector to add.
+ */
+static void ep_lanes_add(fp_t *c, fp_t *a, fp_t *b) {
+	for (int i = 0; i < LANES; i++) {
+		fp_add(c[i], a[i], b[i]);
+	}
+}
+
+/**
+ * Subtracts two vectors of prime field elements lane by lane.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the vector to subtract from.
+ * @param[in] b				- the vector to subtract.
+ */
+static void ep_lanes_sub(fp_t *c, fp_t *a, fp_t *b) {
+	for (int i = 0; i < LANES; i++) {
+		fp_sub(c[i], a[i], b[i]);
+	}
+}
+
+/**
+ * Doubles a vector of prime field elements lane by lane.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the vector to double.
+ */
+static void ep_lanes_dbl(fp_t *c, fp_t *a) {
+	for (int i = 0; i < LANES; i++) {
+		fp_dbl(c[i], a[i]);
+	}
+}
+
+/**
+ * Multiplies a vector of prime field elements by the curve coefficient b
+ * lane by lane.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the vector to multiply.
+ */
+static void ep_lanes_mul_b(fp_t *c, fp_t *a) {
+	for (int i = 0; i < LANES; i++) {
+		ep_curve_mul_b(c[i], a[i]);
+	}
+}
+
+/**
+ * Multiplies two vectors of prime field elements lane by lane.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first vector to multiply.
+ * @param[in] b				- the second vector to multiply.
+ */
+static void ep_lanes_mul(fp_t *c, fp_t *a, fp_t *b) {
+	fp_mul_x8(c, (const fp_t *)a, (const fp_t *)b);
+}
+
+/**
+ * Squares a vector of prime field elements lane by lane.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the vector to square.
+ */
+static void ep_lanes_sqr(fp_t *c, fp_t *a) {
+	fp_sqr_x8(c, (const fp_t *)a);
+}
+
+/**
+ * Transposes up to eight points into homogeneous projective coordinates in
+ * structure-of-arrays form. Unused lanes are filled with the point at infinity.
+ *
+ * @param[out] x			- the x-coordinates.
+ * @param[out] y			- the y-coordinates.
+ * @param[out] z			- the z-coordinates.
+ * @param[in] p				- the points to load.
+ * @param[in] n				- the number of points.
+ */
+static void ep_lanes_load(fp_t *x, fp_t *y, fp_t *z, const ep_t *p, int n) {
+	for (int i = 0; i < LANES; i++) {
+		if (i >= n || ep_is_infty(p[i])) {
+			/* The complete formulas take (0 : 1 : 0) as the identity. */
+			fp_zero(x[i]);
+			fp_set_dig(y[i], 1);
+			fp_zero(z[i]);
+		} else {
+			fp_copy(x[i], p[i]->x);
+			fp_copy(y[i], p[i]->y);
+			if (p[i]->coord == BASIC) {
+				fp_set_dig(z[i], 1);
+			} else {
+				fp_copy(z[i], p[i]->z);
+			}
+		}
+	}
+}
+
+/**
+ * Transposes up to eight points back from structure-of-arrays form.
+ *
+ * @param[out] r			- the points to store.
+ * @param[in] x				- the x-coordinates.
+ * @param[in] y				- the y-coordinates.
+ * @param[in] z				- the z-coordinates.
+ * @param[in] n				- the number of points.
+ */
+static void ep_lanes_store(ep_t *r, fp_t *x, fp_t *y, fp_t *z, int n) {
+	for (int i = 0; i < n; i++) {
+		if (fp_is_zero(z[i])) {
+			ep_set_infty(r[i]);
+		} else {
+			fp_copy(r[i]->x, x[i]);
+			fp_copy(r[i]->y, y[i]);
+			fp_copy(r[i]->z, z[i]);
+			r[i]->coord = PROJC;
+		}
+	}
+}
+
+/**
+ * Adds eight pairs of points represented in homogeneous projective coordinates
+ * on a prime elliptic curve with a = 0, using the complete formulas from
+ * "Complete addition formulas for prime order elliptic curves" by Renes,
+ * Costello and Batina. Each call to the field layer processes all lanes.
+ *
+ * @param[in,out] v			- the coordinate vectors.
+ */
+static void ep_add_lanes(fp_t *v) {
+	fp_t *x1 = v, *y1 = v + LANES, *z1 = v + 2 * LANES;
+	fp_t *x2 = v + 3 * LANES, *y2 = v + 4 * LANES, *z2 = v + 5 * LANES;
+	fp_t *t0 = v + 6 * LANES, *t1 = v + 7 * LANES, *t2 = v + 8 * LANES;
+	fp_t *t3 = v + 9 * LANES, *t4 = v + 10 * LANES, *t5 = v + 11 * LANES;
+
+	/* Cost of 12M + 2m_3b + 19a, with the same schedule as ep_add_projc(). */
+	ep_lanes_mul(t0, x1, x2);
+	ep_lanes_mul(t1, y1, y2);
+	ep_lanes_mul(t2, z1, z2);
+	ep_lanes_add(t3, x1, y1);
+	ep_lanes_add(t4, x2, y2);
+	ep_lanes_mul(t3, t3, t4);
+	ep_lanes_add(t4, t0, t1);
+	ep_lanes_sub(t3, t3, t4);
+	ep_lanes_add(t4, y1, z1);
+	ep_lanes_add(t5, y2, z2);
+	ep_lanes_mul(t4, t4, t5);
+	ep_lanes_add(t5, t1, t2);
+	ep_lanes_sub(t4, t4, t5);
+	ep_lanes_add(x1, x1, z1);
+	ep_lanes_add(y1, x2, z2);
+	ep_lanes_mul(x1, x1, y1);
+	ep_lanes_add(y1, t0, t2);
+	ep_lanes_sub(y1, x1, y1);
+	ep_lanes_dbl(x1, t0);
+	ep_lanes_add(t0, t0, x1);
+	ep_lanes_dbl(t5, t2);
+	ep_lanes_add(t2, t2, t5);
+	ep_lanes_mul_b(t2, t2);
+	ep_lanes_add(z1, t1, t2);
+	ep_lanes_sub(t1, t1, t2);
+	ep_lanes_dbl(t5, y1);
+	ep_lanes_add(y1, y1, t5);
+	ep_lanes_mul_b(y1, y1);
+	ep_lanes_mul(x1, t4, y1);
+	ep_lanes_mul(t2, t3, t1);
+	ep_lanes_sub(x1, t2, x1);
+	ep_lanes_mul(y1, t0, y1);
+	ep_lanes_mul(t1, t1, z1);
+	ep_lanes_add(y1, t1, y1);
+	ep_lanes_mul(t0, t0, t3);
+	ep_lanes_mul(z1, z1, t4);
+	ep_lanes_add(z1, z1, t0);
+}
+
+/**
+ * Doubles eight points represented in homogeneous projective coordinates on a
+ * prime elliptic curve with a = 0, using the complete formulas from
+ * "Complete addition formulas for prime order elliptic curves" by Renes,
+ * Costello and Batina. Each call to the field layer processes all lanes.
+ *
+ * @param[in,out] v			- the coordinate vectors.
+ */
+static void ep_dbl_lanes(fp_t *v) {
+	fp_t *x = v, *y = v + LANES, *z = v + 2 * LANES;
+	fp_t *t0 = v + 6 * LANES, *t1 = v + 7 * LANES, *t2 = v + 8 * LANES;
+	fp_t *t3 = v + 9 * LANES, *t5 = v + 11 * LANES;
+
+	/* Cost of 6M + 2S + 1m_3b + 9a, with the same schedule as ep_dbl_projc(). */
+	ep_lanes_sqr(t0, y);
+	ep_lanes_mul(t3, x, y);
+	ep_lanes_mul(t1, y, z);
+	ep_lanes_sqr(t2, z);
+	ep_lanes_dbl(t5, t2);
+	ep_lanes_add(t5, t5, t2);
+	ep_lanes_mul_b(t2, t5);
+	ep_lanes_dbl(z, t0);
+	ep_lanes_dbl(z, z);
+	ep_lanes_dbl(z, z);
+	ep_lanes_mul(x, t2, z);
+	ep_lanes_add(y, t0, t2);
+	ep_lanes_mul(z, t1, z);
+	ep_lanes_dbl(t1, t2);
+	ep_lanes_add(t2, t1, t2);
+	ep_lanes_sub(t0, t0, t2);
+	ep_lanes_mul(y, t0, y);
+	ep_lanes_add(y, x, y);
+	ep_lanes_mul(x, t0, t3);
+	ep_lanes_dbl(x, x);
+}
+
+/**
+ * Adds or doubles points in blocks of eight, transposing each block into
+ * structure-of-arrays form.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the first points to add or the points to double.
+ * @param[in] q				- the second points to add, or NULL to double.
+ * @param[in] n				- the number of points.
+ */
+static void ep_batch_imp(ep_t *r, const ep_t *p, const ep_t *q, int n) {
+	int i, m;
+	fp_t *v = RLC_ALLOCA(fp_t, VECS * LANES);
+
+	RLC_TRY {
+		if (v == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < VECS * LANES; i++) {
+			fp_null(v[i]);
+			fp_new(v[i]);
+		}
+
+		for (i = 0; i < n; i += LANES) {
+			m = RLC_MIN(LANES, n - i);
+			ep_lanes_load(v, v + LANES, v + 2 * LANES, p + i, m);
+			if (q != NULL) {
+				ep_lanes_load(v + 3 * LANES, v + 4 * LANES, v + 5 * LANES,
+						q + i, m);
+				ep_add_lanes(v);
+			} else {
+				ep_dbl_lanes(v);
+			}
+			ep_lanes_store(r + i, v, v + LANES, v + 2 * LANES, m);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (v != NULL) {
+			for (i = 0; i < VECS * LANES; i++) {
+				fp_free(v[i]);
+			}
+		}
+		RLC_FREE(v);
+	}
+}
+
+#endif /* EP_ADD == PROJC */
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void ep_add_batch(ep_t *r, const ep_t *p, const ep_t *q, int n) {
+#if EP_ADD == PROJC
+	if (ep_curve_opt_a() == RLC_ZERO) {
+		ep_batch_imp(r, p, q, n);
+		return;
+	}
+#endif
+	for (int i = 0; i < n; i++) {
+		ep_add(r[i], p[i], q[i]);
+	}
+}
+
+void ep_dbl_batch(ep_t *r, const ep_t *p, int n) {
+#if EP_ADD == PROJC
+	if (ep_curve_opt_a() == RLC_ZERO) {
+		ep_batch_imp(r, p, NULL, n);
+		return;
+	}
+#endif
+	for (int i = 0; i < n; i++) {
+		ep_dbl(r[i], p[i]);
+	}
+}
+
+void ep_norm_batch(ep_t *r, const ep_t *p, int n) {
+	int i, j, m, jacob;
+	fp_t *v = RLC_ALLOCA(fp_t, 5 * LANES), *a = RLC_ALLOCA(fp_t, n);
+	fp_t *z = v, *s = v + LANES, *c = v + 2 * LANES;
+	fp_t *x = v + 3 * LANES, *y = v + 4 * LANES;
+
+	RLC_TRY {
+		if (v == NULL || a == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 5 * LANES; i++) {
+			fp_null(v[i]);
+			fp_new(v[i]);
+		}
+		for (i = 0; i < n; i++) {
+			fp_null(a[i]);
+			fp_new(a[i]);
+			if (ep_is_infty(p[i]) || p[i]->coord == BASIC) {
+				fp_set_dig(a[i], 1);
+			} else {
+				fp_copy(a[i], p[i]->z);
+			}
+		}
+
+		/* Share a single inversion among all points. */
+		fp_inv_sim(a, (const fp_t *)a, n);
+
+		for (i = 0; i < n; i += LANES) {
+			m = RLC_MIN(LANES, n - i);
+			jacob = 0;
+			for (j = 0; j < LANES; j++) {
+				if (j < m) {
+					fp_copy(z[j], a[i + j]);
+					fp_copy(x[j], p[i + j]->x);
+					fp_copy(y[j], p[i + j]->y);
+					jacob |= (p[i + j]->coord == JACOB);
+				} else {
+					fp_zero(z[j]);
+					fp_zero(x[j]);
+					fp_zero(y[j]);
+				}
+			}
+			if (jacob) {
+				/* Select 1/z^2 and 1/z^3 for lanes in Jacobian form. */
+				fp_sqr_x8(s, (const fp_t *)z);
+				fp_mul_x8(c, (const fp_t *)s, (const fp_t *)z);
+				for (j = 0; j < m; j++) {
+					if (p[i + j]->coord == JACOB) {
+						fp_copy(z[j], s[j]);
+						fp_copy(s[j], c[j]);
+					} else {
+						fp_copy(s[j], z[j]);
+					}
+				}
+				fp_mul_x8(x, (const fp_t *)x, (const fp_t *)z);
+				fp_mul_x8(y, (const fp_t *)y, (const fp_t *)s);
+			} else {
+				fp_mul_x8(x, (const fp_t *)x, (const fp_t *)z);
+				fp_mul_x8(y, (const fp_t *)y, (const fp_t *)z);
+			}
+			for (j = 0; j < m; j++) {
+				if (ep_is_infty(p[i + j])) {
+					ep_set_infty(r[i + j]);
+				} else {
+					fp_copy(r[i + j]->x, x[j]);
+					fp_copy(r[i + j]->y, y[j]);
+					fp_set_dig(r[i + j]->z, 1);
+					r[i + j]->coord = BASIC;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (v != NULL) {
+			for (i = 0; i < 5 * LANES; i++) {
+				fp_free(v[i]);
+			}
+		}
+		if (a != NULL) {
+			for (i = 0; i < n; i++) {
+				fp_free(a[i]);
+			}
+		}
+		RLC_FREE(v);
+		RLC_FREE(a);
+	}
+}
@@ -230,7 +230,7 @@ void ep_curve_init(void) {
 	ctx_t *ctx = core_get();
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		ctx->ep_ptr[i] = &(ctx->ep_pre[i]);
+		ctx->ep_ptr[i] = &(ctx->pre->ep_pre[i]);
 	}
 #endif
 	ep_set_infty(&ctx->ep_g);
@@ -572,3 +572,33 @@ void ep_map_rnd(ep_t p, const uint8_t *uniform_bytes, size_t len) {
 	ep_map_sswum_impl(p, uniform_bytes, len, map_fn);
 #endif
 }
+
+void ep_map_batch(ep_t *p, const uint8_t *msg[], const size_t len[], int n) {
+	const size_t elm = ep_map_rnd_size();
+	uint8_t *r = RLC_ALLOCA(uint8_t, n * elm);
+
+	if (n > 0 && r == NULL) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	RLC_TRY {
+		/* Expand all messages at once, with the same tag used by ep_map(). */
+#if EP_MAP == BASIC
+		md_xmd_batch(r, elm, msg, len, n, (const uint8_t *)RLC_DSTAG,
+				strlen(RLC_DSTAG));
+#else
+		md_xmd_batch(r, elm, msg, len, n, (const uint8_t *)RLC_DSTAG,
+				sizeof(RLC_DSTAG));
+#endif
+		for (int i = 0; i < n; i++) {
+			ep_map_rnd(p[i], r + i * elm, elm);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(r);
+	}
+}
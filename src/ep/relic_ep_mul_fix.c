@@ -249,6 +249,113 @@ static void ep_mul_combs_plain(ep_t r, const ep_t *t, const bn_t k) {
 
 #endif /* EP_FIX == LWNAF */
 
+/**
+ * Size in bytes of the fixed header of a serialized precomputation table.
+ */
+#define EP_BIN_HEAD		16
+
+/**
+ * Size in bytes of a serialized field element.
+ */
+#define EP_BIN_FP		(RLC_FP_DIGS * sizeof(dig_t))
+
+/**
+ * Computes the spacing of the comb used by serialized precomputation tables.
+ *
+ * @param[in] w					- the window width.
+ * @param[in] e					- the flag indicating if the endomorphism is used.
+ * @return the spacing.
+ */
+static int ep_comb_len(int w, int e) {
+	int l;
+	bn_t n;
+
+	bn_null(n);
+
+	RLC_TRY {
+		bn_new(n);
+		ep_curve_get_ord(n);
+		l = RLC_CEIL(bn_bits(n), (e ? 2 * w : w));
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+	}
+	return l;
+}
+
+/**
+ * Reads a point from a serialized precomputation table without any
+ * conversion, as the coordinates are stored in the internal representation.
+ *
+ * @param[out] r 				- the point.
+ * @param[in] bin				- the serialized table.
+ * @param[in] i					- the index of the point, starting from one.
+ */
+static void ep_get_bin(ep_t r, const uint8_t *bin, int i) {
+	const uint8_t *p = bin + EP_BIN_HEAD + (2 * i - 1) * EP_BIN_FP;
+
+	memcpy(r->x, p, EP_BIN_FP);
+	memcpy(r->y, p + EP_BIN_FP, EP_BIN_FP);
+	memcpy(r->z, bin + EP_BIN_HEAD, EP_BIN_FP);
+	r->coord = BASIC;
+}
+
+/**
+ * Checks if a serialized precomputation table was produced for the current
+ * curve and internal field representation.
+ *
+ * @param[out] w				- the window width.
+ * @param[out] e				- the flag indicating if the endomorphism is used.
+ * @param[in] bin				- the serialized table.
+ * @param[in] len				- the number of bytes.
+ * @return a boolean value indicating if the table is valid.
+ */
+static int ep_check_bin(int *w, int *e, const uint8_t *bin, size_t len) {
+	uint32_t id, l;
+	fp_t one;
+	int result = 0;
+
+	if (len < EP_BIN_HEAD + EP_BIN_FP || bin[0] != 'R' || bin[1] != 'L' ||
+			bin[2] != 'C' || bin[3] != 1) {
+		return 0;
+	}
+	*w = bin[4];
+	*e = bin[7];
+	if (*w < 2 || *w > RLC_EP_BIN_MAX || bin[5] != sizeof(dig_t) ||
+			bin[6] != RLC_FP_DIGS || len != ep_mul_size_bin(*w)) {
+		return 0;
+	}
+#if !defined(EP_ENDOM)
+	if (*e) {
+		return 0;
+	}
+#endif
+	memcpy(&id, bin + 8, sizeof(uint32_t));
+	memcpy(&l, bin + 12, sizeof(uint32_t));
+
+	fp_null(one);
+
+	RLC_TRY {
+		fp_new(one);
+		/* The unity pins down both the prime and the Montgomery form. */
+		fp_set_dig(one, 1);
+		result = (id == (uint32_t)ep_param_get());
+		result &= (*e == (ep_curve_is_endom() != 0));
+		result &= (l == (uint32_t)ep_comb_len(*w, *e));
+		result &= (memcmp(one, bin + EP_BIN_HEAD, EP_BIN_FP) == 0);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(one);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -524,3 +631,224 @@ void ep_mul_fix_lwnaf(ep_t r, const ep_t *t, const bn_t k) {
 }
 
 #endif
+
+size_t ep_mul_size_bin(int w) {
+	if (w < 2 || w > RLC_EP_BIN_MAX) {
+		return 0;
+	}
+	return EP_BIN_HEAD + EP_BIN_FP + ((1 << w) - 1) * 2 * EP_BIN_FP;
+}
+
+void ep_mul_pre_bin(uint8_t *bin, size_t len, const ep_t p, int w) {
+	int i, j, l, e = 0;
+	uint32_t id, s;
+	ep_t *t;
+	fp_t one;
+
+	if (w < 2 || w > RLC_EP_BIN_MAX || ep_is_infty(p)) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+	if (len != ep_mul_size_bin(w)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	t = (ep_t *)calloc(1 << w, sizeof(ep_t));
+	if (t == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	fp_null(one);
+
+	RLC_TRY {
+		fp_new(one);
+		for (i = 0; i < (1 << w); i++) {
+			ep_null(t[i]);
+			ep_new(t[i]);
+		}
+
+#if defined(EP_ENDOM)
+		e = (ep_curve_is_endom() != 0);
+#endif
+		l = ep_comb_len(w, e);
+
+		/* Same table as the COMBS method, but for an arbitrary width. */
+		ep_set_infty(t[0]);
+		ep_norm(t[1], p);
+		for (j = 1; j < w; j++) {
+			ep_dbl(t[1 << j], t[1 << (j - 1)]);
+			for (i = 1; i < l; i++) {
+				ep_dbl(t[1 << j], t[1 << j]);
+			}
+			ep_norm(t[1 << j], t[1 << j]);
+			for (i = 1; i < (1 << j); i++) {
+				ep_add(t[(1 << j) + i], t[i], t[1 << j]);
+			}
+			/* Normalize in chunks to bound the scratch space. */
+			for (i = 1; i < (1 << j); i += RLC_EP_TABLE_COMBD) {
+				s = RLC_MIN(RLC_EP_TABLE_COMBD, (1 << j) - i);
+				ep_norm_sim(t + (1 << j) + i, (const ep_t *)t + (1 << j) + i,
+						s);
+			}
+		}
+
+		id = ep_param_get();
+		s = l;
+		bin[0] = 'R';
+		bin[1] = 'L';
+		bin[2] = 'C';
+		bin[3] = 1;
+		bin[4] = w;
+		bin[5] = sizeof(dig_t);
+		bin[6] = RLC_FP_DIGS;
+		bin[7] = e;
+		memcpy(bin + 8, &id, sizeof(uint32_t));
+		memcpy(bin + 12, &s, sizeof(uint32_t));
+		fp_set_dig(one, 1);
+		memcpy(bin + EP_BIN_HEAD, one, EP_BIN_FP);
+		for (i = 1; i < (1 << w); i++) {
+			uint8_t *q = bin + EP_BIN_HEAD + (2 * i - 1) * EP_BIN_FP;
+			memcpy(q, t[i]->x, EP_BIN_FP);
+			memcpy(q + EP_BIN_FP, t[i]->y, EP_BIN_FP);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(one);
+		for (i = 0; i < (1 << w); i++) {
+			ep_free(t[i]);
+		}
+		free((void *)t);
+	}
+}
+
+void ep_mul_fix_bin(ep_t r, const uint8_t *bin, size_t len, const bn_t k) {
+	int i, j, w, e, w0, n0, p0, p1;
+	uint32_t l;
+	bn_t n, m, k0, k1;
+	ep_t u;
+
+	if (bn_is_zero(k)) {
+		ep_set_infty(r);
+		return;
+	}
+
+	if (!ep_check_bin(&w, &e, bin, len)) {
+		RLC_THROW(ERR_NO_VALID);
+		ep_set_infty(r);
+		return;
+	}
+	memcpy(&l, bin + 12, sizeof(uint32_t));
+
+	bn_null(n);
+	bn_null(m);
+	bn_null(k0);
+	bn_null(k1);
+	ep_null(u);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(m);
+		bn_new(k0);
+		bn_new(k1);
+		ep_new(u);
+
+		ep_curve_get_ord(n);
+		bn_mod(m, k, n);
+
+		if (e) {
+#if defined(EP_ENDOM)
+			int w1, n1, s0, s1;
+
+			bn_rec_glv(k0, k1, m, n, ep_curve_get_v1(), ep_curve_get_v2());
+			s0 = bn_sign(k0);
+			s1 = bn_sign(k1);
+			bn_abs(k0, k0);
+			bn_abs(k1, k1);
+			n0 = bn_bits(k0);
+			n1 = bn_bits(k1);
+			p0 = w * l - 1;
+
+			ep_set_infty(r);
+			if (n0 > p0 + 1) {
+				ep_get_bin(r, bin, 1 << (w - 1));
+			}
+			if (n1 > p0 + 1) {
+				ep_get_bin(u, bin, 1 << (w - 1));
+				ep_psi(u, u);
+				ep_add(r, r, u);
+			}
+
+			for (i = l - 1; i >= 0; i--) {
+				ep_dbl(r, r);
+
+				w0 = w1 = 0;
+				p1 = p0--;
+				for (j = w - 1; j >= 0; j--, p1 -= l) {
+					w0 = w0 << 1;
+					w1 = w1 << 1;
+					if (p1 < n0 && bn_get_bit(k0, p1)) {
+						w0 = w0 | 1;
+					}
+					if (p1 < n1 && bn_get_bit(k1, p1)) {
+						w1 = w1 | 1;
+					}
+				}
+				if (w0 > 0) {
+					ep_get_bin(u, bin, w0);
+					if (s0 == RLC_POS) {
+						ep_add(r, r, u);
+					} else {
+						ep_sub(r, r, u);
+					}
+				}
+				if (w1 > 0) {
+					ep_get_bin(u, bin, w1);
+					ep_psi(u, u);
+					if (s1 == RLC_POS) {
+						ep_add(r, r, u);
+					} else {
+						ep_sub(r, r, u);
+					}
+				}
+			}
+#endif
+		} else {
+			n0 = bn_bits(m);
+			p0 = w * l - 1;
+
+			ep_set_infty(r);
+			for (i = l - 1; i >= 0; i--) {
+				ep_dbl(r, r);
+
+				w0 = 0;
+				p1 = p0--;
+				for (j = w - 1; j >= 0; j--, p1 -= l) {
+					w0 = w0 << 1;
+					if (p1 < n0 && bn_get_bit(m, p1)) {
+						w0 = w0 | 1;
+					}
+				}
+				if (w0 > 0) {
+					ep_get_bin(u, bin, w0);
+					ep_add(r, r, u);
+				}
+			}
+		}
+		ep_norm(r, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(m);
+		bn_free(k0);
+		bn_free(k1);
+		ep_free(u);
+	}
+}
@@ -608,6 +608,306 @@ void ep_mul_sim_lot_plain(ep_t r, const ep_t p[], const bn_t k[], int n) {
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Number of bucket additions sharing a single inversion in the bucket method.
+ */
+#define EP_PIP_BATCH		128
+
+/**
+ * Number of passes over conflicting points before falling back to projective
+ * additions in the bucket method.
+ */
+#define EP_PIP_PASSES		4
+
+/**
+ * Arguments shared by the workers of the bucket method.
+ */
+typedef struct {
+	/** The points to multiply, in affine coordinates. */
+	ep_t *p;
+	/** The signed digits of the scalars, stored window by window. */
+	int16_t *d;
+	/** The number of points. */
+	int m;
+	/** The window size. */
+	int c;
+	/** The number of windows. */
+	int w;
+	/** The partial results of each window. */
+	ep_t *s;
+} ep_pip_t;
+
+/**
+ * Extracts a window of bits from a non-negative multiple precision integer.
+ *
+ * @param[in] k				- the integer.
+ * @param[in] pos			- the position of the first bit.
+ * @param[in] c				- the window size.
+ * @return the window value.
+ */
+static int ep_pip_bits(const bn_t k, size_t pos, int c) {
+	size_t i, j, s = 0;
+	uint32_t t = 0;
+
+	while (s < c) {
+		i = (pos + s) / RLC_DIG;
+		j = (pos + s) % RLC_DIG;
+		if (i >= k->used) {
+			break;
+		}
+		t |= (uint32_t)(k->dp[i] >> j) << s;
+		s += RLC_DIG - j;
+	}
+	return (int)(t & RLC_MASK(c));
+}
+
+/**
+ * Recodes a non-negative integer in signed windows, so that each digit lies in
+ * [-2^(c - 1) + 1, 2^(c - 1)].
+ *
+ * @param[out] d			- the digits, with a stride of m entries.
+ * @param[in] m				- the stride between consecutive digits.
+ * @param[in] k				- the integer to recode.
+ * @param[in] c				- the window size.
+ * @param[in] w				- the number of windows.
+ */
+static void ep_pip_rec(int16_t *d, int m, const bn_t k, int c, int w) {
+	int j, t, carry = 0;
+
+	for (j = 0; j < w; j++) {
+		t = ep_pip_bits(k, j * c, c) + carry;
+		carry = (t > (1 << (c - 1)));
+		if (carry) {
+			t -= (1 << c);
+		}
+		d[(size_t)j * m] = (int16_t)t;
+	}
+}
+
+/**
+ * Adds pending points to their buckets in affine coordinates, sharing a
+ * single inversion among all the additions.
+ *
+ * @param[in,out] b			- the buckets.
+ * @param[in] p				- the points.
+ * @param[in] d				- the signed digits of the points.
+ * @param[in] pb			- the indices of the buckets to update.
+ * @param[in] pp			- the indices of the points to add.
+ * @param[in] t				- the scratch space for the denominators.
+ * @param[in] n				- the number of pending additions.
+ */
+static void ep_pip_add(ep_t *b, const ep_t *p, const int16_t *d, const int *pb,
+		const int *pp, fp_t *t, int n) {
+	int i;
+	fp_t l, u;
+	ep_t v;
+
+	fp_null(l);
+	fp_null(u);
+	ep_null(v);
+
+	RLC_TRY {
+		fp_new(l);
+		fp_new(u);
+		ep_new(v);
+
+		for (i = 0; i < n; i++) {
+			fp_sub(t[i], p[pp[i]]->x, b[pb[i]]->x);
+			if (fp_is_zero(t[i])) {
+				fp_set_dig(t[i], 1);
+			}
+		}
+
+		fp_inv_sim(t, (const fp_t *)t, n);
+
+		for (i = 0; i < n; i++) {
+			ep_st *q = b[pb[i]];
+			ep_st *r = (ep_st *)p[pp[i]];
+
+			if (fp_cmp(r->x, q->x) == RLC_EQ) {
+				/* Doubling or cancellation, handle with generic formulas. */
+				ep_copy(v, r);
+				if (d[pp[i]] < 0) {
+					ep_neg(v, v);
+				}
+				ep_add(q, q, v);
+				ep_norm(q, q);
+				continue;
+			}
+
+			/* l = (y2 - y1)/(x2 - x1), x3 = l^2 - x1 - x2. */
+			if (d[pp[i]] < 0) {
+				fp_add(l, r->y, q->y);
+				fp_neg(l, l);
+			} else {
+				fp_sub(l, r->y, q->y);
+			}
+			fp_mul(l, l, t[i]);
+			fp_sqr(u, l);
+			fp_sub(u, u, q->x);
+			fp_sub(u, u, r->x);
+			/* y3 = l * (x1 - x3) - y1. */
+			fp_sub(q->x, q->x, u);
+			fp_mul(q->x, q->x, l);
+			fp_sub(q->y, q->x, q->y);
+			fp_copy(q->x, u);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(l);
+		fp_free(u);
+		ep_free(v);
+	}
+}
+
+/**
+ * Computes the partial result of a window in the bucket method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points in affine coordinates.
+ * @param[in] d				- the signed digits of the window.
+ * @param[in] m				- the number of points.
+ * @param[in] c				- the window size.
+ */
+static void ep_pip_win(ep_t r, const ep_t *p, const int16_t *d, int m, int c) {
+	const int h = 1 << (c - 1);
+	int i, j, k, n, pass, gen = 1, len, *bsy, *pb, *pp, *src, *dst;
+	fp_t *t = RLC_ALLOCA(fp_t, EP_PIP_BATCH);
+	ep_t u, v, *b;
+
+	ep_null(u);
+	ep_null(v);
+
+	b = (ep_t *)calloc(h, sizeof(ep_t));
+	bsy = (int *)calloc(h, sizeof(int));
+	pb = RLC_ALLOCA(int, EP_PIP_BATCH);
+	pp = RLC_ALLOCA(int, EP_PIP_BATCH);
+	src = (int *)malloc(2 * m * sizeof(int));
+	dst = (src == NULL ? NULL : src + m);
+	if (t != NULL) {
+		for (i = 0; i < EP_PIP_BATCH; i++) {
+			fp_null(t[i]);
+		}
+	}
+
+	RLC_TRY {
+		if (b == NULL || bsy == NULL || t == NULL || pb == NULL || pp == NULL
+				|| src == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		ep_new(u);
+		ep_new(v);
+		for (i = 0; i < EP_PIP_BATCH; i++) {
+			fp_new(t[i]);
+		}
+		for (i = 0; i < h; i++) {
+			ep_new(b[i]);
+			ep_set_infty(b[i]);
+		}
+
+		len = 0;
+		for (i = 0; i < m; i++) {
+			if (d[i] != 0) {
+				src[len++] = i;
+			}
+		}
+
+		/* Accumulate points in buckets, deferring conflicts to next pass. */
+		for (pass = 0; len > 0 && pass < EP_PIP_PASSES; pass++) {
+			n = k = 0;
+			for (i = 0; i < len; i++) {
+				j = (d[src[i]] < 0 ? -d[src[i]] : d[src[i]]) - 1;
+				if (bsy[j] == gen) {
+					dst[k++] = src[i];
+				} else if (ep_is_infty(b[j])) {
+					ep_copy(b[j], p[src[i]]);
+					if (d[src[i]] < 0) {
+						ep_neg(b[j], b[j]);
+					}
+				} else {
+					bsy[j] = gen;
+					pb[n] = j;
+					pp[n++] = src[i];
+					if (n == EP_PIP_BATCH) {
+						ep_pip_add(b, p, d, pb, pp, t, n);
+						n = 0;
+						gen++;
+					}
+				}
+			}
+			if (n > 0) {
+				ep_pip_add(b, p, d, pb, pp, t, n);
+				gen++;
+			}
+			for (i = 0; i < k; i++) {
+				src[i] = dst[i];
+			}
+			len = k;
+		}
+
+		/* Add remaining points, concentrated on few buckets. */
+		for (i = 0; i < len; i++) {
+			j = (d[src[i]] < 0 ? -d[src[i]] : d[src[i]]) - 1;
+			if (d[src[i]] > 0) {
+				ep_add(b[j], b[j], p[src[i]]);
+			} else {
+				ep_sub(b[j], b[j], p[src[i]]);
+			}
+		}
+
+		/* Compute r = \sum_j (j + 1) * b_j with running sums. */
+		ep_set_infty(u);
+		ep_set_infty(v);
+		for (j = h - 1; j >= 0; j--) {
+			ep_add(u, u, b[j]);
+			ep_add(v, v, u);
+		}
+		ep_copy(r, v);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(u);
+		ep_free(v);
+		if (t != NULL) {
+			for (i = 0; i < EP_PIP_BATCH; i++) {
+				fp_free(t[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < h; i++) {
+				ep_free(b[i]);
+			}
+		}
+		free((void *)b);
+		free(bsy);
+		free(src);
+		RLC_FREE(t);
+		RLC_FREE(pb);
+		RLC_FREE(pp);
+	}
+}
+
+/**
+ * Computes the partial results of the windows assigned to a worker.
+ *
+ * @param[in,out] arg		- the arguments of the bucket method.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void ep_pip_job(void *arg, int id, int cores) {
+	ep_pip_t *pip = (ep_pip_t *)arg;
+
+	for (int j = id; j < pip->w; j += cores) {
+		ep_pip_win(pip->s[j], (const ep_t *)pip->p,
+				pip->d + (size_t)j * pip->m, pip->m, pip->c);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -977,6 +1277,140 @@ void ep_mul_sim_dig(ep_t r, const ep_t p[], const dig_t k[], int n) {
 	}
 }
 
+void ep_mul_sim_pip(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int i, j, l, pass, d = 1;
+	bn_t q, _k[2];
+	ep_pip_t pip;
+
+	if (n == 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	if (ep_curve_is_endom()) {
+		d = 2;
+	}
+#endif
+
+	pip.m = d * n;
+	pip.w = 0;
+	pip.p = (ep_t *)calloc(pip.m, sizeof(ep_t));
+	pip.d = NULL;
+	pip.s = NULL;
+
+	bn_null(q);
+	bn_null(_k[0]);
+	bn_null(_k[1]);
+
+	RLC_TRY {
+		if (pip.p == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(q);
+		bn_new(_k[0]);
+		bn_new(_k[1]);
+		for (i = 0; i < pip.m; i++) {
+			ep_new(pip.p[i]);
+		}
+
+		for (i = 0; i < n; i++) {
+			ep_copy(pip.p[i], p[i]);
+		}
+		ep_norm_sim(pip.p, (const ep_t *)pip.p, n);
+		for (i = n - 1; i >= 0; i--) {
+			ep_copy(pip.p[d * i], pip.p[i]);
+#if defined(EP_ENDOM)
+			if (d == 2) {
+				ep_psi(pip.p[2 * i + 1], pip.p[2 * i]);
+			}
+#endif
+		}
+
+		/* Choose the window size from the number of points. */
+		pip.c = RLC_MIN(15, RLC_MAX(2, (util_bits_dig(pip.m) * 69) / 100 + 2));
+
+		/* Decompose the scalars twice, first to bound their length. */
+		l = 0;
+		ep_curve_get_ord(q);
+		for (pass = 0; pass < 2; pass++) {
+			if (pass == 1) {
+				pip.w = RLC_CEIL(l + 1, pip.c);
+				pip.d = (int16_t *)malloc((size_t)pip.w * pip.m *
+						sizeof(int16_t));
+				pip.s = (ep_t *)calloc(pip.w, sizeof(ep_t));
+				if (pip.d == NULL || pip.s == NULL) {
+					RLC_THROW(ERR_NO_MEMORY);
+				}
+				for (j = 0; j < pip.w; j++) {
+					ep_new(pip.s[j]);
+				}
+			}
+			for (i = 0; i < n; i++) {
+				bn_mod(_k[0], k[i], q);
+				if (bn_sign(_k[0]) == RLC_NEG) {
+					bn_add(_k[0], _k[0], q);
+				}
+				if (ep_is_infty(pip.p[d * i])) {
+					bn_zero(_k[0]);
+				}
+#if defined(EP_ENDOM)
+				if (d == 2) {
+					bn_rec_glv(_k[0], _k[1], _k[0], q, ep_curve_get_v1(),
+							ep_curve_get_v2());
+				}
+#endif
+				for (j = 0; j < d; j++) {
+					if (pass == 0) {
+						l = RLC_MAX(l, bn_bits(_k[j]));
+						continue;
+					}
+					/* Move the sign of the subscalar to the point. */
+					if (bn_sign(_k[j]) == RLC_NEG) {
+						ep_neg(pip.p[d * i + j], pip.p[d * i + j]);
+						bn_abs(_k[j], _k[j]);
+					}
+					ep_pip_rec(pip.d + d * i + j, pip.m, _k[j], pip.c, pip.w);
+				}
+			}
+		}
+
+		/* Compute the windows in parallel for large instances. */
+		core_run(ep_pip_job, &pip, (pip.m >= RLC_EP_PIP_PAR ? pip.w : 1));
+
+		ep_set_infty(r);
+		for (j = pip.w - 1; j >= 0; j--) {
+			for (i = 0; i < pip.c; i++) {
+				ep_dbl(r, r);
+			}
+			ep_add(r, r, pip.s[j]);
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(q);
+		bn_free(_k[0]);
+		bn_free(_k[1]);
+		if (pip.p != NULL) {
+			for (i = 0; i < pip.m; i++) {
+				ep_free(pip.p[i]);
+			}
+		}
+		if (pip.s != NULL) {
+			for (j = 0; j < pip.w; j++) {
+				ep_free(pip.s[j]);
+			}
+		}
+		free((void *)pip.p);
+		free(pip.d);
+		free((void *)pip.s);
+	}
+}
+
 void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
 	int flag = 0;
 
@@ -985,6 +1419,11 @@ void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
 		return;
 	}
 
+	if (n >= RLC_EP_PIP_MIN) {
+		ep_mul_sim_pip(r, p, k, n);
+		return;
+	}
+
 #if defined(EP_ENDOM)
 	if (ep_curve_is_endom()) {
 		ep_mul_sim_lot_endom(r, p, k, n);
@@ -31,6 +31,59 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Chooses the square root matching the compressed y-coordinate.
+ *
+ * @param[in,out] t			- the square root to adjust.
+ * @param[in] b				- the compressed y-coordinate bit.
+ */
+static void ep_upk_sgn(fp_t t, int b) {
+	bn_t halfQ, yValue;
+
+	bn_null(halfQ);
+	bn_null(yValue);
+
+	RLC_TRY {
+		bn_new(halfQ);
+		bn_new(yValue);
+
+		if (ep_curve_is_pairf()) {
+			/* Verify whether the y coordinate is the larger one, matches the
+			 * compressed y-coordinate, from IETF pairing friendly spec:
+				sign_F_p(y) :=  { 1 if y > (p - 1) / 2, else
+								{ 0 otherwise.
+			*/
+			halfQ->used = RLC_FP_DIGS;
+			dv_copy(halfQ->dp, fp_prime_get(), RLC_FP_DIGS);
+			bn_hlv(halfQ, halfQ);  // This is equivalent to p - 1 / 2, floor division
+
+			fp_prime_back(yValue, t);
+			int sign_fpy = bn_cmp(yValue, halfQ) == RLC_GT;
+
+			if (sign_fpy != b) {
+				fp_neg(t, t);
+			}
+		} else {
+			/* Verify if least significant bit of the result matches the
+			 * compressed y-coordinate. */
+			if (fp_get_bit(t, 0) != b) {
+				fp_neg(t, t);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(yValue);
+		bn_free(halfQ);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -76,18 +129,12 @@ void ep_pck(ep_t r, const ep_t p) {
 
 int ep_upk(ep_t r, const ep_t p) {
 	fp_t t;
-	bn_t halfQ;
-	bn_t yValue;
 	int result = 0;
 
 	fp_null(t);
-	bn_null(halfQ);
-	bn_null(yValue);
 
 	RLC_TRY {
 		fp_new(t);
-		bn_new(halfQ);
-		bn_new(yValue);
 
 		ep_rhs(t, p->x);
 
@@ -95,29 +142,7 @@ int ep_upk(ep_t r, const ep_t p) {
 		result = fp_srt(t, t);
 
 		if (result) {
-			if (ep_curve_is_pairf()) {
-				/* Verify whether the y coordinate is the larger one, matches the
-				 * compressed y-coordinate, from IETF pairing friendly spec:
-					sign_F_p(y) :=  { 1 if y > (p - 1) / 2, else
-									{ 0 otherwise.
-				*/
-				halfQ->used = RLC_FP_DIGS;
-				dv_copy(halfQ->dp, fp_prime_get(), RLC_FP_DIGS);
-				bn_hlv(halfQ, halfQ);  // This is equivalent to p - 1 / 2, floor division
-
-				fp_prime_back(yValue, t);
-				int sign_fpy = bn_cmp(yValue, halfQ) == RLC_GT;
-
-				if (sign_fpy != fp_get_bit(p->y, 0)) {
-					fp_neg(t, t);
-				}
-			} else {
-				/* Verify if least significant bit of the result matches the
-				 * compressed y-coordinate. */
-				if (fp_get_bit(t, 0) != fp_get_bit(p->y, 0)) {
-					fp_neg(t, t);
-				}
-			}
+			ep_upk_sgn(t, fp_get_bit(p->y, 0));
 			fp_copy(r->x, p->x);
 			fp_copy(r->y, t);
 			fp_set_dig(r->z, 1);
@@ -129,8 +154,51 @@ int ep_upk(ep_t r, const ep_t p) {
 	}
 	RLC_FINALLY {
 		fp_free(t);
-		bn_free(yValue);
-		bn_free(halfQ);
 	}
 	return result;
 }
+
+void ep_upk_batch(ep_t *r, int *v, const ep_t *p, int n) {
+	fp_t *t;
+
+	if (n <= 0) {
+		return;
+	}
+
+	t = RLC_ALLOCA(fp_t, n);
+	for (int i = 0; t != NULL && i < n; i++) {
+		fp_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < n; i++) {
+			fp_new(t[i]);
+			ep_rhs(t[i], p[i]->x);
+		}
+
+		/* Compute all the square roots at once. */
+		fp_srt_batch(t, v, (const fp_t *)t, n);
+
+		for (int i = 0; i < n; i++) {
+			if (v[i]) {
+				ep_upk_sgn(t[i], fp_get_bit(p[i]->y, 0));
+				fp_copy(r[i]->x, p[i]->x);
+				fp_copy(r[i]->y, t[i]);
+				fp_set_dig(r[i]->z, 1);
+				r[i]->coord = BASIC;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (int i = 0; t != NULL && i < n; i++) {
+			fp_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
@@ -32,6 +32,133 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Arguments shared by the workers decoding a batch of points.
+ */
+typedef struct {
+	/** The decoded points. */
+	ep_t *a;
+	/** The validity flags. */
+	int *v;
+	/** The encodings. */
+	const uint8_t *bin;
+	/** The length of each encoding. */
+	size_t len;
+	/** The number of points. */
+	int n;
+} ep_bin_t;
+
+/**
+ * Reads a prime field element from a byte vector without throwing errors.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bin			- the byte vector with RLC_FP_BYTES bytes.
+ * @return a boolean value indicating if the element is in the field.
+ */
+static int ep_read_fp(fp_t a, const uint8_t *bin) {
+	bn_t t;
+	int r = 0;
+
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(t);
+		bn_read_bin(t, bin, RLC_FP_BYTES);
+		if (bn_cmp(t, &core_get()->prime) == RLC_LT) {
+			fp_prime_conv(a, t);
+			r = 1;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(t);
+	}
+	return r;
+}
+
+/**
+ * Decodes a contiguous range of a batch of points.
+ *
+ * @param[in,out] arg		- the arguments of the batch.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void ep_read_bin_job(void *arg, int id, int cores) {
+	ep_bin_t *b = (ep_bin_t *)arg;
+	int i, j = (int)((long)b->n * id / cores);
+	int m = (int)((long)b->n * (id + 1) / cores) - j;
+	ep_t *a = b->a + j;
+	int *v = b->v + j, *u = RLC_ALLOCA(int, 2 * m);
+	size_t k, len = b->len;
+
+	/* The flags of compressed points are followed by the decompression ones. */
+	RLC_TRY {
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			const uint8_t *s = b->bin + (size_t)(j + i) * len;
+
+			u[i] = v[i] = 0;
+			ep_set_infty(a[i]);
+			if (s[0] == 0) {
+				/* The point at infinity is encoded as zeros. */
+				v[i] = 1;
+				for (k = 1; k < len; k++) {
+					v[i] &= (s[k] == 0);
+				}
+				continue;
+			}
+			if (!ep_read_fp(a[i]->x, s + 1)) {
+				fp_zero(a[i]->x);
+				continue;
+			}
+			if (len == RLC_FP_BYTES + 1) {
+				if (s[0] == 2 || s[0] == 3) {
+					fp_zero(a[i]->y);
+					fp_set_bit(a[i]->y, 0, s[0] & 1);
+					u[i] = 1;
+				} else {
+					fp_zero(a[i]->x);
+				}
+			} else {
+				if (s[0] == 4 && ep_read_fp(a[i]->y, s + RLC_FP_BYTES + 1)) {
+					fp_set_dig(a[i]->z, 1);
+					v[i] = ep_on_curve(a[i]);
+				}
+				if (!v[i]) {
+					ep_set_infty(a[i]);
+				}
+			}
+		}
+
+		if (len == RLC_FP_BYTES + 1) {
+			/* Decompressed points satisfy the curve equation by construction. */
+			ep_upk_batch(a, u + m, (const ep_t *)a, m);
+			for (i = 0; i < m; i++) {
+				if (u[i]) {
+					v[i] = u[m + i];
+				}
+				if (!u[i] || !u[m + i]) {
+					ep_set_infty(a[i]);
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -288,6 +415,26 @@ void ep_read_bin(ep_t a, const uint8_t *bin, size_t len) {
 	}
 }
 
+void ep_read_bin_batch(ep_t *a, int *v, const uint8_t *bin, size_t len,
+		int n) {
+	ep_bin_t b;
+
+	if (len != (RLC_FP_BYTES + 1) && len != (2 * RLC_FP_BYTES + 1)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+	if (n <= 0) {
+		return;
+	}
+
+	b.a = a;
+	b.v = v;
+	b.bin = bin;
+	b.len = len;
+	b.n = n;
+	core_run(ep_read_bin_job, &b, RLC_MAX(1, n / RLC_EP_BATCH_PAR));
+}
+
 void ep_write_bin(uint8_t *bin, size_t len, const ep_t a, int pack) {
 	ep_t t;
 
@@ -564,11 +564,11 @@ void ep2_curve_init(void) {
 
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		ctx->ep2_ptr[i] = &(ctx->ep2_pre[i]);
+		ctx->ep2_ptr[i] = &(ctx->pre->ep2_pre[i]);
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep2_new(ctx->ep2_g);
 	fp2_new(ctx->ep2_a);
 	fp2_new(ctx->ep2_b);
@@ -581,11 +581,11 @@ void ep2_curve_init(void) {
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		fp2_new(ctx->ep2_pre[i].x);
-		fp2_new(ctx->ep2_pre[i].y);
-		fp2_new(ctx->ep2_pre[i].z);
+		fp2_new(ctx->pre->ep2_pre[i].x);
+		fp2_new(ctx->pre->ep2_pre[i].y);
+		fp2_new(ctx->pre->ep2_pre[i].z);
 	}
 #endif
 #endif
@@ -594,7 +594,7 @@ void ep2_curve_init(void) {
 
 #ifdef EP_CTMAP
 	iso2_t iso = ep2_curve_get_iso();
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	fp2_new(iso->a);
 	fp2_new(iso->b);
 	for (unsigned i = 0; i < RLC_EPX_CTMAP_MAX; ++i) {
@@ -617,9 +617,9 @@ void ep2_curve_clean(void) {
 	if (ctx != NULL) {
 #ifdef EP_PRECO
 		for (int i = 0; i < RLC_EP_TABLE; i++) {
-			fp2_free(ctx->ep2_pre[i].x);
-			fp2_free(ctx->ep2_pre[i].y);
-			fp2_free(ctx->ep2_pre[i].z);
+			fp2_free(ctx->pre->ep2_pre[i].x);
+			fp2_free(ctx->pre->ep2_pre[i].y);
+			fp2_free(ctx->pre->ep2_pre[i].z);
 		}
 #endif
 		bn_clean(&(ctx->ep2_r));
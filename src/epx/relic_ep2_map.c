@@ -167,6 +167,183 @@ static void ep2_map_from_field(ep2_t p, const uint8_t *r, size_t len) {
 	}
 }
 
+#if EP_MAP == SSWUM
+
+/**
+ * Maps multiple field elements to points in an elliptic curve over a quadratic
+ * extension using the simplified SWU map, sharing the field inversion among
+ * all of them. The sign of each point is fixed as in ep2_map_from_field().
+ *
+ * @param[out] q			- the resulting points.
+ * @param[in] t				- the field elements to map.
+ * @param[in] n				- the number of field elements.
+ */
+static void ep2_map_sswu_sim(ep2_t *q, const fp2_t *t, int n) {
+	ctx_t *ctx = core_get();
+	fp2_t t0, t1, t2, *d = RLC_ALLOCA(fp2_t, n);
+	bn_t k;
+	int e, neg;
+
+	bn_null(k);
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(t2);
+	for (int i = 0; d != NULL && i < n; i++) {
+		fp2_null(d[i]);
+	}
+
+	RLC_TRY {
+		if (d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(k);
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(t2);
+		for (int i = 0; i < n; i++) {
+			fp2_new(d[i]);
+		}
+
+		/* Collect the denominators u^2 * t^4 + u * t^2, or -u if zero. */
+		fp2_neg(t2, ctx->ep2_map_u);
+		for (int i = 0; i < n; i++) {
+			fp2_sqr(t0, t[i]);
+			fp2_mul(t0, t0, ctx->ep2_map_u);
+			fp2_sqr(t1, t0);
+			fp2_add(d[i], t1, t0);
+			fp2_copy_sec(d[i], t2, fp2_is_zero(d[i]));
+		}
+
+		fp2_inv_sim(d, (const fp2_t *)d, n);
+
+		for (int i = 0; i < n; i++) {
+			fp2_sqr(t0, t[i]);
+			fp2_mul(t0, t0, ctx->ep2_map_u);
+			fp2_sqr(t1, t0);
+			fp2_add(t2, t1, t0);
+			e = fp2_is_zero(t2);
+			/* Add 1 unless the denominator was replaced by -u. */
+			fp2_add_dig(t2, d[i], 1);
+			fp2_copy_sec(d[i], t2, e == 0);
+
+			/* Compute x1 = -B / A * (1 + 1 / (u^2 * t^4 + u * t^2)), g(x1). */
+			fp2_mul(q[i]->x, d[i], ctx->ep2_map_c[0]);
+			fp2_sqr(q[i]->y, q[i]->x);
+			fp2_add(q[i]->y, q[i]->y, ctx->ep2_map_c[2]);
+			fp2_mul(q[i]->y, q[i]->y, q[i]->x);
+			fp2_add(q[i]->y, q[i]->y, ctx->ep2_map_c[3]);
+
+			/* Compute x2 = u * t^2 * x1, g(x2) = u^3 * t^6 * g(x1). */
+			fp2_mul(t2, t0, q[i]->x);
+			fp2_mul(t1, t0, t1);
+			fp2_mul(d[i], t1, q[i]->y);
+			e = fp2_is_sqr(q[i]->y);
+			fp2_copy_sec(q[i]->x, t2, e == 0);
+			fp2_copy_sec(q[i]->y, d[i], e == 0);
+			if (!fp2_srt(q[i]->y, q[i]->y)) {
+				RLC_THROW(ERR_NO_VALID);
+			}
+
+			/* Compare sign of y to sign of t and fix if necessary. */
+			neg = fp2_sgn0(t[i], k) != fp2_sgn0(q[i]->y, k);
+			fp2_neg(t2, q[i]->y);
+			fp2_copy_sec(q[i]->y, t2, neg);
+			fp2_set_dig(q[i]->z, 1);
+			q[i]->coord = BASIC;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(t2);
+		for (int i = 0; d != NULL && i < n; i++) {
+			fp2_free(d[i]);
+		}
+		RLC_FREE(d);
+	}
+}
+
+#ifdef EP_CTMAP
+
+/**
+ * Evaluates the isogeny map on multiple points in affine coordinates, sharing
+ * the inversion of the denominators among them.
+ *
+ * @param[in,out] q			- the points to map.
+ * @param[in] n				- the number of points.
+ */
+static void ep2_iso_sim(ep2_t *q, int n) {
+	fp2_t t0, t1, t2, t3, *d;
+
+	if (!ep2_curve_is_ctmap()) {
+		return;
+	}
+
+	d = RLC_ALLOCA(fp2_t, n);
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(t2);
+	fp2_null(t3);
+	for (int i = 0; d != NULL && i < n; i++) {
+		fp2_null(d[i]);
+	}
+
+	RLC_TRY {
+		if (d == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(t2);
+		fp2_new(t3);
+		for (int i = 0; i < n; i++) {
+			fp2_new(d[i]);
+		}
+
+		iso2_t coeffs = ep2_curve_get_iso();
+
+		for (int i = 0; i < n; i++) {
+			fp2_eval(t0, q[i]->x, coeffs->xn, coeffs->deg_xn);
+			fp2_eval(t1, q[i]->x, coeffs->yn, coeffs->deg_yn);
+			fp2_eval(t2, q[i]->x, coeffs->yd, coeffs->deg_yd);
+			fp2_eval(t3, q[i]->x, coeffs->xd, coeffs->deg_xd);
+			/* X = Nx * Dy, Y = y * Ny * Dx, both over Dx * Dy. */
+			fp2_mul(q[i]->x, t0, t2);
+			fp2_mul(q[i]->y, q[i]->y, t1);
+			fp2_mul(q[i]->y, q[i]->y, t3);
+			fp2_mul(d[i], t2, t3);
+		}
+
+		fp2_inv_sim(d, (const fp2_t *)d, n);
+
+		for (int i = 0; i < n; i++) {
+			fp2_mul(q[i]->x, q[i]->x, d[i]);
+			fp2_mul(q[i]->y, q[i]->y, d[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(t2);
+		fp2_free(t3);
+		for (int i = 0; d != NULL && i < n; i++) {
+			fp2_free(d[i]);
+		}
+		RLC_FREE(d);
+	}
+}
+
+#endif /* EP_CTMAP */
+
+#endif /* EP_MAP == SSWUM */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -535,3 +712,85 @@ void ep2_map_swift(ep2_t p, const uint8_t *msg, size_t len) {
 }
 
 #endif
+
+void ep2_map_batch(ep2_t *p, const uint8_t *msg[], const size_t len[], int n) {
+#if EP_MAP == SSWUM
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int lpe = (FP_PRIME + ep_param_level() + 7) / 8;
+	const int abNeq0 = (ep2_curve_opt_a() != RLC_ZERO) &&
+			(ep2_curve_opt_b() != RLC_ZERO);
+	uint8_t *r;
+	fp2_t *t;
+	ep2_t *q;
+	bn_t k;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (!ep2_curve_is_ctmap() && !abNeq0) {
+		/* The Shallue--van de Woestijne map is not batched. */
+		for (int i = 0; i < n; i++) {
+			ep2_map_sswum(p[i], msg[i], len[i]);
+		}
+		return;
+	}
+
+	bn_null(k);
+	r = RLC_ALLOCA(uint8_t, 4 * lpe * n);
+	t = RLC_ALLOCA(fp2_t, 2 * n);
+	q = RLC_ALLOCA(ep2_t, 2 * n);
+	for (int i = 0; t != NULL && q != NULL && i < 2 * n; i++) {
+		fp2_null(t[i]);
+		ep2_null(q[i]);
+	}
+
+	RLC_TRY {
+		if (r == NULL || t == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(k);
+		for (int i = 0; i < 2 * n; i++) {
+			fp2_new(t[i]);
+			ep2_new(q[i]);
+		}
+
+		/* Expand all messages at once, with the same tag as ep2_map_sswum(). */
+		md_xmd_batch(r, 4 * lpe, msg, len, n, (const uint8_t *)"RELIC", 5);
+		for (int i = 0; i < 2 * n; i++) {
+			bn_read_bin(k, r + 2 * i * lpe, lpe);
+			fp_prime_conv(t[i][0], k);
+			bn_read_bin(k, r + (2 * i + 1) * lpe, lpe);
+			fp_prime_conv(t[i][1], k);
+		}
+
+		ep2_map_sswu_sim(q, (const fp2_t *)t, 2 * n);
+#ifdef EP_CTMAP
+		ep2_iso_sim(q, 2 * n);
+#endif
+
+		for (int i = 0; i < n; i++) {
+			ep2_add(p[i], q[2 * i], q[2 * i + 1]);
+		}
+		ep2_norm_sim(p, (const ep2_t *)p, n);
+		ep2_mul_cof_sim(p, (const ep2_t *)p, n);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		for (int i = 0; t != NULL && q != NULL && i < 2 * n; i++) {
+			fp2_free(t[i]);
+			ep2_free(q[i]);
+		}
+		RLC_FREE(r);
+		RLC_FREE(t);
+		RLC_FREE(q);
+	}
+#else
+	for (int i = 0; i < n; i++) {
+		ep2_map(p[i], msg[i], len[i]);
+	}
+#endif
+}
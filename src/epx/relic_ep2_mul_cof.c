@@ -145,6 +145,48 @@ static void ep2_mul_cof_b12(ep2_t r, const ep2_t p) {
 	}
 }
 
+/**
+ * Multiplies a point by the curve parameter given in NAF form, without
+ * normalizing the result.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] naf			- the NAF representation of the parameter.
+ * @param[in] len			- the length of the representation.
+ * @param[in] sign			- the sign of the parameter.
+ */
+static void ep2_mul_naf(ep2_t r, const ep2_t p, const int8_t *naf, size_t len,
+		int sign) {
+	ep2_t t;
+
+	ep2_null(t);
+
+	RLC_TRY {
+		ep2_new(t);
+
+		ep2_copy(t, p);
+		for (int i = len - 2; i >= 0; i--) {
+			ep2_dbl(t, t);
+			if (naf[i] > 0) {
+				ep2_add(t, t, p);
+			} else if (naf[i] < 0) {
+				ep2_sub(t, t, p);
+			}
+		}
+		if (sign == RLC_NEG) {
+			ep2_neg(r, t);
+		} else {
+			ep2_copy(r, t);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(t);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -174,3 +216,101 @@ void ep2_mul_cof(ep2_t r, const ep2_t p) {
 		bn_free(k);
 	}
 }
+
+void ep2_mul_cof_sim(ep2_t *r, const ep2_t *p, int n) {
+	const int type = ep_curve_is_pairf();
+	bn_t x;
+	ep2_t u, v, *t;
+	int8_t *naf = NULL;
+	size_t l;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (type != EP_BN && type != EP_B12) {
+		for (int i = 0; i < n; i++) {
+			ep2_mul_cof(r[i], p[i]);
+		}
+		return;
+	}
+
+	bn_null(x);
+	ep2_null(u);
+	ep2_null(v);
+
+	t = RLC_ALLOCA(ep2_t, n);
+	for (int i = 0; t != NULL && i < n; i++) {
+		ep2_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(x);
+		ep2_new(u);
+		ep2_new(v);
+		for (int i = 0; i < n; i++) {
+			ep2_new(t[i]);
+		}
+
+		fp_prime_get_par(x);
+		l = bn_bits(x) + 1;
+		naf = RLC_ALLOCA(int8_t, l);
+		if (naf == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_rec_naf(naf, &l, x, 2);
+
+		/* Compute t_i = xP_i and normalize them together. */
+		for (int i = 0; i < n; i++) {
+			ep2_mul_naf(t[i], p[i], naf, l, bn_sign(x));
+		}
+		ep2_norm_sim(t, (const ep2_t *)t, n);
+
+		for (int i = 0; i < n; i++) {
+			if (type == EP_B12) {
+				/* u = (x^2 - x - 1)P + \psi(x - 1)P. */
+				ep2_mul_naf(u, t[i], naf, l, bn_sign(x));
+				ep2_sub(u, u, t[i]);
+				ep2_sub(u, u, p[i]);
+				ep2_sub(v, t[i], p[i]);
+				ep2_frb(v, v, 1);
+				ep2_add(u, u, v);
+				/* t_i = u + \psi^2(2P). */
+				ep2_dbl(v, p[i]);
+				ep2_frb(v, v, 2);
+				ep2_add(t[i], u, v);
+			} else {
+				/* u = \psi(3xP), v = \psi^3(P) + xP + u. */
+				ep2_dbl(u, t[i]);
+				ep2_add(u, u, t[i]);
+				ep2_frb(u, u, 1);
+				ep2_frb(v, p[i], 3);
+				ep2_add(v, v, t[i]);
+				ep2_add(v, v, u);
+				/* t_i = v + \psi^2(xP). */
+				ep2_frb(u, t[i], 2);
+				ep2_add(t[i], v, u);
+			}
+		}
+
+		ep2_norm_sim(r, (const ep2_t *)t, n);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(x);
+		ep2_free(u);
+		ep2_free(v);
+		if (t != NULL) {
+			for (int i = 0; i < n; i++) {
+				ep2_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+		RLC_FREE(naf);
+	}
+}
@@ -126,7 +126,6 @@ void ep2_norm_sim(ep2_t *r, const ep2_t *t, int n) {
 			} else {
 				fp2_copy(a[i], t[i]->z);
 			}
-			fp2_copy(a[i], t[i]->z);
 		}
 
 		fp2_inv_sim(a, (const fp2_t *)a, n);
@@ -134,6 +133,7 @@ void ep2_norm_sim(ep2_t *r, const ep2_t *t, int n) {
 		for (i = 0; i < n; i++) {
 			fp2_copy(r[i]->x, t[i]->x);
 			fp2_copy(r[i]->y, t[i]->y);
+			r[i]->coord = t[i]->coord;
 			if (ep2_is_infty(t[i])) {
 				ep2_set_infty(r[i]);
 			} else {
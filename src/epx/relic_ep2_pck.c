@@ -32,6 +32,58 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Chooses the square root matching the compressed y-coordinate.
+ *
+ * @param[in,out] t			- the square root to adjust.
+ * @param[in] b				- the compressed y-coordinate bit.
+ */
+static void ep2_upk_sgn(fp2_t t, int b) {
+	bn_t halfQ, yValue;
+
+	bn_null(halfQ);
+	bn_null(yValue);
+
+	RLC_TRY {
+		bn_new(halfQ);
+		bn_new(yValue);
+
+		/* Verify whether the y coordinate is the larger one, matches the
+		 * compressed y-coordinate (IETF pairing friendly spec)
+		 * sign_F_p^2(y') := { sign_F_p(y'_0) if y'_1 equals 0, else
+		 *          	     { 1 if y'_1 > (p - 1) / 2, else
+		 *                   { 0 otherwise.
+		 *
+		 */
+		halfQ->used = RLC_FP_DIGS;
+		dv_copy(halfQ->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_hlv(halfQ, halfQ);
+
+		fp_prime_back(yValue, t[1]);
+
+		if (bn_is_zero(yValue)) {
+			fp_prime_back(yValue, t[0]);
+		}
+
+		int sign_fp2y = bn_cmp(yValue, halfQ) == RLC_GT;
+
+		if (sign_fp2y != b) {
+			fp2_neg(t, t);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(yValue);
+		bn_free(halfQ);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -72,18 +124,12 @@ void ep2_pck(ep2_t r, const ep2_t p) {
 
 int ep2_upk(ep2_t r, const ep2_t p) {
 	fp2_t t;
-	bn_t halfQ;
-	bn_t yValue;
 	int result = 0;
 
 	fp2_null(t);
-	bn_null(halfQ);
-	bn_null(yValue);
 
 	RLC_TRY {
 		fp2_new(t);
-		bn_new(halfQ);
-		bn_new(yValue);
 
 		ep2_rhs(t, p->x);
 
@@ -91,28 +137,7 @@ int ep2_upk(ep2_t r, const ep2_t p) {
 		result = fp2_srt(t, t);
 
 		if (result) {
-			/* Verify whether the y coordinate is the larger one, matches the
-			 * compressed y-coordinate (IETF pairing friendly spec)
-			 * sign_F_p^2(y') := { sign_F_p(y'_0) if y'_1 equals 0, else
-			 *          	     { 1 if y'_1 > (p - 1) / 2, else
-			 *                   { 0 otherwise.
-			 *
-			 */
-			halfQ->used = RLC_FP_DIGS;
-			dv_copy(halfQ->dp, fp_prime_get(), RLC_FP_DIGS);
-			bn_hlv(halfQ, halfQ);
-
-			fp_prime_back(yValue, t[1]);
-
-			if (bn_is_zero(yValue)) {
-				fp_prime_back(yValue, t[0]);
-			}
-
-			int sign_fp2y = bn_cmp(yValue, halfQ) == RLC_GT;
-
-			if (sign_fp2y != fp_get_bit(p->y[0], 0)) {
-				fp2_neg(t, t);
-			}
+			ep2_upk_sgn(t, fp_get_bit(p->y[0], 0));
 			fp2_copy(r->x, p->x);
 			fp2_copy(r->y, t);
 			fp_set_dig(r->z[0], 1);
@@ -125,8 +150,52 @@ int ep2_upk(ep2_t r, const ep2_t p) {
 	}
 	RLC_FINALLY {
 		fp2_free(t);
-		bn_free(yValue);
-		bn_free(halfQ);
 	}
 	return result;
 }
+
+void ep2_upk_batch(ep2_t *r, int *v, const ep2_t *p, int n) {
+	fp2_t *t;
+
+	if (n <= 0) {
+		return;
+	}
+
+	t = RLC_ALLOCA(fp2_t, n);
+	for (int i = 0; t != NULL && i < n; i++) {
+		fp2_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < n; i++) {
+			fp2_new(t[i]);
+			ep2_rhs(t[i], p[i]->x);
+		}
+
+		/* Compute all the square roots at once. */
+		fp2_srt_batch(t, v, (const fp2_t *)t, n);
+
+		for (int i = 0; i < n; i++) {
+			if (v[i]) {
+				ep2_upk_sgn(t[i], fp_get_bit(p[i]->y[0], 0));
+				fp2_copy(r[i]->x, p[i]->x);
+				fp2_copy(r[i]->y, t[i]);
+				fp_set_dig(r[i]->z[0], 1);
+				fp_zero(r[i]->z[1]);
+				r[i]->coord = BASIC;
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (int i = 0; t != NULL && i < n; i++) {
+			fp2_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
@@ -214,11 +214,11 @@ void ep3_curve_init(void) {
 
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		ctx->ep3_ptr[i] = &(ctx->ep3_pre[i]);
+		ctx->ep3_ptr[i] = &(ctx->pre->ep3_pre[i]);
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep3_new(ctx->ep3_g);
 	fp3_new(ctx->ep3_a);
 	fp3_new(ctx->ep3_b);
@@ -228,11 +228,11 @@ void ep3_curve_init(void) {
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		fp3_new(ctx->ep3_pre[i].x);
-		fp3_new(ctx->ep3_pre[i].y);
-		fp3_new(ctx->ep3_pre[i].z);
+		fp3_new(ctx->pre->ep3_pre[i].x);
+		fp3_new(ctx->pre->ep3_pre[i].y);
+		fp3_new(ctx->pre->ep3_pre[i].z);
 	}
 #endif
 #endif
@@ -245,9 +245,9 @@ void ep3_curve_clean(void) {
 	if (ctx != NULL) {
 #ifdef EP_PRECO
 		for (int i = 0; i < RLC_EP_TABLE; i++) {
-			fp3_free(ctx->ep3_pre[i].x);
-			fp3_free(ctx->ep3_pre[i].y);
-			fp3_free(ctx->ep3_pre[i].z);
+			fp3_free(ctx->pre->ep3_pre[i].x);
+			fp3_free(ctx->pre->ep3_pre[i].y);
+			fp3_free(ctx->pre->ep3_pre[i].z);
 		}
 #endif
 		bn_clean(&(ctx->ep3_r));
@@ -309,22 +309,22 @@ void ep4_curve_init(void) {
 
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		ctx->ep4_ptr[i] = &(ctx->ep4_pre[i]);
+		ctx->ep4_ptr[i] = &(ctx->pre->ep4_pre[i]);
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep4_new(ctx->ep4_g);
 	fp4_new(ctx->ep4_a);
 	fp4_new(ctx->ep4_b);
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		fp4_new(ctx->ep4_pre[i].x);
-		fp4_new(ctx->ep4_pre[i].y);
-		fp4_new(ctx->ep4_pre[i].z);
+		fp4_new(ctx->pre->ep4_pre[i].x);
+		fp4_new(ctx->pre->ep4_pre[i].y);
+		fp4_new(ctx->pre->ep4_pre[i].z);
 	}
 #endif
 #endif
@@ -337,9 +337,9 @@ void ep4_curve_clean(void) {
 	if (ctx != NULL) {
 #ifdef EP_PRECO
 		for (int i = 0; i < RLC_EP_TABLE; i++) {
-			fp4_free(ctx->ep4_pre[i].x);
-			fp4_free(ctx->ep4_pre[i].y);
-			fp4_free(ctx->ep4_pre[i].z);
+			fp4_free(ctx->pre->ep4_pre[i].x);
+			fp4_free(ctx->pre->ep4_pre[i].y);
+			fp4_free(ctx->pre->ep4_pre[i].z);
 		}
 #endif
 		bn_clean(&(ctx->ep4_r));
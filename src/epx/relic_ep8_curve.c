@@ -172,22 +172,22 @@ void ep8_curve_init(void) {
 
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		ctx->ep8_ptr[i] = &(ctx->ep8_pre[i]);
+		ctx->ep8_ptr[i] = &(ctx->pre->ep8_pre[i]);
 	}
 #endif
 
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	ep8_new(ctx->ep8_g);
 	fp8_new(ctx->ep8_a);
 	fp8_new(ctx->ep8_b);
 #endif
 
 #ifdef EP_PRECO
-#if ALLOC == DYNAMIC
+#if ALLOC != AUTO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
-		fp8_new(ctx->ep8_pre[i].x);
-		fp8_new(ctx->ep8_pre[i].y);
-		fp8_new(ctx->ep8_pre[i].z);
+		fp8_new(ctx->pre->ep8_pre[i].x);
+		fp8_new(ctx->pre->ep8_pre[i].y);
+		fp8_new(ctx->pre->ep8_pre[i].z);
 	}
 #endif
 #endif
@@ -200,9 +200,9 @@ void ep8_curve_clean(void) {
 	if (ctx != NULL) {
 #ifdef EP_PRECO
 		for (int i = 0; i < RLC_EP_TABLE; i++) {
-			fp8_free(ctx->ep8_pre[i].x);
-			fp8_free(ctx->ep8_pre[i].y);
-			fp8_free(ctx->ep8_pre[i].z);
+			fp8_free(ctx->pre->ep8_pre[i].x);
+			fp8_free(ctx->pre->ep8_pre[i].y);
+			fp8_free(ctx->pre->ep8_pre[i].z);
 		}
 #endif
 		bn_clean(&(ctx->ep8_r));
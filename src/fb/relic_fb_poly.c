@@ -132,14 +132,14 @@ static void find_solve(void) {
 						fb_set_bit(t0, i + 2 * k + 1, 1);
 					}
 				}
-				fb_copy(ctx->fb_half[l][j], t0);
+				fb_copy(ctx->pre->fb_half[l][j], t0);
 				for (k = 0; k < (RLC_FB_BITS - 1) / 2; k++) {
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_add(ctx->fb_half[l][j], ctx->fb_half[l][j], t0);
+					fb_sqr(ctx->pre->fb_half[l][j], ctx->pre->fb_half[l][j]);
+					fb_sqr(ctx->pre->fb_half[l][j], ctx->pre->fb_half[l][j]);
+					fb_add(ctx->pre->fb_half[l][j], ctx->pre->fb_half[l][j], t0);
 				}
 			}
-			fb_rsh(ctx->fb_half[l][j], ctx->fb_half[l][j], 1);
+			fb_rsh(ctx->pre->fb_half[l][j], ctx->pre->fb_half[l][j], 1);
 		}
 	}
 	RLC_CATCH_ANY {
@@ -168,7 +168,7 @@ static void find_srz(void) {
 
 #ifdef FB_PRECO
 	for (int i = 0; i <= 255; i++) {
-		fb_mul_dig(ctx->fb_tab_srz[i], ctx->fb_srz, i);
+		fb_mul_dig(ctx->pre->fb_tab_srz[i], ctx->fb_srz, i);
 	}
 #endif
 }
@@ -433,7 +433,7 @@ dig_t *fb_poly_get_srz(void) {
 const fb_st *fb_poly_tab_sqr(int i) {
 #if FB_INV == ITOHT || !defined(STRIP)
 	/* If ITOHT inversion is used and tables are precomputed, return them. */
-	return (const fb_st *)core_get()->fb_tab_sqr[i];
+	return (const fb_st *)core_get()->pre->fb_tab_sqr[i];
 #else
 	return NULL;
 #endif
@@ -443,7 +443,7 @@ const dig_t *fb_poly_tab_srz(int i) {
 #if FB_SRT == QUICK || !defined(STRIP)
 
 #ifdef FB_PRECO
-	return core_get()->fb_tab_srz[i];
+	return core_get()->pre->fb_tab_srz[i];
 #else
 	return NULL;
 #endif
@@ -473,7 +473,7 @@ void fb_poly_get_rdc(int *a, int *b, int *c) {
 
 const dig_t *fb_poly_get_slv(void) {
 #if FB_SLV == QUICK || !defined(STRIP)
-	return (dig_t *)&(core_get()->fb_half);
+	return (dig_t *)&(core_get()->pre->fb_half);
 #else
 	return NULL;
 #endif
@@ -30,6 +30,7 @@
  */
 
 #include "relic_core.h"
+#include "relic_fp_low.h"
 #include "relic_util.h"
 
 /*============================================================================*/
@@ -220,3 +221,65 @@ void fp_exp_dig(fp_t c, const fp_t a, dig_t b) {
 		fp_free(t);
 	}
 }
+
+void fp_exp_batch(fp_t *c, const fp_t *a, const bn_t b, int n) {
+	uint8_t win[RLC_FP_BITS + 1];
+	const dig_t *s[8];
+	dig_t *t[8];
+	fp_t r[8];
+	size_t l;
+	int m;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (bn_is_zero(b)) {
+		for (int i = 0; i < n; i++) {
+			fp_set_dig(c[i], 1);
+		}
+		return;
+	}
+
+	for (int j = 0; j < 8; j++) {
+		fp_null(r[j]);
+	}
+
+	RLC_TRY {
+		for (int j = 0; j < 8; j++) {
+			fp_new(r[j]);
+			t[j] = r[j];
+		}
+
+		/* The recoding of the exponent is the same for all bases. */
+		l = RLC_FP_BITS + 1;
+		bn_rec_slw(win, &l, b, RLC_WIDTH);
+
+		for (int k = 0; k < n; k += 8) {
+			/* Fill the unused lanes of the last group with the first base. */
+			m = RLC_MIN(8, n - k);
+			for (int j = 0; j < 8; j++) {
+				s[j] = a[k + (j < m ? j : 0)];
+			}
+
+			/* The backend keeps the whole chain in its own representation. */
+			fp_expm_x8_low(t, s, win, l);
+
+			for (int j = 0; j < m; j++) {
+				if (bn_sign(b) == RLC_NEG) {
+					fp_inv(c[k + j], r[j]);
+				} else {
+					fp_copy(c[k + j], r[j]);
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (int j = 0; j < 8; j++) {
+			fp_free(r[j]);
+		}
+	}
+}
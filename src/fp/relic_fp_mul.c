@@ -176,6 +176,18 @@ void fp_mul_dig(fp_t c, const fp_t a, dig_t b) {
 	}
 }
 
+void fp_mul_x8(fp_t *c, const fp_t *a, const fp_t *b) {
+	const dig_t *s[8], *t[8];
+	dig_t *r[8];
+
+	for (int i = 0; i < 8; i++) {
+		r[i] = c[i];
+		s[i] = a[i];
+		t[i] = b[i];
+	}
+	fp_mulm_x8_low(r, s, t);
+}
+
 #if FP_MUL == BASIC || !defined(STRIP)
 
 void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
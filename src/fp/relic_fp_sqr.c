@@ -160,6 +160,17 @@ static void fp_sqr_karat_imp(dv_t c, const fp_t a, size_t size, uint_t level) {
 /* Public definitions                                                         */
 /*============================================================================*/
 
+void fp_sqr_x8(fp_t *c, const fp_t *a) {
+	const dig_t *t[8];
+	dig_t *r[8];
+
+	for (int i = 0; i < 8; i++) {
+		r[i] = c[i];
+		t[i] = a[i];
+	}
+	fp_sqrm_x8_low(r, t);
+}
+
 #if FP_SQR == BASIC || !defined(STRIP)
 
 void fp_sqr_basic(fp_t c, const fp_t a) {
@@ -138,3 +138,61 @@ int fp_srt(fp_t c, const fp_t a) {
 	}
 	return r;
 }
+
+void fp_srt_batch(fp_t *c, int *r, const fp_t *a, int n) {
+	bn_t e;
+	fp_t u, *t;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (fp_prime_get_mod8() % 4 != 3) {
+		for (int i = 0; i < n; i++) {
+			r[i] = fp_srt(c[i], a[i]);
+		}
+		return;
+	}
+
+	bn_null(e);
+	fp_null(u);
+	t = RLC_ALLOCA(fp_t, n);
+	for (int i = 0; t != NULL && i < n; i++) {
+		fp_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(e);
+		fp_new(u);
+		for (int i = 0; i < n; i++) {
+			fp_new(t[i]);
+		}
+
+		/* Compute a^((p + 1)/4) for all elements at once. */
+		e->used = RLC_FP_DIGS;
+		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_add_dig(e, e, 1);
+		bn_rsh(e, e, 2);
+		fp_exp_batch(t, a, e, n);
+
+		for (int i = 0; i < n; i++) {
+			fp_sqr(u, t[i]);
+			r[i] = (fp_cmp(u, a[i]) == RLC_EQ);
+			fp_copy(c[i], t[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		fp_free(u);
+		for (int i = 0; t != NULL && i < n; i++) {
+			fp_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
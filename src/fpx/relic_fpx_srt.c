@@ -680,3 +680,98 @@ int fp16_srt(fp16_t c, const fp16_t a) {
 	}
 	return r;
 }
+
+void fp2_srt_batch(fp2_t *c, int *r, const fp2_t *a, int n) {
+	bn_t e;
+	fp2_t t, u;
+	fp_t *x, *y;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (fp_prime_get_mod8() % 4 != 3) {
+		for (int i = 0; i < n; i++) {
+			r[i] = fp2_srt(c[i], a[i]);
+		}
+		return;
+	}
+
+	bn_null(e);
+	fp2_null(t);
+	fp2_null(u);
+	x = RLC_ALLOCA(fp_t, n);
+	y = RLC_ALLOCA(fp_t, n);
+	for (int i = 0; x != NULL && y != NULL && i < n; i++) {
+		fp_null(x[i]);
+		fp_null(y[i]);
+	}
+
+	RLC_TRY {
+		if (x == NULL || y == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(e);
+		fp2_new(t);
+		fp2_new(u);
+		for (int i = 0; i < n; i++) {
+			fp_new(x[i]);
+			fp_new(y[i]);
+		}
+
+		/* Same formulas as fp2_srt(), with both exponentiations batched. */
+		e->used = RLC_FP_DIGS;
+		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_add_dig(e, e, 1);
+		bn_rsh(e, e, 2);
+
+		for (int i = 0; i < n; i++) {
+			fp_sqr(x[i], a[i][0]);
+			fp_sqr(y[i], a[i][1]);
+			fp_add(x[i], x[i], y[i]);
+		}
+		fp_exp_batch(x, (const fp_t *)x, e, n);
+		for (int i = 0; i < n; i++) {
+			fp_copy_sec(x[i], a[i][0], fp_is_zero(a[i][1]));
+			fp_add(x[i], x[i], a[i][0]);
+			fp_dbl(y[i], x[i]);
+		}
+
+		bn_sub_dig(e, e, 1);
+		fp_exp_batch(y, (const fp_t *)y, e, n);
+		for (int i = 0; i < n; i++) {
+			if (fp2_is_zero(a[i])) {
+				fp2_zero(c[i]);
+				r[i] = 1;
+				continue;
+			}
+			fp_mul(t[0], x[i], y[i]);
+			fp_mul(t[1], y[i], a[i][1]);
+			fp_dbl(u[0], x[i]);
+			fp_dbl(u[1], t[0]);
+			fp_sqr(u[1], u[1]);
+			fp_sub(u[0], u[0], u[1]);
+			int f = fp_is_zero(u[0]);
+			fp_neg(u[1], t[0]);
+			fp_copy(u[0], t[1]);
+			fp2_copy_sec(u, t, f);
+			fp2_sqr(t, u);
+			r[i] = (fp2_cmp(a[i], t) == RLC_EQ);
+			fp2_copy(c[i], u);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(e);
+		fp2_free(t);
+		fp2_free(u);
+		for (int i = 0; x != NULL && y != NULL && i < n; i++) {
+			fp_free(x[i]);
+			fp_free(y[i]);
+		}
+		RLC_FREE(x);
+		RLC_FREE(y);
+	}
+}
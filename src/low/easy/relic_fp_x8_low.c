@@ -0,0 +1,98 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Implementation of the low-level batched prime field multiplication
+ * functions.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_mulm_x8_low(dig_t **c, const dig_t **a, const dig_t **b) {
+	for (int i = 0; i < 8; i++) {
+		fp_mulm_low(c[i], a[i], b[i]);
+	}
+}
+
+void fp_sqrm_x8_low(dig_t **c, const dig_t **a) {
+	for (int i = 0; i < 8; i++) {
+		fp_sqrm_low(c[i], a[i]);
+	}
+}
+
+void fp_expm_x8_low(dig_t **c, const dig_t **a, const uint8_t *win,
+		size_t len) {
+	dig_t t[1 << (RLC_WIDTH - 1)][8][RLC_FP_DIGS], r[8][RLC_FP_DIGS];
+	dig_t *u[8], *v[8], *w[8];
+	int one = 1;
+
+	for (int i = 0; i < 8; i++) {
+		u[i] = t[0][i];
+		v[i] = r[i];
+		dv_copy(t[0][i], a[i], RLC_FP_DIGS);
+	}
+	fp_sqrm_x8_low(v, (const dig_t **)u);
+	for (int i = 1; i < (1 << (RLC_WIDTH - 1)); i++) {
+		for (int j = 0; j < 8; j++) {
+			w[j] = t[i][j];
+		}
+		fp_mulm_x8_low(w, (const dig_t **)u, (const dig_t **)v);
+		for (int j = 0; j < 8; j++) {
+			u[j] = w[j];
+		}
+	}
+	for (size_t i = 0; i < len; i++) {
+		if (win[i] == 0) {
+			if (!one) {
+				fp_sqrm_x8_low(v, (const dig_t **)v);
+			}
+		} else if (one) {
+			/* Skip the squarings of the identity before the first window. */
+			for (int j = 0; j < 8; j++) {
+				dv_copy(r[j], t[win[i] >> 1][j], RLC_FP_DIGS);
+			}
+			one = 0;
+		} else {
+			for (size_t j = 0; j < util_bits_dig(win[i]); j++) {
+				fp_sqrm_x8_low(v, (const dig_t **)v);
+			}
+			for (int j = 0; j < 8; j++) {
+				u[j] = t[win[i] >> 1][j];
+			}
+			fp_mulm_x8_low(v, (const dig_t **)v, (const dig_t **)u);
+		}
+	}
+	for (int i = 0; i < 8; i++) {
+		dv_copy(c[i], r[i], RLC_FP_DIGS);
+	}
+}
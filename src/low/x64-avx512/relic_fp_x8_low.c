@@ -0,0 +1,347 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Implementation of the low-level batched prime field multiplication
+ * functions using AVX-512 IFMA instructions.
+ *
+ * Each of the eight 64-bit lanes of a vector register holds one operand, and
+ * field elements are stored as limbs in radix 2^52 so that vpmadd52luq and
+ * vpmadd52huq can accumulate partial products without carry handling. The
+ * Montgomery reduction removes the same power of two as the scalar code, so
+ * results are interchangeable with fp_mulm_low().
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__) && WSIZE == 64 && FP_RDC == MONTY
+#include <immintrin.h>
+#endif
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__) && WSIZE == 64 && FP_RDC == MONTY
+
+/**
+ * Number of bits in a limb.
+ */
+#define LIMB_BITS	52
+
+/**
+ * Number of limbs in radix 2^52 needed to store values smaller than 2p.
+ */
+#define LIMBS		((FP_PRIME + LIMB_BITS) / LIMB_BITS)
+
+/**
+ * Number of limbs in a double-precision accumulator, including the columns
+ * touched by the reduction steps.
+ */
+#define ACCUM		(2 * LIMBS + 3)
+
+/**
+ * Mask selecting the lower 52 bits of a digit.
+ */
+#define LIMB_MASK	((((uint64_t)1) << LIMB_BITS) - 1)
+
+/**
+ * Converts a digit vector to radix 2^52.
+ *
+ * @param[out] r			- the limbs.
+ * @param[in] a				- the digit vector.
+ */
+static void fp_to_radix(uint64_t *r, const dig_t *a) {
+	for (int j = 0; j < LIMBS; j++) {
+		int w = (j * LIMB_BITS) / RLC_DIG, s = (j * LIMB_BITS) % RLC_DIG;
+		r[j] = a[w] >> s;
+		if (s > RLC_DIG - LIMB_BITS && w + 1 < RLC_FP_DIGS) {
+			r[j] |= a[w + 1] << (RLC_DIG - s);
+		}
+		r[j] &= LIMB_MASK;
+	}
+}
+
+/**
+ * Converts eight digit vectors to radix 2^52, one per lane.
+ *
+ * @param[out] r			- the limbs.
+ * @param[in] a				- the addresses of the digit vectors.
+ */
+static void fp_to_limbs(__m512i *r, const dig_t **a) {
+	const __m512i mask = _mm512_set1_epi64(LIMB_MASK);
+	const __m512i idx = _mm512_loadu_si512((const void *)a);
+	__m512i d[RLC_FP_DIGS];
+
+	/* Transpose so that digit w of every operand sits in the same register. */
+	for (int w = 0; w < RLC_FP_DIGS; w++) {
+		d[w] = _mm512_i64gather_epi64(_mm512_add_epi64(idx,
+				_mm512_set1_epi64(w * sizeof(dig_t))), NULL, 1);
+	}
+	for (int j = 0; j < LIMBS; j++) {
+		int w = (j * LIMB_BITS) / RLC_DIG, s = (j * LIMB_BITS) % RLC_DIG;
+		r[j] = _mm512_srli_epi64(d[w], s);
+		if (s > RLC_DIG - LIMB_BITS && w + 1 < RLC_FP_DIGS) {
+			r[j] = _mm512_or_si512(r[j],
+					_mm512_slli_epi64(d[w + 1], RLC_DIG - s));
+		}
+		r[j] = _mm512_and_si512(r[j], mask);
+	}
+}
+
+/**
+ * Converts eight operands in radix 2^52 back to digit vectors.
+ *
+ * @param[out] c			- the addresses of the digit vectors.
+ * @param[in] r				- the limbs.
+ */
+static void fp_from_limbs(dig_t **c, const __m512i *r) {
+	const __m512i idx = _mm512_loadu_si512((const void *)c);
+	__m512i d[RLC_FP_DIGS];
+
+	for (int w = 0; w < RLC_FP_DIGS; w++) {
+		d[w] = _mm512_setzero_si512();
+	}
+	for (int j = 0; j < LIMBS; j++) {
+		int w = (j * LIMB_BITS) / RLC_DIG, s = (j * LIMB_BITS) % RLC_DIG;
+		d[w] = _mm512_or_si512(d[w], _mm512_slli_epi64(r[j], s));
+		if (s > RLC_DIG - LIMB_BITS && w + 1 < RLC_FP_DIGS) {
+			d[w + 1] = _mm512_or_si512(d[w + 1],
+					_mm512_srli_epi64(r[j], RLC_DIG - s));
+		}
+	}
+	for (int w = 0; w < RLC_FP_DIGS; w++) {
+		_mm512_i64scatter_epi64(NULL, _mm512_add_epi64(idx,
+				_mm512_set1_epi64(w * sizeof(dig_t))), d[w], 1);
+	}
+}
+
+/**
+ * Loads the prime and the Montgomery reduction constant in every lane.
+ *
+ * @param[out] l			- the limbs of the prime.
+ * @param[out] u			- the reduction constant modulo 2^52.
+ */
+static void fp_prime_limbs(__m512i *l, __m512i *u) {
+	uint64_t p[LIMBS];
+
+	fp_to_radix(p, fp_prime_get());
+	for (int j = 0; j < LIMBS; j++) {
+		l[j] = _mm512_set1_epi64(p[j]);
+	}
+	*u = _mm512_set1_epi64(*fp_prime_get_rdc() & LIMB_MASK);
+}
+
+/**
+ * Reduces eight double-precision accumulators modulo the prime, computing
+ * t * 2^(-RLC_FP_DIGS * RLC_DIG) mod p in each lane.
+ *
+ * @param[out] c			- the limbs of the results.
+ * @param[in,out] t			- the accumulators, destroyed on output.
+ * @param[in] l				- the limbs of the prime.
+ * @param[in] u				- the reduction constant modulo 2^52.
+ */
+static void fp_rdc_limbs(__m512i *c, __m512i *t, const __m512i *l,
+		__m512i u) {
+	const int q = (RLC_FP_DIGS * RLC_DIG) / LIMB_BITS;
+	const int r = (RLC_FP_DIGS * RLC_DIG) % LIMB_BITS;
+	const __m512i mask = _mm512_set1_epi64(LIMB_MASK);
+	const __m512i zero = _mm512_setzero_si512();
+	__m512i m, d, b, s[LIMBS], v[LIMBS];
+	__mmask8 k;
+
+	/* Montgomery reduction by whole limbs. */
+	for (int i = 0; i < q; i++) {
+		m = _mm512_madd52lo_epu64(zero, t[i], u);
+		for (int j = 0; j < LIMBS; j++) {
+			t[i + j] = _mm512_madd52lo_epu64(t[i + j], m, l[j]);
+			t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], m, l[j]);
+		}
+		t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], LIMB_BITS));
+	}
+	/* Finish with a partial step over the remaining r bits. */
+	if (r > 0) {
+		m = _mm512_madd52lo_epu64(zero, t[q], u);
+		m = _mm512_and_si512(m, _mm512_set1_epi64((((uint64_t)1) << r) - 1));
+		for (int j = 0; j < LIMBS; j++) {
+			t[q + j] = _mm512_madd52lo_epu64(t[q + j], m, l[j]);
+			t[q + j + 1] = _mm512_madd52hi_epu64(t[q + j + 1], m, l[j]);
+		}
+	}
+	/* Propagate carries and shift the result down by r bits. */
+	for (int i = q; i < ACCUM - 1; i++) {
+		t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], LIMB_BITS));
+		t[i] = _mm512_and_si512(t[i], mask);
+	}
+	for (int j = 0; j < LIMBS; j++) {
+		if (r > 0) {
+			s[j] = _mm512_or_si512(_mm512_srli_epi64(t[q + j], r),
+					_mm512_and_si512(_mm512_slli_epi64(t[q + j + 1],
+					LIMB_BITS - r), mask));
+		} else {
+			s[j] = t[q + j];
+		}
+	}
+	/* Subtract p once, keeping the original value where it borrows. */
+	b = zero;
+	for (int j = 0; j < LIMBS; j++) {
+		d = _mm512_add_epi64(_mm512_sub_epi64(s[j], l[j]), b);
+		b = _mm512_srai_epi64(d, LIMB_BITS);
+		v[j] = _mm512_and_si512(d, mask);
+	}
+	k = _mm512_cmpeq_epi64_mask(b, zero);
+	for (int j = 0; j < LIMBS; j++) {
+		c[j] = _mm512_mask_blend_epi64(k, s[j], v[j]);
+	}
+}
+
+/**
+ * Multiplies eight pairs of operands in radix 2^52 with Montgomery reduction.
+ * The results are fully reduced, so they can be fed to further operations.
+ *
+ * @param[out] c			- the limbs of the results.
+ * @param[in] a				- the limbs of the first operands.
+ * @param[in] b				- the limbs of the second operands.
+ * @param[in] l				- the limbs of the prime.
+ * @param[in] u				- the reduction constant modulo 2^52.
+ */
+static void fp_mul_limbs(__m512i *c, const __m512i *a, const __m512i *b,
+		const __m512i *l, __m512i u) {
+	__m512i t[ACCUM];
+
+	for (int i = 0; i < ACCUM; i++) {
+		t[i] = _mm512_setzero_si512();
+	}
+	for (int i = 0; i < LIMBS; i++) {
+		for (int j = 0; j < LIMBS; j++) {
+			t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], b[j]);
+			t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], b[j]);
+		}
+	}
+	fp_rdc_limbs(c, t, l, u);
+}
+
+/**
+ * Squares eight operands in radix 2^52 with Montgomery reduction.
+ *
+ * @param[out] c			- the limbs of the results.
+ * @param[in] a				- the limbs of the operands.
+ * @param[in] l				- the limbs of the prime.
+ * @param[in] u				- the reduction constant modulo 2^52.
+ */
+static void fp_sqr_limbs(__m512i *c, const __m512i *a, const __m512i *l,
+		__m512i u) {
+	__m512i t[ACCUM];
+
+	for (int i = 0; i < ACCUM; i++) {
+		t[i] = _mm512_setzero_si512();
+	}
+	/* Accumulate the products above the diagonal once and double them. */
+	for (int i = 0; i < LIMBS; i++) {
+		for (int j = i + 1; j < LIMBS; j++) {
+			t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], a[j]);
+			t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], a[j]);
+		}
+	}
+	for (int i = 0; i < 2 * LIMBS; i++) {
+		t[i] = _mm512_add_epi64(t[i], t[i]);
+	}
+	for (int i = 0; i < LIMBS; i++) {
+		t[2 * i] = _mm512_madd52lo_epu64(t[2 * i], a[i], a[i]);
+		t[2 * i + 1] = _mm512_madd52hi_epu64(t[2 * i + 1], a[i], a[i]);
+	}
+	fp_rdc_limbs(c, t, l, u);
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__) && WSIZE == 64 && FP_RDC == MONTY
+
+void fp_mulm_x8_low(dig_t **c, const dig_t **a, const dig_t **b) {
+	__m512i x[LIMBS], y[LIMBS], l[LIMBS], u;
+
+	fp_prime_limbs(l, &u);
+	fp_to_limbs(x, a);
+	fp_to_limbs(y, b);
+	fp_mul_limbs(x, x, y, l, u);
+	fp_from_limbs(c, x);
+}
+
+void fp_sqrm_x8_low(dig_t **c, const dig_t **a) {
+	__m512i x[LIMBS], l[LIMBS], u;
+
+	fp_prime_limbs(l, &u);
+	fp_to_limbs(x, a);
+	fp_sqr_limbs(x, x, l, u);
+	fp_from_limbs(c, x);
+}
+
+void fp_expm_x8_low(dig_t **c, const dig_t **a, const uint8_t *win,
+		size_t len) {
+	__m512i t[1 << (RLC_WIDTH - 1)][LIMBS], r[LIMBS], l[LIMBS], u;
+	int one = 1;
+
+	/* Convert only once and keep the whole chain in radix 2^52. */
+	fp_prime_limbs(l, &u);
+	fp_to_limbs(t[0], a);
+	fp_sqr_limbs(r, t[0], l, u);
+	for (int i = 1; i < (1 << (RLC_WIDTH - 1)); i++) {
+		fp_mul_limbs(t[i], t[i - 1], r, l, u);
+	}
+	for (size_t i = 0; i < len; i++) {
+		if (win[i] == 0) {
+			if (!one) {
+				fp_sqr_limbs(r, r, l, u);
+			}
+		} else if (one) {
+			/* Skip the squarings of the identity before the first window. */
+			for (int j = 0; j < LIMBS; j++) {
+				r[j] = t[win[i] >> 1][j];
+			}
+			one = 0;
+		} else {
+			for (size_t j = 0; j < util_bits_dig(win[i]); j++) {
+				fp_sqr_limbs(r, r, l, u);
+			}
+			fp_mul_limbs(r, r, t[win[i] >> 1], l, u);
+		}
+	}
+	fp_from_limbs(c, r);
+}
+
+#else
+
+/* Fall back to the portable loops when IFMA is not available. */
+#include "../easy/relic_fp_x8_low.c"
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Portable prime field multiplication, squaring and reduction compiled for
+ * the baseline x64 instruction set.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+
+#if defined(FP_LOW_BMI2)
+/* Suffix the functions below with the instruction set they are built for. */
+#undef fp_muln_low
+#define fp_muln_low	fp_muln_low_base
+#undef fp_mulm_low
+#define fp_mulm_low	fp_mulm_low_base
+#undef fp_sqrn_low
+#define fp_sqrn_low	fp_sqrn_low_base
+#undef fp_sqrm_low
+#define fp_sqrm_low	fp_sqrm_low_base
+#undef fp_rdcn_low
+#define fp_rdcn_low	fp_rdcn_low_base
+#endif
+
+#include "../easy/relic_fp_mul_low.c"
+#include "../easy/relic_fp_sqr_low.c"
+#include "../easy/relic_fp_rdc_low.c"
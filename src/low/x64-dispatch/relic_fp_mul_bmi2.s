@@ -0,0 +1,56 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Prime field multiplication in assembly for processors with the BMI2 and
+ * ADX instruction set extensions.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp_low.h"
+
+/* Suffix the functions below with the instruction set they are built for. */
+#undef fp_muln_low
+#define fp_muln_low	fp_muln_low_bmi2
+#undef fp_mulm_low
+#define fp_mulm_low	fp_mulm_low_bmi2
+
+#include "../x64-asm-6l/relic_fp_mul_low.s"
+
+.data
+
+/* The modulus words, private to this file. */
+p0: .quad P0
+p1: .quad P1
+p2: .quad P2
+p3: .quad P3
+p4: .quad P4
+p5: .quad P5
+
+#if defined(__linux__) && defined(__ELF__)
+/* The code does not need an executable stack. */
+.section .note.GNU-stack,"",%progbits
+#endif
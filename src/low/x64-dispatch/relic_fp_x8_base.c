@@ -0,0 +1,44 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Batched prime field multiplication and squaring compiled for the baseline
+ * x64 instruction set.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+
+/* Suffix the functions below with the instruction set they are built for. */
+#undef fp_mulm_x8_low
+#define fp_mulm_x8_low	fp_mulm_x8_low_base
+#undef fp_sqrm_x8_low
+#define fp_sqrm_x8_low	fp_sqrm_x8_low_base
+#undef fp_expm_x8_low
+#define fp_expm_x8_low	fp_expm_x8_low_base
+
+#include "../easy/relic_fp_x8_low.c"
@@ -0,0 +1,51 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level batched prime field multiplication
+ * functions, dispatched at runtime to the version for the processor.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+#include "relic_fp_low.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_mulm_x8_low(dig_t **c, const dig_t **a, const dig_t **b) {
+	core_get()->fp_mulm_x8_ptr(c, a, b);
+}
+
+void fp_sqrm_x8_low(dig_t **c, const dig_t **a) {
+	core_get()->fp_sqrm_x8_ptr(c, a);
+}
+
+void fp_expm_x8_low(dig_t **c, const dig_t **a, const uint8_t *win,
+		size_t len) {
+	core_get()->fp_expm_x8_ptr(c, a, win, len);
+}
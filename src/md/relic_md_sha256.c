@@ -29,11 +29,185 @@
  * @ingroup md
  */
 
+#include <string.h>
+
 #include "relic_conf.h"
 #include "relic_core.h"
 #include "relic_md.h"
 #include "sha.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if defined(__AVX2__)
+
+/**
+ * Number of messages hashed in parallel.
+ */
+#define LANES		8
+
+/**
+ * Round constants defined in FIPS 180-4, Section 4.2.2.
+ */
+static const uint32_t sh256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+	0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+	0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+	0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+	0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+	0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/**
+ * Initial hash value defined in FIPS 180-4, Section 5.3.3.
+ */
+static const uint32_t sh256_h0[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/**
+ * Rotates each 32-bit lane of a vector to the right.
+ */
+#define ROTR(X, N)															\
+	_mm256_or_si256(_mm256_srli_epi32(X, N), _mm256_slli_epi32(X, 32 - (N)))
+
+/**
+ * Compresses one message block in each of the eight lanes.
+ *
+ * @param[in,out] s			- the chaining values, one word per lane.
+ * @param[in] b				- the addresses of the message blocks.
+ */
+static void sh256_compress_x8(__m256i *s, const uint8_t **b) {
+	const __m256i swap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5,
+			6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1,
+			2, 3);
+	__m256i w[64], v[8], t0, t1;
+	uint32_t u[LANES];
+	int i, j;
+
+	/* Transpose the message blocks so that word t of every lane is in w[t]. */
+	for (i = 0; i < 16; i++) {
+		for (j = 0; j < LANES; j++) {
+			memcpy(&u[j], b[j] + 4 * i, sizeof(uint32_t));
+		}
+		w[i] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)u),
+				swap);
+	}
+	for (i = 16; i < 64; i++) {
+		t0 = _mm256_xor_si256(_mm256_xor_si256(ROTR(w[i - 15], 7),
+				ROTR(w[i - 15], 18)), _mm256_srli_epi32(w[i - 15], 3));
+		t1 = _mm256_xor_si256(_mm256_xor_si256(ROTR(w[i - 2], 17),
+				ROTR(w[i - 2], 19)), _mm256_srli_epi32(w[i - 2], 10));
+		w[i] = _mm256_add_epi32(_mm256_add_epi32(t0, t1),
+				_mm256_add_epi32(w[i - 7], w[i - 16]));
+	}
+
+	for (i = 0; i < 8; i++) {
+		v[i] = s[i];
+	}
+	for (i = 0; i < 64; i++) {
+		/* T1 = h + S1(e) + Ch(e, f, g) + K[t] + W[t]. */
+		t0 = _mm256_xor_si256(_mm256_xor_si256(ROTR(v[4], 6), ROTR(v[4], 11)),
+				ROTR(v[4], 25));
+		t1 = _mm256_xor_si256(_mm256_and_si256(v[4], v[5]),
+				_mm256_andnot_si256(v[4], v[6]));
+		t0 = _mm256_add_epi32(_mm256_add_epi32(v[7], t0),
+				_mm256_add_epi32(t1, _mm256_add_epi32(w[i],
+				_mm256_set1_epi32(sh256_k[i]))));
+		/* T2 = S0(a) + Maj(a, b, c). */
+		t1 = _mm256_xor_si256(_mm256_xor_si256(ROTR(v[0], 2), ROTR(v[0], 13)),
+				ROTR(v[0], 22));
+		t1 = _mm256_add_epi32(t1, _mm256_or_si256(_mm256_and_si256(v[0],
+				v[1]), _mm256_and_si256(v[2], _mm256_or_si256(v[0], v[1]))));
+		for (j = 7; j > 0; j--) {
+			v[j] = v[j - 1];
+		}
+		v[4] = _mm256_add_epi32(v[4], t0);
+		v[0] = _mm256_add_epi32(t0, t1);
+	}
+	for (i = 0; i < 8; i++) {
+		s[i] = _mm256_add_epi32(s[i], v[i]);
+	}
+}
+
+/**
+ * Hashes up to eight messages in parallel.
+ *
+ * @param[out] hash			- the digests, stored consecutively.
+ * @param[in] msg			- the messages to hash.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] n				- the number of messages.
+ */
+static void sh256_map_x8(uint8_t *hash, const uint8_t **msg, const size_t *len,
+		int n) {
+	uint8_t tail[LANES][128] = { { 0 } }, zero[64] = { 0 };
+	const uint8_t *b[LANES];
+	size_t full[LANES], blocks[LANES], max = 0, k;
+	uint32_t out[8][LANES];
+	__m256i s[8];
+	int i, j;
+
+	for (j = 0; j < LANES; j++) {
+		if (j < n) {
+			/* Pad the last partial block as in FIPS 180-4, Section 5.1.1. */
+			full[j] = len[j] / 64;
+			blocks[j] = (len[j] + 9 + 63) / 64;
+			k = len[j] - 64 * full[j];
+			memcpy(tail[j], msg[j] + 64 * full[j], k);
+			tail[j][k] = 0x80;
+			for (i = 0; i < 8; i++) {
+				tail[j][64 * (blocks[j] - full[j]) - 1 - i] =
+						(uint8_t)(((uint64_t)len[j] << 3) >> (8 * i));
+			}
+			max = RLC_MAX(max, blocks[j]);
+		} else {
+			full[j] = blocks[j] = 0;
+		}
+	}
+
+	for (i = 0; i < 8; i++) {
+		s[i] = _mm256_set1_epi32(sh256_h0[i]);
+	}
+	for (k = 0; k < max; k++) {
+		for (j = 0; j < LANES; j++) {
+			if (k < full[j]) {
+				b[j] = msg[j] + 64 * k;
+			} else if (k < blocks[j]) {
+				b[j] = tail[j] + 64 * (k - full[j]);
+			} else {
+				b[j] = zero;
+			}
+		}
+		sh256_compress_x8(s, b);
+		for (i = 0; i < 8; i++) {
+			_mm256_storeu_si256((__m256i *)out[i], s[i]);
+		}
+		for (j = 0; j < n; j++) {
+			if (k + 1 == blocks[j]) {
+				for (i = 0; i < 8; i++) {
+					hash[RLC_MD_LEN_SH256 * j + 4 * i] = out[i][j] >> 24;
+					hash[RLC_MD_LEN_SH256 * j + 4 * i + 1] = out[i][j] >> 16;
+					hash[RLC_MD_LEN_SH256 * j + 4 * i + 2] = out[i][j] >> 8;
+					hash[RLC_MD_LEN_SH256 * j + 4 * i + 3] = out[i][j];
+				}
+			}
+		}
+	}
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -57,4 +231,18 @@ void md_map_sh256(uint8_t *hash, const uint8_t *msg, size_t len) {
 	}
 }
 
+void md_map_sh256_batch(uint8_t *hash, const uint8_t *msg[],
+		const size_t len[], int n) {
+#if defined(__AVX2__)
+	for (int i = 0; i < n; i += LANES) {
+		sh256_map_x8(hash + RLC_MD_LEN_SH256 * i, msg + i, len + i,
+				RLC_MIN(LANES, n - i));
+	}
+#else
+	for (int i = 0; i < n; i++) {
+		md_map_sh256(hash + RLC_MD_LEN_SH256 * i, msg[i], len[i]);
+	}
+#endif
+}
+
 #endif
@@ -33,6 +33,7 @@
 
 #include "relic_conf.h"
 #include "relic_core.h"
+#include "relic_md.h"
 #include "sha.h"
 
 /*============================================================================*/
@@ -62,9 +63,9 @@
  * Helper for make_md_xmd
  */
 #define _make_md_xmd(HName, HBlockSize, HHashSize, HContext, HReset, HInput, HResult)                             \
-	void HName(uint8_t *buf, int buf_len, const uint8_t *in, int in_len, const uint8_t *dst, int dst_len) {       \
+	void HName(uint8_t *buf, size_t buf_len, const uint8_t *in, size_t in_len, const uint8_t *dst, size_t dst_len) { \
 		const unsigned ell = (buf_len + HHashSize - 1) / HHashSize;                                               \
-		if (buf_len < 0 || ell > 255 || dst_len > 255) {                                                          \
+		if (ell > 255 || dst_len > 255) {                                                                         \
 			RLC_THROW(ERR_NO_VALID);                                                                              \
 			return;                                                                                               \
 		}                                                                                                         \
@@ -105,8 +106,7 @@
 			_check_md(HResult(&ctx, b_i));               /* finalize computation */                               \
                                                                                                                   \
 			/* copy into output buffer */                                                                         \
-			const int rem_after = buf_len - i * HHashSize;                                                        \
-			const int copy_len = HHashSize + (rem_after < 0 ? rem_after : 0);                                     \
+			const size_t copy_len = RLC_MIN(HHashSize, buf_len - (i - 1) * HHashSize);                            \
 			memcpy(buf + (i - 1) * HHashSize, b_i, copy_len);                                                     \
 		}                                                                                                         \
 	}
@@ -130,3 +130,88 @@ make_md_xmd(SHA384, sh384)
 #if MD_MAP == SH512 || !defined(STRIP)
 make_md_xmd(SHA512, sh512)
 #endif
+
+void md_xmd_batch(uint8_t *buf, size_t buf_len, const uint8_t *in[],
+		const size_t in_len[], int n, const uint8_t *dst, size_t dst_len) {
+#if MD_MAP == SH256
+	const size_t ell = (buf_len + RLC_MD_LEN_SH256 - 1) / RLC_MD_LEN_SH256;
+	const size_t pre = SHA256_Message_Block_Size + dst_len + 4;
+	const size_t len = RLC_MD_LEN_SH256 + dst_len + 2;
+	const uint8_t l_i_b_0_str[] = {buf_len >> 8, buf_len & 0xff, 0, dst_len};
+	uint8_t b_0[8 * RLC_MD_LEN_SH256], b_i[8 * RLC_MD_LEN_SH256], *s, *t;
+	const uint8_t *m[8];
+	size_t i, j, k, c, l[8], size, copy_len;
+
+	if (ell > 255 || dst_len > 255) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	/* Messages are processed in groups of eight to fill the SHA-256 lanes. */
+	size = 0;
+	for (k = 0; k < (size_t)n; k += 8) {
+		c = 0;
+		for (j = k; j < RLC_MIN(k + 8, (size_t)n); j++) {
+			c += pre + in_len[j];
+		}
+		size = RLC_MAX(size, c);
+	}
+	t = RLC_ALLOCA(uint8_t, size);
+	if (n > 0 && t == NULL) {
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (k = 0; k < (size_t)n; k += 8) {
+		c = RLC_MIN(8, n - k);
+
+		/* b_0 = H(Z_pad || msg || l_i_b_str || I2OSP(0, 1) || DST_prime). */
+		s = t;
+		for (j = 0; j < c; j++) {
+			m[j] = s;
+			l[j] = pre + in_len[k + j];
+			memset(s, 0, SHA256_Message_Block_Size);
+			s += SHA256_Message_Block_Size;
+			memcpy(s, in[k + j], in_len[k + j]);
+			s += in_len[k + j];
+			memcpy(s, l_i_b_0_str, 3);
+			memcpy(s + 3, dst, dst_len);
+			s[3 + dst_len] = dst_len;
+			s += dst_len + 4;
+		}
+		md_map_sh256_batch(b_0, m, l, c);
+
+		/* b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime). */
+		memset(b_i, 0, sizeof(b_i));
+		for (i = 1; i <= ell; i++) {
+			for (j = 0; j < c; j++) {
+				s = t + j * len;
+				for (size = 0; size < RLC_MD_LEN_SH256; size++) {
+					s[size] = b_0[j * RLC_MD_LEN_SH256 + size] ^
+							b_i[j * RLC_MD_LEN_SH256 + size];
+				}
+				s[RLC_MD_LEN_SH256] = i;
+				memcpy(s + RLC_MD_LEN_SH256 + 1, dst, dst_len);
+				s[RLC_MD_LEN_SH256 + 1 + dst_len] = dst_len;
+				m[j] = s;
+				l[j] = len;
+			}
+			md_map_sh256_batch(b_i, m, l, c);
+
+			copy_len = RLC_MIN(RLC_MD_LEN_SH256,
+					buf_len - (i - 1) * RLC_MD_LEN_SH256);
+			for (j = 0; j < c; j++) {
+				memcpy(buf + (k + j) * buf_len + (i - 1) * RLC_MD_LEN_SH256,
+						b_i + j * RLC_MD_LEN_SH256, copy_len);
+			}
+		}
+	}
+	RLC_FREE(t);
+#elif MD_MAP == SH224 || MD_MAP == SH384 || MD_MAP == SH512
+	for (int j = 0; j < n; j++) {
+		md_xmd(buf + j * buf_len, buf_len, in[j], in_len[j], dst, dst_len);
+	}
+#else
+	RLC_THROW(ERR_NO_CONFIG);
+#endif
+}
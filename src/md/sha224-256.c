@@ -38,6 +38,10 @@
 
 #include "sha.h"
 
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
 /* Define the SHA shift, rotate left and rotate right macro */
 #define SHA256_SHR(bits,word)      ((word) >> (bits))
 #define SHA256_ROTL(bits,word)                         \
@@ -420,6 +424,71 @@ static void SHA224_256PadMessage(SHA256Context *context,
   SHA224_256ProcessMessageBlock(context);
 }
 
+#if defined(__SHA__) && defined(__SSE4_1__)
+/*
+ * SHA224_256ProcessMessageBlockNI
+ *
+ * Description:
+ *   This function will process the next 512 bits of the message
+ *   using the Intel SHA extensions. The state is kept in the
+ *   ABEF/CDGH word order expected by the sha256rnds2 instruction.
+ *
+ * Parameters:
+ *   H: [in/out]
+ *     The intermediate hash value to update.
+ *   block: [in]
+ *     The 64-byte message block.
+ *   K: [in]
+ *     The round constants.
+ *
+ * Returns:
+ *   Nothing.
+ */
+static void SHA224_256ProcessMessageBlockNI(uint32_t *H,
+  const uint8_t *block, const uint32_t *K)
+{
+  const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+      0x0405060700010203ULL);
+  __m128i STATE0, STATE1, ABEF, CDGH, MSG, TMP, M[4];
+  int j;
+
+  TMP = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&H[0]), 0xB1);
+  STATE1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&H[4]), 0x1B);
+  STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);
+  STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);
+  ABEF = STATE0;
+  CDGH = STATE1;
+
+  for (j = 0; j < 4; j++)
+    M[j] = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)(block + 16 * j)), MASK);
+
+  for (j = 0; j < 16; j++) {
+    if (j >= 4) {
+      /* W[4j..4j+3] from W[4j-16..4j-1]. */
+      TMP = _mm_alignr_epi8(M[(j - 1) & 3], M[(j - 2) & 3], 4);
+      MSG = _mm_sha256msg1_epu32(M[j & 3], M[(j - 3) & 3]);
+      MSG = _mm_add_epi32(MSG, TMP);
+      M[j & 3] = _mm_sha256msg2_epu32(MSG, M[(j - 1) & 3]);
+    }
+    MSG = _mm_add_epi32(M[j & 3],
+        _mm_loadu_si128((const __m128i *)&K[4 * j]));
+    STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+    MSG = _mm_shuffle_epi32(MSG, 0x0E);
+    STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+  }
+
+  STATE0 = _mm_add_epi32(STATE0, ABEF);
+  STATE1 = _mm_add_epi32(STATE1, CDGH);
+  TMP = _mm_shuffle_epi32(STATE0, 0x1B);
+  STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);
+  STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);
+  STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);
+  _mm_storeu_si128((__m128i *)&H[0], STATE0);
+  _mm_storeu_si128((__m128i *)&H[4], STATE1);
+}
+#endif
+
 /*
  * SHA224_256ProcessMessageBlock
  *
@@ -457,6 +526,10 @@ static void SHA224_256ProcessMessageBlock(SHA256Context *context)
       0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
       0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
   };
+#if defined(__SHA__) && defined(__SSE4_1__)
+  SHA224_256ProcessMessageBlockNI(context->Intermediate_Hash,
+      context->Message_Block, K);
+#else
   int        t, t4;                   /* Loop counter */
   uint32_t   temp1, temp2;            /* Temporary word value */
   uint32_t   W[64];                   /* Word sequence */
@@ -505,6 +578,7 @@ static void SHA224_256ProcessMessageBlock(SHA256Context *context)
   context->Intermediate_Hash[5] += F;
   context->Intermediate_Hash[6] += G;
   context->Intermediate_Hash[7] += H;
+#endif
 
   context->Message_Block_Index = 0;
 }
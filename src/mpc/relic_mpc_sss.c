@@ -40,6 +40,8 @@
 int mpc_sss_gen(bn_t *x, bn_t *y, const bn_t secret, const bn_t order,
         size_t k, size_t n) {
     bn_t t, *a = RLC_ALLOCA(bn_t, k);
+    dig_t *c = NULL;
+    bn_pol_t p;
 
     if (k < 2 || n < k) {
         return RLC_ERR;
@@ -63,7 +65,23 @@ int mpc_sss_gen(bn_t *x, bn_t *y, const bn_t secret, const bn_t order,
         }
         for (int i = 0; i < n; i++) {
             bn_set_dig(x[i], i + 1);
-            bn_evl(y[i], a, x[i], order, k);
+        }
+        if (k * n < RLC_BN_POL * RLC_BN_POL || bn_is_even(order)) {
+            for (int i = 0; i < n; i++) {
+                bn_evl(y[i], a, x[i], order, k);
+            }
+        } else {
+            /* Evaluate on all points at once with a remainder tree. */
+            bn_pol_pre(p, order);
+            c = (dig_t *)calloc((k + 2 * n) * p->w, sizeof(dig_t));
+            if (c == NULL) {
+                RLC_THROW(ERR_NO_MEMORY);
+            } else {
+                bn_pol_set(c, a, k, p);
+                bn_pol_set(c + k * p->w, x, n, p);
+                bn_pol_evl(c + (k + n) * p->w, c, k, c + k * p->w, n, p);
+                bn_pol_get(y, c + (k + n) * p->w, n, p);
+            }
         }
     } RLC_CATCH_ANY {
         RLC_THROW(ERR_CAUGHT);
@@ -73,6 +91,7 @@ int mpc_sss_gen(bn_t *x, bn_t *y, const bn_t secret, const bn_t order,
             bn_free(a[i]);
         }
         RLC_FREE(a);
+        free(c);
     }
 
     return RLC_OK;
@@ -39,6 +39,7 @@
 
 void pc_core_init(void) {
 	gt_new(core_get()->gt_g);
+	pc_core_reset();
 }
 
 void pc_core_calc(void) {
@@ -75,3 +76,7 @@ void pc_core_clean(void) {
 		gt_free(core_get()->gt_g);
 	}
 }
+
+void pc_core_reset(void) {
+	memset(core_get()->pc_val, 0, sizeof(core_get()->pc_val));
+}
@@ -0,0 +1,331 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of discrete logarithms in small ranges for the groups of the
+ * pairing.
+ *
+ * @ingroup pc
+ */
+
+#include "relic_pc.h"
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of baby steps normalized together when building a table.
+ */
+#define PC_DLOG_CHUNK		64
+
+/**
+ * Identifier written at the start of serialized tables.
+ */
+#define PC_DLOG_MAGIC		0x31474F4C44434C52ULL
+
+/**
+ * Number of 64-bit words in the header of serialized tables.
+ */
+#define PC_DLOG_HEAD		4
+
+/**
+ * Computes the fingerprint of an encoded group element with FNV-1a.
+ *
+ * @param[in] bin			- the encoded element.
+ * @param[in] len			- the number of bytes.
+ * @return the fingerprint.
+ */
+static uint64_t pc_dlog_map(const uint8_t *bin, size_t len) {
+	uint64_t h = 0xCBF29CE484222325ULL;
+
+	for (size_t i = 0; i < len; i++) {
+		h = (h ^ bin[i]) * 0x100000001B3ULL;
+	}
+	return h;
+}
+
+/**
+ * Computes the fingerprint of an element of G_1.
+ *
+ * @param[in] a				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t g1_dlog_map(const g1_t a) {
+	uint8_t bin[RLC_GT_EMBED * RLC_FP_BYTES + 1];
+	size_t len = g1_size_bin(a, 1);
+
+	g1_write_bin(bin, len, a, 1);
+	return pc_dlog_map(bin, len);
+}
+
+/**
+ * Computes the fingerprint of an element of G_2.
+ *
+ * @param[in] a				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t g2_dlog_map(const g2_t a) {
+	uint8_t bin[RLC_GT_EMBED * RLC_FP_BYTES + 1];
+	size_t len = g2_size_bin(a, 1);
+
+	g2_write_bin(bin, len, a, 1);
+	return pc_dlog_map(bin, len);
+}
+
+/**
+ * Computes the fingerprint of an element of G_T.
+ *
+ * @param[in] a				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t gt_dlog_map(const gt_t a) {
+	uint8_t bin[RLC_GT_EMBED * RLC_FP_BYTES + 1];
+	size_t len = gt_size_bin(a, 0);
+
+	gt_write_bin(bin, len, a, 0);
+	return pc_dlog_map(bin, len);
+}
+
+/**
+ * Allocates an empty table of baby steps.
+ *
+ * @param[out] t			- the table.
+ * @param[in] id			- the fingerprint of the base.
+ * @param[in] m				- the number of baby steps.
+ */
+static void pc_dlog_new(pc_dlog_t t, uint64_t id, dig_t m) {
+	/* Keep the load factor at most one half for short probe sequences. */
+	for (t->len = 2; t->len < 2 * (uint64_t)m; t->len <<= 1);
+	t->id = id;
+	t->m = m;
+	t->own = 1;
+	t->key = (uint64_t *)calloc(t->len, sizeof(uint64_t));
+	t->val = (uint32_t *)calloc(t->len, sizeof(uint32_t));
+	if (t->key == NULL || t->val == NULL) {
+		free(t->key);
+		free(t->val);
+		t->key = NULL;
+		t->val = NULL;
+		RLC_THROW(ERR_NO_MEMORY);
+	}
+}
+
+/**
+ * Inserts a baby step in a table.
+ *
+ * @param[in,out] t			- the table.
+ * @param[in] key			- the fingerprint of the baby step.
+ * @param[in] j				- the exponent of the baby step.
+ */
+static void pc_dlog_add(pc_dlog_t t, uint64_t key, uint32_t j) {
+	uint64_t i = key & (t->len - 1), n;
+
+	for (n = 0; n < t->len && t->val[i] != 0; n++) {
+		i = (i + 1) & (t->len - 1);
+	}
+	if (n == t->len) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+	t->key[i] = key;
+	t->val[i] = j;
+}
+
+/**
+ * Finds the next baby step with a given fingerprint in a table.
+ *
+ * @param[in] t				- the table.
+ * @param[in] key			- the fingerprint.
+ * @param[in,out] i			- the slot where the search continues.
+ * @param[in,out] n			- the number of slots probed so far.
+ * @return the exponent of the baby step, or zero if there are no more.
+ */
+static uint32_t pc_dlog_get(const pc_dlog_t t, uint64_t key, uint64_t *i,
+		uint64_t *n) {
+	uint64_t l;
+	uint32_t j;
+
+	/* Never probe more than the whole table, even if it has no empty slot. */
+	while (*n < t->len && (j = t->val[*i]) != 0) {
+		l = *i;
+		*i = (*i + 1) & (t->len - 1);
+		(*n)++;
+		if (t->key[l] == key) {
+			return j;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Chooses the jump of a kangaroo from the fingerprint of its position.
+ *
+ * @param[in] key			- the fingerprint.
+ * @param[in] salt			- the number of the attempt, to change the walk.
+ * @param[in] n				- the number of jumps.
+ * @return the index of the jump.
+ */
+static int pc_dlog_jmp(uint64_t key, int salt, int n) {
+	key ^= (uint64_t)salt * 0x9E3779B97F4A7C15ULL;
+	key *= 0xBF58476D1CE4E5B9ULL;
+	return (int)((key >> 32) % n);
+}
+
+/**
+ * Computes the number of power-of-two jumps of the kangaroos in a range, such
+ * that the mean jump is close to half the square root of the range length.
+ *
+ * @param[out] mean			- the mean jump.
+ * @param[in] w				- the length of the range.
+ * @return the number of jumps.
+ */
+static int pc_dlog_len(dig_t *mean, dig_t w) {
+	dig_t q = 1;
+	int n;
+
+	while (q < w / q) {
+		q <<= 1;
+	}
+	*mean = RLC_MAX(q / 2, 1);
+	for (n = 1; n < RLC_DIG - 1 && ((((dig_t)1) << n) - 1) / n < *mean; n++);
+	return n;
+}
+
+/**
+ * Normalizes elements of G_T, which are always kept in a unique form.
+ *
+ * @param[out] r			- the results.
+ * @param[in] t				- the elements to normalize.
+ * @param[in] n				- the number of elements.
+ */
+static void gt_dlog_sim(gt_t *r, gt_t *t, int n) {
+	for (int i = 0; i < n; i++) {
+		gt_copy(r[i], t[i]);
+	}
+}
+
+/* Instantiate the baby-step giant-step and kangaroo methods for each group. */
+#include "relic_pc_dlog_tmpl.h"
+
+TMPL_DLOG_BSGS_IMP(g1, g1_add, g1_neg, g1_mul_dig, g1_norm, g1_is_infty);
+TMPL_DLOG_KAN_IMP(g1, g1_add, g1_dbl, g1_mul_dig, g1_norm, g1_norm_sim);
+
+TMPL_DLOG_BSGS_IMP(g2, g2_add, g2_neg, g2_mul_dig, g2_norm, g2_is_infty);
+TMPL_DLOG_KAN_IMP(g2, g2_add, g2_dbl, g2_mul_dig, g2_norm, g2_norm_sim);
+
+TMPL_DLOG_BSGS_IMP(gt, gt_mul, gt_inv, gt_exp_dig, gt_copy, gt_is_unity);
+TMPL_DLOG_KAN_IMP(gt, gt_mul, gt_sqr, gt_exp_dig, gt_copy, gt_dlog_sim);
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+TMPL_DLOG_PRE_IMP(g1, g1_add, g1_set_infty, g1_norm_sim);
+TMPL_DLOG_IMP(g1, g1_is_infty);
+
+TMPL_DLOG_PRE_IMP(g2, g2_add, g2_set_infty, g2_norm_sim);
+TMPL_DLOG_IMP(g2, g2_is_infty);
+
+TMPL_DLOG_PRE_IMP(gt, gt_mul, gt_set_unity, gt_dlog_sim);
+TMPL_DLOG_IMP(gt, gt_is_unity);
+
+size_t pc_dlog_size(const pc_dlog_t t) {
+	return PC_DLOG_HEAD * sizeof(uint64_t) +
+			t->len * (sizeof(uint64_t) + sizeof(uint32_t));
+}
+
+void pc_dlog_write(uint8_t *bin, size_t len, const pc_dlog_t t) {
+	uint64_t head[PC_DLOG_HEAD] = { PC_DLOG_MAGIC, t->id, t->m, t->len };
+
+	if (len < pc_dlog_size(t)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+	/* The fingerprints come first so they stay aligned when mapped. */
+	memcpy(bin, head, sizeof(head));
+	bin += sizeof(head);
+	memcpy(bin, t->key, t->len * sizeof(uint64_t));
+	bin += t->len * sizeof(uint64_t);
+	memcpy(bin, t->val, t->len * sizeof(uint32_t));
+}
+
+void pc_dlog_read(pc_dlog_t t, const uint8_t *bin, size_t len) {
+	uint64_t head[PC_DLOG_HEAD], i, n;
+
+	t->key = NULL;
+	t->val = NULL;
+	t->len = t->m = 0;
+	t->own = 0;
+	if (len < sizeof(head)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+	memcpy(head, bin, sizeof(head));
+	if (head[0] != PC_DLOG_MAGIC || head[3] < 2 || (head[3] & (head[3] - 1))
+			|| head[2] == 0 || head[2] > head[3] / 2 ||
+			head[2] > UINT32_MAX || ((uintptr_t)bin % sizeof(uint64_t)) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+	t->id = head[1];
+	t->m = head[2];
+	t->len = head[3];
+	if (t->len > len || len < pc_dlog_size(t)) {
+		t->len = t->m = 0;
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+	t->key = (uint64_t *)(bin + sizeof(head));
+	t->val = (uint32_t *)(bin + sizeof(head) + t->len * sizeof(uint64_t));
+	/* Check that the table holds exactly the m baby steps, which leaves at
+	 * least half of the slots empty and bounds every probe sequence. */
+	for (i = n = 0; i < t->len; i++) {
+		if (t->val[i] != 0) {
+			n++;
+			if (t->val[i] > t->m) {
+				break;
+			}
+		}
+	}
+	if (i < t->len || n != t->m) {
+		t->key = NULL;
+		t->val = NULL;
+		t->len = t->m = 0;
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void pc_dlog_free(pc_dlog_t t) {
+	if (t->own) {
+		free(t->key);
+		free(t->val);
+	}
+	t->key = NULL;
+	t->val = NULL;
+	t->len = t->m = 0;
+	t->own = 0;
+}
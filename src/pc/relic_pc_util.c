@@ -30,6 +30,7 @@
 
 #include "relic_pc.h"
 #include "relic_core.h"
+#include "relic_md.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -43,6 +44,138 @@
  */
 #define gt_rand_imp(A)			RLC_CAT(RLC_GT_LOWER, rand)(A)
 
+/**
+ * Returns the slot of a digest in the table of elements known to be valid.
+ *
+ * @param[in] H				- the digest.
+ */
+#define pc_val_slot(H)			(((H)[0] | ((H)[1] << 8)) % RLC_PC_VAL)
+
+/**
+ * Maximum number of prime field elements in the coordinates of an element of
+ * G_1 or G_2, reached by curves with embedding degree 48.
+ */
+#define PC_VAL_FPS				16
+
+/**
+ * Computes the digest identifying a group element in affine coordinates under
+ * the current curve. The coordinates are hashed as stored, so the lookup costs
+ * neither an inversion nor a conversion.
+ *
+ * @param[out] h			- the digest.
+ * @param[in] c				- the prime field elements in the coordinates.
+ * @param[in] n				- the number of prime field elements.
+ */
+static void pc_val_map(uint8_t *h, const dig_t **c, int n) {
+	uint8_t bin[sizeof(int) + PC_VAL_FPS * RLC_FP_DIGS * sizeof(dig_t)];
+	size_t len = RLC_FP_DIGS * sizeof(dig_t);
+	int id = core_get()->ep_id;
+
+	memcpy(bin, &id, sizeof(int));
+	for (int i = 0; i < n; i++) {
+		memcpy(bin + sizeof(int) + i * len, c[i], len);
+	}
+	md_map_sh256(h, bin, sizeof(int) + n * len);
+}
+
+/**
+ * Checks if a G_1 element was already found to be valid. Only elements in
+ * affine coordinates are looked up and recorded.
+ *
+ * @param[out] h			- the digest of the element.
+ * @param[in] a				- the element to look up.
+ * @return a boolean value indicating if the element is known to be valid.
+ */
+static int g1_val_get(uint8_t *h, const g1_t a) {
+	const dig_t *c[2] = { a->x, a->y };
+
+	if (a->coord != BASIC) {
+		return 0;
+	}
+	pc_val_map(h, c, 2);
+	return memcmp(core_get()->pc_val[pc_val_slot(h)], h, RLC_PC_VLEN) == 0;
+}
+
+#if FP_PRIME < 1536
+
+/**
+ * Checks if a G_2 element was already found to be valid. Only elements in
+ * affine coordinates are looked up and recorded.
+ *
+ * @param[out] h			- the digest of the element.
+ * @param[in] a				- the element to look up.
+ * @return a boolean value indicating if the element is known to be valid.
+ */
+static int g2_val_get(uint8_t *h, const g2_t a) {
+	const int d = sizeof(a->x) / sizeof(fp_t);
+	const dig_t *c[2 * sizeof(a->x) / sizeof(fp_t)];
+
+	if (a->coord != BASIC) {
+		return 0;
+	}
+	for (int i = 0; i < d; i++) {
+		c[i] = ((const fp_t *)a->x)[i];
+		c[d + i] = ((const fp_t *)a->y)[i];
+	}
+	pc_val_map(h, c, 2 * d);
+	return memcmp(core_get()->pc_val[pc_val_slot(h)], h, RLC_PC_VLEN) == 0;
+}
+
+#endif
+
+/**
+ * Records the digest of an element found to be valid.
+ *
+ * @param[in] h				- the digest of the element.
+ */
+static void pc_val_add(const uint8_t *h) {
+	memcpy(core_get()->pc_val[pc_val_slot(h)], h, RLC_PC_VLEN);
+}
+
+/**
+ * Arguments shared by the workers checking a batch of elements.
+ */
+typedef struct {
+	/** The validity flags. */
+	int *r;
+	/** The elements to check, from G_1 or G_2. */
+	const void *a;
+	/** The number of elements. */
+	int n;
+} pc_val_t;
+
+/**
+ * Checks the G_1 elements of a batch assigned to a worker.
+ *
+ * @param[in,out] arg		- the arguments of the batch.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void g1_val_job(void *arg, int id, int cores) {
+	pc_val_t *b = (pc_val_t *)arg;
+	const g1_t *a = (const g1_t *)b->a;
+
+	for (int i = id; i < b->n; i += cores) {
+		b->r[i] = g1_is_valid(a[i]);
+	}
+}
+
+/**
+ * Checks the G_2 elements of a batch assigned to a worker.
+ *
+ * @param[in,out] arg		- the arguments of the batch.
+ * @param[in] id			- the worker index.
+ * @param[in] cores			- the number of workers.
+ */
+static void g2_val_job(void *arg, int id, int cores) {
+	pc_val_t *b = (pc_val_t *)arg;
+	const g2_t *a = (const g2_t *)b->a;
+
+	for (int i = id; i < b->n; i += cores) {
+		b->r[i] = g2_is_valid(a[i]);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -81,6 +214,7 @@ int g1_is_valid(const g1_t a) {
 	g1_t u, v, w;
 	size_t l0, l1, r = 0;
 	int8_t naf0[RLC_FP_BITS + 1], naf1[RLC_FP_BITS + 1];
+	uint8_t h[RLC_PC_VLEN];
 
 	if (g1_is_infty(a)) {
 		return 0;
@@ -103,6 +237,8 @@ int g1_is_valid(const g1_t a) {
 		if (bn_cmp_dig(n, 1) == RLC_EQ) {
 			/* If curve has prime order, simpler to check if point on curve. */
 			r = g1_on_curve(a);
+		} else if (g1_val_get(h, a)) {
+			r = 1;
 		} else {
 			fp_prime_get_par(n);
 			switch (ep_curve_is_pairf()) {
@@ -252,6 +388,9 @@ int g1_is_valid(const g1_t a) {
 					r = g1_on_curve(a) && (g1_cmp(u, a) == RLC_EQ);
 					break;
 			}
+			if (r && a->coord == BASIC) {
+				pc_val_add(h);
+			}
 		}
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -273,12 +412,17 @@ int g2_is_valid(const g2_t a) {
 	g2_t s, t, u, v, w;
 	bn_t n;
 	dig_t rem;
+	uint8_t h[RLC_PC_VLEN];
 	int r = 0;
 
 	if (g2_is_infty(a)) {
 		return 0;
 	}
 
+	if (g2_val_get(h, a)) {
+		return 1;
+	}
+
 	bn_null(n);
 	g2_null(s);
 	g2_null(t);
@@ -442,6 +586,9 @@ int g2_is_valid(const g2_t a) {
 				r = g2_on_curve(a) && (g2_cmp(u, a) == RLC_EQ);
 				break;
 		}
+		if (r && a->coord == BASIC) {
+			pc_val_add(h);
+		}
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
@@ -457,6 +604,24 @@ int g2_is_valid(const g2_t a) {
 #endif
 }
 
+void g1_is_valid_batch(int *r, const g1_t *a, int n) {
+	pc_val_t b;
+
+	b.r = r;
+	b.a = (const void *)a;
+	b.n = n;
+	core_run(g1_val_job, &b, RLC_MAX(1, n / RLC_EP_BATCH_PAR));
+}
+
+void g2_is_valid_batch(int *r, const g2_t *a, int n) {
+	pc_val_t b;
+
+	b.r = r;
+	b.a = (const void *)a;
+	b.n = n;
+	core_run(g2_val_job, &b, RLC_MAX(1, n / RLC_EP_BATCH_PAR));
+}
+
 int gt_is_valid(const gt_t a) {
 	bn_t n;
 	gt_t s, t, u, v, w;
@@ -230,6 +230,271 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, const ep2_t q, const ep_t p) {
 	}
 }
 
+/**
+ * Compute the Miller loop for optimal ate multi-pairings, including the final
+ * lines, but without the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the vector of first arguments in affine coordinates.
+ * @param[in] p				- the vector of second arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] a				- the loop parameter.
+ */
+static void pp_mil_sim_k12_oatep(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m,
+		bn_t a) {
+	int i;
+
+	fp12_set_dig(r, 1);
+	if (m == 0) {
+		return;
+	}
+
+	switch (ep_curve_is_pairf()) {
+		case EP_BN:
+			/* r = f_{|a|,Q}(P). */
+			pp_mil_k12(r, t, q, p, m, a);
+			if (bn_sign(a) == RLC_NEG) {
+				/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+				fp12_inv_cyc(r, r);
+			}
+			for (i = 0; i < m; i++) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(t[i], t[i]);
+				}
+				pp_fin_k12_oatep(r, t[i], q[i], p[i]);
+			}
+			break;
+		case EP_B12:
+			/* r = f_{|a|,Q}(P). */
+			pp_mil_k12(r, t, q, p, m, a);
+			if (bn_sign(a) == RLC_NEG) {
+				fp12_inv_cyc(r, r);
+			}
+			break;
+	}
+}
+
+/**
+ * Stores the coefficients of a line function evaluated at the point (1, 1)
+ * and clears the line function for the next evaluation.
+ *
+ * @param[out] c			- the line coefficients.
+ * @param[in,out] l			- the line function.
+ */
+static void pp_lin_get_k12(dig_t *c, fp12_t l) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp_copy(c, l[zero][zero][0]);
+	fp_copy(c + RLC_FP_DIGS, l[zero][zero][1]);
+	fp_copy(c + 2 * RLC_FP_DIGS, l[one][zero][0]);
+	fp_copy(c + 3 * RLC_FP_DIGS, l[one][zero][1]);
+	fp_copy(c + 4 * RLC_FP_DIGS, l[one][one][0]);
+	fp_copy(c + 5 * RLC_FP_DIGS, l[one][one][1]);
+	fp12_zero(l);
+}
+
+/**
+ * Evaluates a line function from its stored coefficients.
+ *
+ * @param[out] l			- the line function.
+ * @param[in] c				- the line coefficients.
+ * @param[in] p				- the point to evaluate the line function.
+ */
+static void pp_lin_set_k12(fp12_t l, dig_t *c, const ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp_mul(l[zero][zero][0], c, p->y);
+	fp_mul(l[zero][zero][1], c + RLC_FP_DIGS, p->y);
+	fp_mul(l[one][zero][0], c + 2 * RLC_FP_DIGS, p->x);
+	fp_mul(l[one][zero][1], c + 3 * RLC_FP_DIGS, p->x);
+	fp_copy(l[one][one][0], c + 4 * RLC_FP_DIGS);
+	fp_copy(l[one][one][1], c + 5 * RLC_FP_DIGS);
+}
+
+/**
+ * Multiplies an accumulator by the same precomputed line of several pairing
+ * arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[out] l			- the temporary line function.
+ * @param[in] q				- the precomputed arguments.
+ * @param[in] p				- the points to evaluate the line functions.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] k				- the index of the line.
+ */
+static void pp_lin_k12(fp12_t r, fp12_t l, pp_prep_st **q, ep_t *p, int m,
+		int k) {
+	for (int j = 0; j < m; j++) {
+		pp_lin_set_k12(l, q[j]->c + 6 * k * RLC_FP_DIGS, p[j]);
+		fp12_mul_dxs(r, r, l);
+	}
+}
+
+/**
+ * Computes the number of lines evaluated in the optimal ate Miller loop.
+ *
+ * @param[in] s				- the loop parameter in NAF form.
+ * @param[in] len			- the length of the loop parameter.
+ * @return the number of lines.
+ */
+static int pp_lin_cnt_k12(const int8_t *s, size_t len) {
+	int i, n = len - 1;
+
+	for (i = len - 2; i >= 0; i--) {
+		n += (s[i] != 0);
+	}
+	if (ep_curve_is_pairf() == EP_BN) {
+		n += 2;
+	}
+	return n;
+}
+
+/**
+ * Computes the optimal ate multi-pairing from precomputed G_2 arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_prep_k12(fp12_t r, const ep_t *p, pp_prep_st **q, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m), *_d = RLC_ALLOCA(ep_t, m);
+	pp_prep_st **_q = RLC_ALLOCA(pp_prep_st *, m);
+	fp12_t l;
+	bn_t a;
+	size_t len;
+	int i, j, k;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp12_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		fp12_new(l);
+		bn_new(a);
+		if (_p == NULL || _d == NULL || _q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_null(_d[i]);
+			ep_new(_p[i]);
+			ep_new(_d[i]);
+		}
+
+		fp_prime_get_par(a);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
+		len = bn_bits(a) + 1;
+		bn_rec_naf(s, &len, a, 2);
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && q[i]->n > 0) {
+				if (q[i]->n != pp_lin_cnt_k12(s, len)) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+				ep_norm(_p[j], p[i]);
+				/* Doubling lines are evaluated at a transformed point. */
+#if EP_ADD == BASIC
+				ep_neg(_d[j], _p[j]);
+#else
+				fp_add(_d[j]->x, _p[j]->x, _p[j]->x);
+				fp_add(_d[j]->x, _d[j]->x, _p[j]->x);
+				fp_neg(_d[j]->y, _p[j]->y);
+#endif
+				_q[j++] = q[i];
+			}
+		}
+
+		fp12_set_dig(r, 1);
+		if (j > 0) {
+			k = 0;
+			fp12_zero(l);
+			pp_lin_k12(r, l, _q, _d, j, k++);
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					fp12_sqr(r, r);
+					pp_lin_k12(r, l, _q, _d, j, k++);
+				}
+				if (s[i] != 0) {
+					pp_lin_k12(r, l, _q, _p, j, k++);
+				}
+			}
+			if (bn_sign(a) == RLC_NEG) {
+				/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+				fp12_inv_cyc(r, r);
+			}
+			if (ep_curve_is_pairf() == EP_BN) {
+				pp_lin_k12(r, l, _q, _p, j, k++);
+				pp_lin_k12(r, l, _q, _p, j, k++);
+			}
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_d[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_d);
+		RLC_FREE(_q);
+	}
+}
+
+/**
+ * Arguments shared by the workers of a parallel multi-pairing.
+ */
+typedef struct {
+	/** The first pairing arguments, in affine coordinates. */
+	ep_t *p;
+	/** The second pairing arguments, in affine coordinates. */
+	ep2_t *q;
+	/** The temporary points used in the Miller loop. */
+	ep2_t *t;
+	/** The partial Miller loops, one per worker. */
+	fp12_t *f;
+	/** The loop parameter. */
+	bn_st *a;
+	/** The number of pairings to evaluate. */
+	int m;
+} pp_par_k12_t;
+
+/**
+ * Computes the partial Miller loop over the pairs assigned to a worker.
+ *
+ * @param[in,out] arg		- the shared arguments.
+ * @param[in] id			- the worker identifier.
+ * @param[in] cores			- the number of workers.
+ */
+static void pp_par_k12_oatep(void *arg, int id, int cores) {
+	pp_par_k12_t *par = (pp_par_k12_t *)arg;
+	int i = (int)((long)id * par->m / cores);
+	int j = (int)((long)(id + 1) * par->m / cores);
+
+	pp_mil_sim_k12_oatep(par->f[id], par->t + i, par->q + i, par->p + i, j - i,
+			par->a);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -550,36 +815,90 @@ void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 		}
 
 		fp_prime_get_par(a);
-		fp12_set_dig(r, 1);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
 
+		pp_mil_sim_k12_oatep(r, t, _q, _p, j, a);
 		if (j > 0) {
-			switch (ep_curve_is_pairf()) {
-				case EP_BN:
-					bn_mul_dig(a, a, 6);
-					bn_add_dig(a, a, 2);
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k12(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
-						fp12_inv_cyc(r, r);
-					}
-					for (i = 0; i < j; i++) {
-						if (bn_sign(a) == RLC_NEG) {
-							ep2_neg(t[i], t[i]);
-						}
-						pp_fin_k12_oatep(r, t[i], _q[i], _p[i]);
-					}
-					pp_exp_k12(r, r);
-					break;
-				case EP_B12:
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k12(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						fp12_inv_cyc(r, r);
-					}
-					pp_exp_k12(r, r);
-					break;
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep2_free(_q[i]);
+			ep2_free(t[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_q);
+		RLC_FREE(t);
+	}
+}
+
+void pp_map_par_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m);
+	ep2_t *t = RLC_ALLOCA(ep2_t, m), *_q = RLC_ALLOCA(ep2_t, m);
+	fp12_t *f = RLC_ALLOCA(fp12_t, RLC_MAX(1, RLC_MIN(m, CORES)));
+	pp_par_k12_t par;
+	bn_t a;
+	int i, j, n = RLC_MAX(1, RLC_MIN(m, CORES));
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (_p == NULL || _q == NULL || t == NULL || f == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp12_null(f[i]);
+			fp12_new(f[i]);
+			fp12_set_dig(f[i], 1);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep2_null(_q[i]);
+			ep2_null(t[i]);
+			ep_new(_p[i]);
+			ep2_new(_q[i]);
+			ep2_new(t[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep2_norm(_q[j++], q[i]);
+			}
+		}
+
+		fp_prime_get_par(a);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
+
+		fp12_set_dig(r, 1);
+		if (j > 0) {
+			par.p = _p;
+			par.q = _q;
+			par.t = t;
+			par.f = f;
+			par.a = a;
+			par.m = j;
+			/* Each worker computes the Miller loop over a block of pairs. */
+			core_run(pp_par_k12_oatep, &par, RLC_MIN(j, n));
+			for (i = 0; i < n; i++) {
+				fp12_mul(r, r, f[i]);
 			}
+			/* The final exponentiation is shared by all pairs. */
+			pp_exp_k12(r, r);
 		}
 	}
 	RLC_CATCH_ANY {
@@ -587,6 +906,9 @@ void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 	}
 	RLC_FINALLY {
 		bn_free(a);
+		for (i = 0; i < n; i++) {
+			fp12_free(f[i]);
+		}
 		for (i = 0; i < m; i++) {
 			ep_free(_p[i]);
 			ep2_free(_q[i]);
@@ -595,7 +917,149 @@ void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 		RLC_FREE(_p);
 		RLC_FREE(_q);
 		RLC_FREE(t);
+		RLC_FREE(f);
 	}
 }
 
 #endif
+
+void pp_prep_k12(pp_prep_t r, const ep2_t q) {
+	ep2_t t, _q, q1, q2;
+	ep_t u;
+	fp12_t l;
+	bn_t a;
+	size_t len;
+	int i, k, n;
+	int8_t s[RLC_FP_BITS + 1];
+
+	ep2_null(t);
+	ep2_null(_q);
+	ep2_null(q1);
+	ep2_null(q2);
+	ep_null(u);
+	fp12_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		ep2_new(t);
+		ep2_new(_q);
+		ep2_new(q1);
+		ep2_new(q2);
+		ep_new(u);
+		fp12_new(l);
+		bn_new(a);
+
+		free(r->c);
+		r->c = NULL;
+		r->n = 0;
+
+		if (!ep2_is_infty(q) && (ep_curve_is_pairf() == EP_BN ||
+				ep_curve_is_pairf() == EP_B12)) {
+			fp_prime_get_par(a);
+			if (ep_curve_is_pairf() == EP_BN) {
+				bn_mul_dig(a, a, 6);
+				bn_add_dig(a, a, 2);
+			}
+			len = bn_bits(a) + 1;
+			bn_rec_naf(s, &len, a, 2);
+			n = pp_lin_cnt_k12(s, len);
+			r->c = (dig_t *)malloc(6 * n * RLC_FP_DIGS * sizeof(dig_t));
+			if (r->c == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+
+			/* Lines are evaluated at (1, 1) to isolate the coefficients. */
+			fp_set_dig(u->x, 1);
+			fp_set_dig(u->y, 1);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+			ep2_norm(_q, q);
+			ep2_copy(t, _q);
+			ep2_neg(q1, _q);
+
+			k = 0;
+			fp12_zero(l);
+			pp_dbl_k12(l, t, t, u);
+			pp_lin_get_k12(r->c + 6 * k++ * RLC_FP_DIGS, l);
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					pp_dbl_k12(l, t, t, u);
+					pp_lin_get_k12(r->c + 6 * k++ * RLC_FP_DIGS, l);
+				}
+				if (s[i] != 0) {
+					pp_add_k12(l, t, s[i] > 0 ? _q : q1, u);
+					pp_lin_get_k12(r->c + 6 * k++ * RLC_FP_DIGS, l);
+				}
+			}
+
+			if (ep_curve_is_pairf() == EP_BN) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(t, t);
+				}
+				fp2_set_dig(q1->z, 1);
+				fp2_set_dig(q2->z, 1);
+				ep2_frb(q1, _q, 1);
+				ep2_frb(q2, _q, 2);
+				ep2_neg(q2, q2);
+				pp_add_k12(l, t, q1, u);
+				pp_lin_get_k12(r->c + 6 * k++ * RLC_FP_DIGS, l);
+				pp_add_k12(l, t, q2, u);
+				pp_lin_get_k12(r->c + 6 * k++ * RLC_FP_DIGS, l);
+			}
+			r->n = k;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(t);
+		ep2_free(_q);
+		ep2_free(q1);
+		ep2_free(q2);
+		ep_free(u);
+		fp12_free(l);
+		bn_free(a);
+	}
+}
+
+void pp_map_prep_k12(fp12_t r, const ep_t p, const pp_prep_t q) {
+	ep_t _p[1];
+	pp_prep_st *_q[1];
+
+	ep_null(_p[0]);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+		ep_copy(_p[0], p);
+		_q[0] = (pp_prep_st *)q;
+		pp_mil_prep_k12(r, (const ep_t *)_p, _q, 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_prep_k12(fp12_t r, const ep_t *p, const pp_prep_t *q, int m) {
+	pp_prep_st **_q = RLC_ALLOCA(pp_prep_st *, m);
+	int i;
+
+	RLC_TRY {
+		if (_q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			_q[i] = (pp_prep_st *)q[i];
+		}
+		pp_mil_prep_k12(r, p, _q, m);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(_q);
+	}
+}
@@ -260,6 +260,210 @@ static void pp_fin_k18_oatep(fp18_t r, ep3_t t, const ep3_t q, const ep_t p,
     }
 }
 
+/**
+ * Stores the coefficients of a line function evaluated at the point (1, 1)
+ * and clears the line function for the next evaluation.
+ *
+ * @param[out] c			- the line coefficients.
+ * @param[in,out] l			- the line function.
+ */
+static void pp_lin_get_k18(dig_t *c, fp18_t l) {
+	int i, one = 1, zero = 0;
+
+	if (ep3_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	for (i = 0; i < 3; i++) {
+		fp_copy(c + i * RLC_FP_DIGS, l[zero][zero][i]);
+		fp_copy(c + (3 + i) * RLC_FP_DIGS, l[one][zero][i]);
+		fp_copy(c + (6 + i) * RLC_FP_DIGS, l[one][one][i]);
+	}
+	fp18_zero(l);
+}
+
+/**
+ * Evaluates a line function from its stored coefficients.
+ *
+ * @param[out] l			- the line function.
+ * @param[in] c				- the line coefficients.
+ * @param[in] p				- the point to evaluate the line function.
+ */
+static void pp_lin_set_k18(fp18_t l, dig_t *c, const ep_t p) {
+	int i, one = 1, zero = 0;
+
+	if (ep3_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	for (i = 0; i < 3; i++) {
+		fp_mul(l[zero][zero][i], c + i * RLC_FP_DIGS, p->y);
+		fp_mul(l[one][zero][i], c + (3 + i) * RLC_FP_DIGS, p->x);
+		fp_copy(l[one][one][i], c + (6 + i) * RLC_FP_DIGS);
+	}
+}
+
+/**
+ * Multiplies an accumulator by the same precomputed line of several pairing
+ * arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[out] l			- the temporary line function.
+ * @param[in] q				- the precomputed arguments.
+ * @param[in] p				- the points to evaluate the line functions.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] k				- the index of the line.
+ */
+static void pp_lin_k18(fp18_t r, fp18_t l, pp_prep_st **q, ep_t *p, int m,
+		int k) {
+	for (int j = 0; j < m; j++) {
+		pp_lin_set_k18(l, q[j]->c + 9 * k * RLC_FP_DIGS, p[j]);
+		fp18_mul_dxs(r, r, l);
+	}
+}
+
+/**
+ * Computes the number of lines evaluated in the optimal ate Miller loop.
+ *
+ * @param[in] s				- the loop parameter in NAF form.
+ * @param[in] len			- the length of the loop parameter.
+ * @return the number of lines.
+ */
+static int pp_lin_cnt_k18(const int8_t *s, size_t len) {
+	int i, n = len - 1;
+
+	for (i = len - 2; i >= 0; i--) {
+		n += (s[i] != 0);
+	}
+	switch (ep_curve_is_pairf()) {
+		case EP_K18:
+			n += 3;
+			break;
+		case EP_SG18:
+			n += 1;
+			break;
+	}
+	return n;
+}
+
+/**
+ * Computes the optimal ate multi-pairing from precomputed G_2 arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_prep_k18(fp18_t r, const ep_t *p, pp_prep_st **q, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m), *_d = RLC_ALLOCA(ep_t, m);
+	pp_prep_st **_q = RLC_ALLOCA(pp_prep_st *, m);
+	fp18_t l, u;
+	bn_t a;
+	size_t len;
+	int i, j, k;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp18_null(l);
+	fp18_null(u);
+	bn_null(a);
+
+	RLC_TRY {
+		fp18_new(l);
+		fp18_new(u);
+		bn_new(a);
+		if (_p == NULL || _d == NULL || _q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_null(_d[i]);
+			ep_new(_p[i]);
+			ep_new(_d[i]);
+		}
+
+		fp_prime_get_par(a);
+		len = bn_bits(a) + 1;
+		bn_rec_naf(s, &len, a, 2);
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && q[i]->n > 0) {
+				if (q[i]->n != pp_lin_cnt_k18(s, len)) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+				ep_norm(_p[j], p[i]);
+				/* Doubling lines are evaluated at a transformed point. */
+#if EP_ADD == BASIC
+				ep_neg(_d[j], _p[j]);
+#else
+				fp_add(_d[j]->x, _p[j]->x, _p[j]->x);
+				fp_add(_d[j]->x, _d[j]->x, _p[j]->x);
+				fp_neg(_d[j]->y, _p[j]->y);
+#endif
+				_q[j++] = q[i];
+			}
+		}
+
+		fp18_set_dig(r, 1);
+		if (j > 0) {
+			k = 0;
+			fp18_zero(l);
+			pp_lin_k18(r, l, _q, _d, j, k++);
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					fp18_sqr(r, r);
+					pp_lin_k18(r, l, _q, _d, j, k++);
+				}
+				if (s[i] != 0) {
+					pp_lin_k18(r, l, _q, _p, j, k++);
+				}
+			}
+			if (bn_sign(a) == RLC_NEG) {
+				/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+				fp18_inv_cyc(r, r);
+			}
+			switch (ep_curve_is_pairf()) {
+				case EP_K18:
+					for (i = 0; i < j; i++) {
+						fp18_zero(u);
+						pp_lin_set_k18(u, _q[i]->c + 9 * k * RLC_FP_DIGS, _d[i]);
+						pp_lin_set_k18(l, _q[i]->c + 9 * (k + 1) * RLC_FP_DIGS,
+								_p[i]);
+						fp18_mul_dxs(u, u, l);
+						fp18_frb(u, u, 1);
+						fp18_mul(r, r, u);
+					}
+					k += 2;
+					pp_lin_k18(r, l, _q, _p, j, k++);
+					break;
+				case EP_SG18:
+					fp18_frb(u, r, 3);
+					fp18_mul(r, r, u);
+					pp_lin_k18(r, l, _q, _p, j, k++);
+					break;
+			}
+			pp_exp_k18(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp18_free(l);
+		fp18_free(u);
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_d[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_d);
+		RLC_FREE(_q);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -668,3 +872,146 @@ void pp_map_sim_oatep_k18(fp18_t r, const ep_t *p, const ep3_t *q, int m) {
 }
 
 #endif
+
+void pp_prep_k18(pp_prep_t r, const ep3_t q) {
+	ep3_t t, _q, q1;
+	ep_t u;
+	fp18_t l;
+	bn_t a;
+	size_t len;
+	int i, k, n;
+	int8_t s[RLC_FP_BITS + 1];
+
+	ep3_null(t);
+	ep3_null(_q);
+	ep3_null(q1);
+	ep_null(u);
+	fp18_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		ep3_new(t);
+		ep3_new(_q);
+		ep3_new(q1);
+		ep_new(u);
+		fp18_new(l);
+		bn_new(a);
+
+		free(r->c);
+		r->c = NULL;
+		r->n = 0;
+
+		if (!ep3_is_infty(q) && (ep_curve_is_pairf() == EP_K18 ||
+				ep_curve_is_pairf() == EP_SG18 ||
+				ep_curve_is_pairf() == EP_FM18)) {
+			fp_prime_get_par(a);
+			len = bn_bits(a) + 1;
+			bn_rec_naf(s, &len, a, 2);
+			n = pp_lin_cnt_k18(s, len);
+			r->c = (dig_t *)malloc(9 * n * RLC_FP_DIGS * sizeof(dig_t));
+			if (r->c == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+
+			/* Lines are evaluated at (1, 1) to isolate the coefficients. */
+			fp_set_dig(u->x, 1);
+			fp_set_dig(u->y, 1);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+			ep3_norm(_q, q);
+			ep3_copy(t, _q);
+			ep3_neg(q1, _q);
+
+			k = 0;
+			fp18_zero(l);
+			pp_dbl_k18(l, t, t, u);
+			pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					pp_dbl_k18(l, t, t, u);
+					pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+				}
+				if (s[i] != 0) {
+					pp_add_k18(l, t, s[i] > 0 ? _q : q1, u);
+					pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+				}
+			}
+
+			if (bn_sign(a) == RLC_NEG) {
+				ep3_neg(t, t);
+			}
+			switch (ep_curve_is_pairf()) {
+				case EP_K18:
+					/* q1 = 3 * Q. */
+					pp_dbl_k18(l, q1, _q, u);
+					pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+					pp_add_k18(l, q1, _q, u);
+					pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+					pp_norm_k18(q1, q1);
+					ep3_frb(q1, q1, 1);
+					pp_add_k18(l, t, q1, u);
+					pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+					break;
+				case EP_SG18:
+					ep3_frb(t, t, 3);
+					ep3_frb(q1, _q, 2);
+					pp_add_k18(l, t, q1, u);
+					pp_lin_get_k18(r->c + 9 * k++ * RLC_FP_DIGS, l);
+					break;
+			}
+			r->n = k;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep3_free(t);
+		ep3_free(_q);
+		ep3_free(q1);
+		ep_free(u);
+		fp18_free(l);
+		bn_free(a);
+	}
+}
+
+void pp_map_prep_k18(fp18_t r, const ep_t p, const pp_prep_t q) {
+	ep_t _p[1];
+	pp_prep_st *_q[1];
+
+	ep_null(_p[0]);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+		ep_copy(_p[0], p);
+		_q[0] = (pp_prep_st *)q;
+		pp_mil_prep_k18(r, (const ep_t *)_p, _q, 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_prep_k18(fp18_t r, const ep_t *p, const pp_prep_t *q, int m) {
+	pp_prep_st **_q = RLC_ALLOCA(pp_prep_st *, m);
+	int i;
+
+	RLC_TRY {
+		if (_q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			_q[i] = (pp_prep_st *)q[i];
+		}
+		pp_mil_prep_k18(r, p, _q, m);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(_q);
+	}
+}
@@ -133,6 +133,182 @@ static void pp_mil_k24(fp24_t r, ep4_t *t, ep4_t *q, ep_t *p, int m, bn_t a) {
 	}
 }
 
+/**
+ * Stores the coefficients of a line function evaluated at the point (1, 1)
+ * and clears the line function for the next evaluation.
+ *
+ * @param[out] c			- the line coefficients.
+ * @param[in,out] l			- the line function.
+ */
+static void pp_lin_get_k24(dig_t *c, fp24_t l) {
+	int i, j, two = 1, one = 1;
+
+	if (ep4_curve_is_twist() == RLC_EP_MTYPE) {
+		two += 1;
+		one ^= 1;
+	}
+
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 2; j++) {
+			fp_copy(c + (2 * i + j) * RLC_FP_DIGS, l[0][1][i][j]);
+			fp_copy(c + (4 + 2 * i + j) * RLC_FP_DIGS, l[two][one][i][j]);
+			fp_copy(c + (8 + 2 * i + j) * RLC_FP_DIGS, l[0][0][i][j]);
+		}
+	}
+	fp24_zero(l);
+}
+
+/**
+ * Evaluates a line function from its stored coefficients.
+ *
+ * @param[out] l			- the line function.
+ * @param[in] c				- the line coefficients.
+ * @param[in] p				- the point to evaluate the line function.
+ */
+static void pp_lin_set_k24(fp24_t l, dig_t *c, const ep_t p) {
+	int i, j, two = 1, one = 1;
+
+	if (ep4_curve_is_twist() == RLC_EP_MTYPE) {
+		two += 1;
+		one ^= 1;
+	}
+
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 2; j++) {
+			fp_mul(l[0][1][i][j], c + (2 * i + j) * RLC_FP_DIGS, p->y);
+			fp_mul(l[two][one][i][j], c + (4 + 2 * i + j) * RLC_FP_DIGS, p->x);
+			fp_copy(l[0][0][i][j], c + (8 + 2 * i + j) * RLC_FP_DIGS);
+		}
+	}
+}
+
+/**
+ * Multiplies an accumulator by the same precomputed line of several pairing
+ * arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[out] l			- the temporary line function.
+ * @param[in] q				- the precomputed arguments.
+ * @param[in] p				- the points to evaluate the line functions.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] k				- the index of the line.
+ */
+static void pp_lin_k24(fp24_t r, fp24_t l, pp_prep_st **q, ep_t *p, int m,
+		int k) {
+	for (int j = 0; j < m; j++) {
+		pp_lin_set_k24(l, q[j]->c + 12 * k * RLC_FP_DIGS, p[j]);
+		fp24_mul_dxs(r, r, l);
+	}
+}
+
+/**
+ * Computes the number of lines evaluated in the optimal ate Miller loop.
+ *
+ * @param[in] s				- the loop parameter in NAF form.
+ * @param[in] len			- the length of the loop parameter.
+ * @return the number of lines.
+ */
+static int pp_lin_cnt_k24(const int8_t *s, size_t len) {
+	int i, n = len - 1;
+
+	for (i = len - 2; i >= 0; i--) {
+		n += (s[i] != 0);
+	}
+	return n;
+}
+
+/**
+ * Computes the optimal ate multi-pairing from precomputed G_2 arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the precomputed second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_prep_k24(fp24_t r, const ep_t *p, pp_prep_st **q, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m), *_d = RLC_ALLOCA(ep_t, m);
+	pp_prep_st **_q = RLC_ALLOCA(pp_prep_st *, m);
+	fp24_t l;
+	bn_t a;
+	size_t len;
+	int i, j, k;
+	int8_t s[RLC_FP_BITS + 1];
+
+	fp24_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		fp24_new(l);
+		bn_new(a);
+		if (_p == NULL || _d == NULL || _q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_null(_d[i]);
+			ep_new(_p[i]);
+			ep_new(_d[i]);
+		}
+
+		fp_prime_get_par(a);
+		len = bn_bits(a) + 1;
+		bn_rec_naf(s, &len, a, 2);
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && q[i]->n > 0) {
+				if (q[i]->n != pp_lin_cnt_k24(s, len)) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+				ep_norm(_p[j], p[i]);
+				/* Doubling lines are evaluated at a transformed point. */
+#if EP_ADD == BASIC
+				ep_neg(_d[j], _p[j]);
+#else
+				fp_add(_d[j]->x, _p[j]->x, _p[j]->x);
+				fp_add(_d[j]->x, _d[j]->x, _p[j]->x);
+				fp_neg(_d[j]->y, _p[j]->y);
+#endif
+				_q[j++] = q[i];
+			}
+		}
+
+		fp24_set_dig(r, 1);
+		if (j > 0) {
+			k = 0;
+			fp24_zero(l);
+			pp_lin_k24(r, l, _q, _d, j, k++);
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					fp24_sqr(r, r);
+					pp_lin_k24(r, l, _q, _d, j, k++);
+				}
+				if (s[i] != 0) {
+					pp_lin_k24(r, l, _q, _p, j, k++);
+				}
+			}
+			if (bn_sign(a) == RLC_NEG) {
+				fp24_inv_cyc(r, r);
+			}
+			pp_exp_k24(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp24_free(l);
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_d[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_d);
+		RLC_FREE(_q);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -247,3 +423,121 @@ void pp_map_sim_k24(fp24_t r, const ep_t *p, const ep4_t *q, int m) {
 }
 
 #endif
+
+void pp_prep_k24(pp_prep_t r, const ep4_t q) {
+	ep4_t t, _q, q1;
+	ep_t u;
+	fp24_t l;
+	bn_t a;
+	size_t len;
+	int i, k, n;
+	int8_t s[RLC_FP_BITS + 1];
+
+	ep4_null(t);
+	ep4_null(_q);
+	ep4_null(q1);
+	ep_null(u);
+	fp24_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		ep4_new(t);
+		ep4_new(_q);
+		ep4_new(q1);
+		ep_new(u);
+		fp24_new(l);
+		bn_new(a);
+
+		free(r->c);
+		r->c = NULL;
+		r->n = 0;
+
+		if (!ep4_is_infty(q) && ep_curve_is_pairf() == EP_B24) {
+			fp_prime_get_par(a);
+			len = bn_bits(a) + 1;
+			bn_rec_naf(s, &len, a, 2);
+			n = pp_lin_cnt_k24(s, len);
+			r->c = (dig_t *)malloc(12 * n * RLC_FP_DIGS * sizeof(dig_t));
+			if (r->c == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+
+			/* Lines are evaluated at (1, 1) to isolate the coefficients. */
+			fp_set_dig(u->x, 1);
+			fp_set_dig(u->y, 1);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+			ep4_norm(_q, q);
+			ep4_copy(t, _q);
+			ep4_neg(q1, _q);
+
+			k = 0;
+			fp24_zero(l);
+			pp_dbl_k24(l, t, t, u);
+			pp_lin_get_k24(r->c + 12 * k++ * RLC_FP_DIGS, l);
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					pp_dbl_k24(l, t, t, u);
+					pp_lin_get_k24(r->c + 12 * k++ * RLC_FP_DIGS, l);
+				}
+				if (s[i] != 0) {
+					pp_add_k24(l, t, s[i] > 0 ? _q : q1, u);
+					pp_lin_get_k24(r->c + 12 * k++ * RLC_FP_DIGS, l);
+				}
+			}
+			r->n = k;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep4_free(t);
+		ep4_free(_q);
+		ep4_free(q1);
+		ep_free(u);
+		fp24_free(l);
+		bn_free(a);
+	}
+}
+
+void pp_map_prep_k24(fp24_t r, const ep_t p, const pp_prep_t q) {
+	ep_t _p[1];
+	pp_prep_st *_q[1];
+
+	ep_null(_p[0]);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+		ep_copy(_p[0], p);
+		_q[0] = (pp_prep_st *)q;
+		pp_mil_prep_k24(r, (const ep_t *)_p, _q, 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_prep_k24(fp24_t r, const ep_t *p, const pp_prep_t *q, int m) {
+	pp_prep_st **_q = RLC_ALLOCA(pp_prep_st *, m);
+	int i;
+
+	RLC_TRY {
+		if (_q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			_q[i] = (pp_prep_st *)q[i];
+		}
+		pp_mil_prep_k24(r, p, _q, m);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(_q);
+	}
+}
@@ -0,0 +1,213 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the memory pool used by the POOL allocation policy.
+ *
+ * @ingroup relic
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if OPSYS == WINDOWS
+#include <malloc.h>
+#endif
+
+#include "relic_core.h"
+#include "relic_alloc.h"
+
+#if ALLOC == POOL
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in bytes of the smallest size class.
+ */
+#define POOL_MIN		16
+
+/**
+ * Size in bytes of the header preceding each block, which stores the block
+ * capacity and preserves the alignment of the returned memory.
+ */
+#define POOL_HDR		RLC_MAX(ALIGN, POOL_MIN)
+
+/**
+ * Allocates raw memory from the system with the configured alignment.
+ *
+ * @param[in] len			- the number of bytes to allocate.
+ * @return the allocated memory, or NULL if there is no available memory.
+ */
+static void *pool_get(size_t len) {
+#if ALIGN == 1
+	return malloc(len);
+#elif OPSYS == WINDOWS
+	return _aligned_malloc(len, ALIGN);
+#else
+	void *p = NULL;
+	if (posix_memalign(&p, ALIGN, len) != 0) {
+		return NULL;
+	}
+	return p;
+#endif
+}
+
+/**
+ * Returns raw memory to the system.
+ *
+ * @param[in] ptr			- the memory to free.
+ */
+static void pool_put(void *ptr) {
+#if OPSYS == WINDOWS && ALIGN > 1
+	_aligned_free(ptr);
+#else
+	free(ptr);
+#endif
+}
+
+/**
+ * Computes the size class of a block capacity.
+ *
+ * @param[in,out] cap		- the requested size, rounded up to the capacity.
+ * @return the size class, or RLC_POOL_CLS if the block is not pooled.
+ */
+static int pool_cls(size_t *cap) {
+	size_t len = POOL_MIN;
+	int c = 0;
+
+	while (c < RLC_POOL_CLS && len < *cap) {
+		len <<= 1;
+		c++;
+	}
+	if (c < RLC_POOL_CLS) {
+		*cap = len;
+	}
+	return c;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void *pool_alloc(size_t size) {
+	ctx_t *ctx = core_get();
+	size_t cap = size;
+	uint8_t *p;
+	int c = pool_cls(&cap);
+
+	if (c < RLC_POOL_CLS && ctx != NULL && ctx->pool[c] != NULL) {
+		p = (uint8_t *)ctx->pool[c];
+		ctx->pool[c] = *(void **)p;
+		ctx->pool_len[c]--;
+		return p;
+	}
+
+	if (cap > SIZE_MAX - POOL_HDR) {
+		return NULL;
+	}
+	p = (uint8_t *)pool_get(POOL_HDR + cap);
+	if (p == NULL) {
+		return NULL;
+	}
+	*(size_t *)p = cap;
+	return p + POOL_HDR;
+}
+
+void *pool_calloc(size_t n, size_t size) {
+	void *p;
+
+	if (size != 0 && n > SIZE_MAX / size) {
+		return NULL;
+	}
+	p = pool_alloc(n * size);
+	if (p != NULL) {
+		memset(p, 0, n * size);
+	}
+	return p;
+}
+
+void *pool_realloc(void *ptr, size_t size) {
+	size_t cap;
+	void *p;
+
+	if (ptr == NULL) {
+		return pool_alloc(size);
+	}
+
+	cap = *(size_t *)((uint8_t *)ptr - POOL_HDR);
+	if (size <= cap) {
+		return ptr;
+	}
+	p = pool_alloc(size);
+	if (p != NULL) {
+		memcpy(p, ptr, cap);
+		pool_free(ptr);
+	}
+	return p;
+}
+
+void pool_free(void *ptr) {
+	ctx_t *ctx = core_get();
+	uint8_t *p = (uint8_t *)ptr;
+	size_t cap;
+	int c;
+
+	if (p == NULL) {
+		return;
+	}
+
+	cap = *(size_t *)(p - POOL_HDR);
+	c = pool_cls(&cap);
+	if (c < RLC_POOL_CLS && ctx != NULL && ctx->pool_len[c] < RLC_POOL_MAX) {
+		/* Link the block through its first bytes, which are always free. */
+		*(void **)p = ctx->pool[c];
+		ctx->pool[c] = p;
+		ctx->pool_len[c]++;
+	} else {
+		pool_put(p - POOL_HDR);
+	}
+}
+
+void pool_clean(void) {
+	ctx_t *ctx = core_get();
+	uint8_t *p;
+
+	if (ctx == NULL) {
+		return;
+	}
+
+	for (int c = 0; c < RLC_POOL_CLS; c++) {
+		while (ctx->pool[c] != NULL) {
+			p = (uint8_t *)ctx->pool[c];
+			ctx->pool[c] = *(void **)p;
+			pool_put(p - POOL_HDR);
+		}
+		ctx->pool_len[c] = 0;
+	}
+}
+
+#endif /* ALLOC == POOL */
@@ -32,11 +32,14 @@
 #if TIMER == PERF
 #define _GNU_SOURCE
 #include <sys/syscall.h>      /* Definition of SYS_* constants */
+#include <sys/ioctl.h>
 #include <unistd.h>
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "relic_core.h"
 #include "relic_conf.h"
@@ -80,6 +83,330 @@ static void empty(int *a) {
 #define CLOCK			NULL
 #endif
 
+/**
+ * Unit of the timings given by the chosen timer.
+ */
+#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
+#define UNIT			"microsec"
+#elif TIMER == CYCLE || TIMER == PERF
+#define UNIT			"cycles"
+#else
+#define UNIT			"nanosec"
+#endif
+
+#ifdef TIMER
+
+/**
+ * Compares two timings, for sorting.
+ *
+ * @param[in] a				- the first timing.
+ * @param[in] b				- the second timing.
+ * @return -1, 0 or 1 if the first timing is smaller, equal or larger.
+ */
+static int bench_cmp(const void *a, const void *b) {
+	ull_t x = *(const ull_t *)a, y = *(const ull_t *)b;
+	return (x > y) - (x < y);
+}
+
+/**
+ * Computes the integer square root of a 64-bit integer.
+ *
+ * @param[in] a				- the integer.
+ * @return the largest integer whose square is not larger than a.
+ */
+static ull_t bench_sqrt(ull_t a) {
+	ull_t r = a, s = (a + 1) / 2;
+
+	/* Newton iteration, decreasing from above until it stabilizes. */
+	while (s < r) {
+		r = s;
+		s = (r + a / r) / 2;
+	}
+	return r;
+}
+
+/**
+ * Reads the results of a previous run, exported in CSV format, to be used as
+ * baseline.
+ *
+ * @param[in,out] ctx		- the library context.
+ * @param[in] name			- the name of the baseline file.
+ */
+static void bench_base(ctx_t *ctx, const char *name) {
+	char line[4 * RLC_BENCH_LABEL], *end;
+	size_t len;
+	ben_ref_t *ref;
+	ull_t mean, min, med;
+	FILE *f = fopen(name, "r");
+
+	if (f == NULL) {
+		RLC_THROW(ERR_NO_FILE);
+		return;
+	}
+	while (fgets(line, sizeof(line), f) != NULL) {
+		/* Skip the header and malformed records. */
+		if (line[0] != '"' || (end = strchr(line + 1, '"')) == NULL) {
+			continue;
+		}
+		*end = '\0';
+		if (sscanf(end + 1, ",%*[^,],%llu,%llu,%llu", &mean, &min, &med) != 3) {
+			continue;
+		}
+		ref = (ben_ref_t *)realloc(ctx->base,
+				(ctx->base_len + 1) * sizeof(ben_ref_t));
+		if (ref == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+			break;
+		}
+		ctx->base = ref;
+		len = RLC_MIN(end - line - 1, RLC_BENCH_LABEL - 1);
+		memcpy(ref[ctx->base_len].label, line + 1, len);
+		ref[ctx->base_len].label[len] = '\0';
+		ref[ctx->base_len].med = med;
+		ctx->base_len++;
+	}
+	fclose(f);
+}
+
+/**
+ * Opens a file for appending benchmark results.
+ *
+ * @param[in] name			- the name of the file.
+ * @param[in] header		- the header written to empty files, or NULL.
+ * @return the opened file.
+ */
+static FILE *bench_open(const char *name, const char *header) {
+	FILE *f = fopen(name, "a");
+
+	if (f == NULL) {
+		RLC_THROW(ERR_NO_FILE);
+		return NULL;
+	}
+	if (header != NULL && ftell(f) == 0) {
+		fputs(header, f);
+	}
+	return f;
+}
+
+#endif /* TIMER */
+
+#if TIMER == PERF
+
+/**
+ * Represents a performance counter that can be read around benchmarks.
+ */
+typedef struct {
+	/** The name used for choosing and printing the counter. */
+	const char *name;
+	/** The type of the counter. */
+	uint32_t type;
+	/** The identifier of the counter inside its type. */
+	ull_t config;
+} bench_evt_t;
+
+/**
+ * Identifier of the read misses in a given cache level.
+ */
+#define MISS(L)																\
+	((L) | (PERF_COUNT_HW_CACHE_OP_READ << 8) |								\
+	(PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+/**
+ * Counters read by default.
+ */
+#define EVENTS_HW		"instructions,cycles,l1d-misses,llc-misses,branch-misses"
+
+/**
+ * Counters read when the hardware counters are not available.
+ */
+#define EVENTS_SW		"task-clock,context-switches,page-faults"
+
+/**
+ * Table of supported counters.
+ */
+static const bench_evt_t bench_evt[] = {
+	{"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+	{"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+	{"l1d-misses", PERF_TYPE_HW_CACHE, MISS(PERF_COUNT_HW_CACHE_L1D)},
+	{"llc-misses", PERF_TYPE_HW_CACHE, MISS(PERF_COUNT_HW_CACHE_LL)},
+	{"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+	{"task-clock", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+	{"context-switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+	{"page-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+};
+
+/**
+ * Opens a group of performance counters, skipping the ones not supported by
+ * the running kernel or processor.
+ *
+ * @param[in,out] ctx		- the library context.
+ * @param[in] list			- the comma-separated names of the counters.
+ * @return the number of opened counters.
+ */
+static int bench_group(ctx_t *ctx, const char *list) {
+	struct perf_event_attr attr;
+	char buf[256], *name, *save;
+	size_t i, len = RLC_MIN(strlen(list), sizeof(buf) - 1);
+	int fd;
+
+	memcpy(buf, list, len);
+	buf[len] = '\0';
+	ctx->perf_num = 0;
+	name = strtok_r(buf, ",", &save);
+	for (; name != NULL; name = strtok_r(NULL, ",", &save)) {
+		for (i = 0; i < sizeof(bench_evt) / sizeof(bench_evt_t); i++) {
+			if (strcmp(name, bench_evt[i].name) == 0) {
+				break;
+			}
+		}
+		if (i == sizeof(bench_evt) / sizeof(bench_evt_t)) {
+			RLC_THROW(ERR_NO_VALID);
+			continue;
+		}
+		if (ctx->perf_num == RLC_BENCH_EVENTS) {
+			break;
+		}
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = bench_evt[i].type;
+		attr.config = bench_evt[i].config;
+		/* Software events such as context switches happen in the kernel. */
+		attr.exclude_kernel = (attr.type != PERF_TYPE_SOFTWARE);
+		attr.exclude_hv = 1;
+		attr.disabled = (ctx->perf_num == 0);
+		attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+				PERF_FORMAT_TOTAL_TIME_RUNNING;
+		fd = syscall(__NR_perf_event_open, &attr, 0, -1,
+				(ctx->perf_num == 0 ? -1 : ctx->perf_grp[0]), 0);
+		if (fd != -1) {
+			ctx->perf_grp[ctx->perf_num] = fd;
+			ctx->perf_evt[ctx->perf_num] = i;
+			ctx->perf_num++;
+		}
+	}
+	if (ctx->perf_num > 0) {
+		ioctl(ctx->perf_grp[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+	return ctx->perf_num;
+}
+
+/**
+ * Reads the group of performance counters with a single system call.
+ *
+ * @param[in] ctx			- the library context.
+ * @param[out] val			- the enabled and running times, then the counters.
+ */
+static void bench_read(ctx_t *ctx, ull_t *val) {
+	ull_t buf[RLC_BENCH_EVENTS + 3];
+
+	if (ctx->perf_num == 0 || read(ctx->perf_grp[0], buf, sizeof(buf)) <
+			(ssize_t)((ctx->perf_num + 3) * sizeof(ull_t))) {
+		memset(val, 0, (RLC_BENCH_EVENTS + 2) * sizeof(ull_t));
+		return;
+	}
+	/* Skip the number of counters, which is the size of the group. */
+	memcpy(val, buf + 1, (ctx->perf_num + 2) * sizeof(ull_t));
+}
+
+/**
+ * Prints the performance counters of the last benchmark, amortized by the
+ * number of operations.
+ *
+ * @param[in] ctx			- the library context.
+ * @param[in] f				- the JSON file to export the counters, or NULL.
+ */
+static void bench_events(ctx_t *ctx, FILE *f) {
+	const char *sep = "";
+	ull_t ins = 0, cyc = 0, ipc;
+	int i;
+
+	if (ctx->perf_num == 0) {
+		return;
+	}
+	for (i = 0; i < ctx->perf_num; i++) {
+		if (strcmp(bench_evt[ctx->perf_evt[i]].name, "instructions") == 0) {
+			ins = ctx->perf_sum[i];
+		}
+		if (strcmp(bench_evt[ctx->perf_evt[i]].name, "cycles") == 0) {
+			cyc = ctx->perf_sum[i];
+		}
+	}
+	/* Keep two decimal places for the instructions per cycle. */
+	ipc = (cyc > 0 ? 100 * ins / cyc : 0);
+
+	if (f == NULL) {
+		util_print(" (");
+		if (cyc > 0) {
+			util_print("ipc %llu.%02llu", ipc / 100, ipc % 100);
+			sep = ", ";
+		}
+		for (i = 0; i < ctx->perf_num; i++) {
+			util_print("%s%s %llu/op", sep, bench_evt[ctx->perf_evt[i]].name,
+					ctx->perf_sum[i]);
+			sep = ", ";
+		}
+		util_print(")");
+	} else {
+		fprintf(f, ", \"counters\": {");
+		for (i = 0; i < ctx->perf_num; i++) {
+			fprintf(f, "%s\"%s\": %llu", sep, bench_evt[ctx->perf_evt[i]].name,
+					ctx->perf_sum[i]);
+			sep = ", ";
+		}
+		fprintf(f, "}");
+		if (cyc > 0) {
+			fprintf(f, ", \"ipc\": %llu.%02llu", ipc / 100, ipc % 100);
+		}
+	}
+}
+
+#endif /* TIMER == PERF */
+
+/**
+ * Arguments shared by the threads of a throughput benchmark.
+ */
+typedef struct {
+	/** The operation to benchmark. */
+	void (*func)(void *);
+	/** The inputs of the operation. */
+	void *arg;
+} bench_thr_t;
+
+/**
+ * Executes the operation of a throughput benchmark repeatedly in a thread.
+ *
+ * @param[in] arg			- the arguments of the benchmark.
+ * @param[in] id			- the thread index.
+ * @param[in] cores			- the number of threads.
+ */
+static void bench_job(void *arg, int id, int cores) {
+	bench_thr_t *b = (bench_thr_t *)arg;
+
+	(void)id;
+	(void)cores;
+	for (int i = 0; i < BENCH; i++) {
+		b->func(b->arg);
+	}
+}
+
+/**
+ * Reads the wall-clock time, since the per-process and per-thread timers do
+ * not measure throughput across threads.
+ *
+ * @return the time in nanoseconds.
+ */
+static ull_t bench_wall(void) {
+#if defined(MULTI) && MULTI == OPENMP
+	return (ull_t)(omp_get_wtime() * 1000000000);
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (ull_t)t.tv_sec * 1000000000 + t.tv_nsec;
+#else
+	return (ull_t)time(NULL) * 1000000000;
+#endif
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -139,6 +466,28 @@ void bench_init(void) {
 	if (ctx != NULL) {
 #ifdef OVERH
 		ctx->over = 0;
+#endif
+		ctx->count = 0;
+		ctx->label[0] = '\0';
+		ctx->json = ctx->csv = NULL;
+		ctx->base = NULL;
+		ctx->base_len = 0;
+		ctx->tol = RLC_BENCH_TOL;
+#if defined(TIMER) && OPSYS != DUINO
+		const char *name;
+		if ((name = getenv("RELIC_BENCH_JSON")) != NULL) {
+			ctx->json = bench_open(name, NULL);
+		}
+		if ((name = getenv("RELIC_BENCH_CSV")) != NULL) {
+			ctx->csv = bench_open(name,
+					"label,unit,mean,min,median,p90,p99,stddev,samples\n");
+		}
+		if ((name = getenv("RELIC_BENCH_BASE")) != NULL) {
+			bench_base(ctx, name);
+		}
+		if ((name = getenv("RELIC_BENCH_TOL")) != NULL) {
+			ctx->tol = atoi(name);
+		}
 #endif
 #if TIMER == PERF
 		static struct perf_event_attr attr;
@@ -151,17 +500,45 @@ void bench_init(void) {
 		if (ctx->perf_fd != -1) {
 			ctx->perf_buf = mmap(NULL, sysconf(_SC_PAGESIZE), PROT_READ, MAP_SHARED,
 				ctx->perf_fd, 0);
-		} else {
-			RLC_THROW(ERR_NO_FILE);
+			if (ctx->perf_buf == MAP_FAILED) {
+				ctx->perf_buf = NULL;
+			}
+		}
+		/* Without the cycle counter, timings fall back to the time-stamp
+		 * counter and only software counters are likely to be available. */
+
+		if ((name = getenv("RELIC_BENCH_EVENTS")) == NULL) {
+			name = EVENTS_HW;
 		}
+		if (bench_group(ctx, name) == 0) {
+			bench_group(ctx, EVENTS_SW);
+		}
+		memset(ctx->perf_val, 0, sizeof(ctx->perf_val));
+		memset(ctx->perf_sum, 0, sizeof(ctx->perf_sum));
 #endif
 	}
 }
 
 void bench_reset(void) {
 #ifdef TIMER
-	core_get()->total = 0;
+	ctx_t *ctx = core_get();
+	ctx->total = 0;
+	ctx->count = 0;
+	ctx->min = ctx->med = ctx->p90 = ctx->p99 = ctx->dev = 0;
+	ctx->label[0] = '\0';
+#if TIMER == PERF
+	memset(ctx->perf_sum, 0, sizeof(ctx->perf_sum));
 #endif
+#endif
+}
+
+void bench_label(const char *label) {
+	ctx_t *ctx = core_get();
+	size_t len = RLC_MIN(strlen(label), RLC_BENCH_LABEL - 1);
+
+	memcpy(ctx->label, label, len);
+	ctx->label[len] = '\0';
+	util_print("BENCH: %s%*c = ", label, (int)(32 - strlen(label)), ' ');
 }
 
 void bench_before(void) {
@@ -173,7 +550,11 @@ void bench_before(void) {
 	core_get()->before = clock();
 #elif TIMER == POSIX
 	gettimeofday(&(core_get()->before), NULL);
-#elif TIMER == CYCLE || TIMER == PERF
+#elif TIMER == CYCLE
+	core_get()->before = arch_cycles();
+#elif TIMER == PERF
+	/* Read the counters outside of the timed region. */
+	bench_read(core_get(), core_get()->perf_val);
 	core_get()->before = arch_cycles();
 #endif
 }
@@ -201,8 +582,28 @@ void bench_after(void) {
   	result = (ctx->after - ctx->before);
 #endif
 
+#if TIMER == PERF
+	ull_t val[RLC_BENCH_EVENTS + 2], ena, run;
+
+	bench_read(ctx, val);
+	ena = val[0] - ctx->perf_val[0];
+	run = val[1] - ctx->perf_val[1];
+	for (int i = 0; i < ctx->perf_num; i++) {
+		val[i + 2] -= ctx->perf_val[i + 2];
+		/* Scale the counts if the group was multiplexed with other events. */
+		if (run > 0 && run < ena) {
+			val[i + 2] = val[i + 2] * ena / run;
+		}
+		ctx->perf_sum[i] += val[i + 2];
+	}
+#endif
+
 #ifdef TIMER
 	ctx->total += result;
+	if (ctx->count < RLC_BENCH_SAMPLES) {
+		ctx->sample[ctx->count] = result;
+	}
+	ctx->count++;
 #else
 	(void)result;
 	(void)ctx;
@@ -212,10 +613,43 @@ void bench_after(void) {
 void bench_compute(int benches) {
 	ctx_t *ctx = core_get();
 #ifdef TIMER
+	int i, n = RLC_MIN(ctx->count, RLC_BENCH_SAMPLES);
+	ull_t var = 0, d;
+
 	ctx->total = ctx->total / benches;
+#if TIMER == PERF
+	for (i = 0; i < ctx->perf_num; i++) {
+		ctx->perf_sum[i] /= benches;
+	}
+#endif
 #ifdef OVERH
 	ctx->total = ctx->total - ctx->over;
 #endif /* OVERH */
+
+	/* Amortize each measurement by the executions it covers. */
+	for (i = 0; i < n; i++) {
+		ctx->sample[i] = ctx->sample[i] * ctx->count / benches;
+#ifdef OVERH
+		ctx->sample[i] -= ctx->over;
+#endif /* OVERH */
+	}
+	if (n > 0) {
+		qsort(ctx->sample, n, sizeof(ull_t), bench_cmp);
+		ctx->min = ctx->sample[0];
+		ctx->med = ctx->sample[n / 2];
+		if (n % 2 == 0) {
+			ctx->med = (ctx->sample[n / 2 - 1] + ctx->sample[n / 2]) / 2;
+		}
+		/* Use the nearest-rank definition for percentiles. */
+		ctx->p90 = ctx->sample[(90 * n + 99) / 100 - 1];
+		ctx->p99 = ctx->sample[(99 * n + 99) / 100 - 1];
+		for (i = 0; i < n; i++) {
+			d = (ctx->sample[i] > ctx->total ? ctx->sample[i] - ctx->total :
+					ctx->total - ctx->sample[i]);
+			var += d * d / n;
+		}
+		ctx->dev = bench_sqrt(var);
+	}
 #else
 	(void)benches;
 	(void)ctx;
@@ -224,29 +658,138 @@ void bench_compute(int benches) {
 
 void bench_print(void) {
 	ctx_t *ctx = core_get();
+	const ben_ref_t *ref = NULL;
+	int i;
 
-#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
-	util_print("%lld microsec", ctx->total);
-#elif TIMER == CYCLE || TIMER == PERF
-	util_print("%lld cycles", ctx->total);
-#else
-	util_print("%lld nanosec", ctx->total);
+	util_print("%lld " UNIT, ctx->total);
+
+	for (i = 0; ctx->label[0] != '\0' && i < ctx->base_len; i++) {
+		if (strcmp(ctx->base[i].label, ctx->label) == 0) {
+			ref = &ctx->base[i];
+			break;
+		}
+	}
+	/* Compare medians, which are less sensitive to outliers than means. */
+	if (ref != NULL && ref->med > 0 &&
+			100 * ctx->med > (ull_t)(100 + ctx->tol) * ref->med) {
+		util_print(" (regression of %llu%% over baseline)",
+				(100 * ctx->med) / ref->med - 100);
+	}
+#if TIMER == PERF
+	bench_events(ctx, NULL);
 #endif
 	if (ctx->total < 0) {
 		util_print(" (overflow or bad overhead estimation)\n");
 	} else {
 		util_print("\n");
 	}
+
+	if (ctx->label[0] == '\0') {
+		return;
+	}
+	if (ctx->json != NULL) {
+		fprintf(ctx->json, "{\"label\": \"%s\", \"unit\": \"" UNIT "\", "
+				"\"mean\": %llu, \"min\": %llu, \"median\": %llu, "
+				"\"p90\": %llu, \"p99\": %llu, \"stddev\": %llu, "
+				"\"samples\": %d", ctx->label, ctx->total, ctx->min, ctx->med,
+				ctx->p90, ctx->p99, ctx->dev, ctx->count);
+#if TIMER == PERF
+		bench_events(ctx, ctx->json);
+#endif
+		if (ref != NULL) {
+			fprintf(ctx->json, ", \"baseline\": %llu, \"regression\": %s",
+					ref->med, (100 * ctx->med > (ull_t)(100 + ctx->tol) *
+					ref->med ? "true" : "false"));
+		}
+		fprintf(ctx->json, "}\n");
+		fflush(ctx->json);
+	}
+	if (ctx->csv != NULL) {
+		fprintf(ctx->csv, "\"%s\"," UNIT ",%llu,%llu,%llu,%llu,%llu,%llu,%d\n",
+				ctx->label, ctx->total, ctx->min, ctx->med, ctx->p90, ctx->p99,
+				ctx->dev, ctx->count);
+		fflush(ctx->csv);
+	}
 }
 
 ull_t bench_total(void) {
 	return core_get()->total;
 }
 
+void bench_thread(const char *label, void (*func)(void *), void *arg) {
+	ctx_t *ctx = core_get();
+	char name[RLC_BENCH_LABEL];
+	bench_thr_t b;
+	ull_t t, ops, one = 1, eff;
+#if defined(MULTI)
+	int m = CORES;
+#else
+	/* Without MULTI, core_run() executes the job only once. */
+	int m = 1;
+#endif
+
+	b.func = func;
+	b.arg = arg;
+	/* Warm up caches and tables built on first use. */
+	func(arg);
+
+	/* Double the threads, then finish at the maximum if not reached. */
+	for (int n = 1; n <= m; n = (n < m && 2 * n > m ? m : 2 * n)) {
+		snprintf(name, sizeof(name), "%s (%d thread%s)", label, n,
+				(n > 1 ? "s" : ""));
+		bench_reset();
+		bench_label(name);
+
+		t = bench_wall();
+		core_run(bench_job, &b, n);
+		t = RLC_MAX(bench_wall() - t, 1);
+
+		ops = (ull_t)n * BENCH * 1000000000 / t;
+		if (n == 1) {
+			one = RLC_MAX(ops, 1);
+		}
+		eff = 100 * ops / (n * one);
+		util_print("%llu op/sec (%llu%% efficiency)\n", ops, eff);
+
+		if (ctx->json != NULL) {
+			fprintf(ctx->json, "{\"label\": \"%s\", \"threads\": %d, "
+					"\"ops\": %llu, \"efficiency\": %llu}\n", ctx->label, n,
+					ops, eff);
+			fflush(ctx->json);
+		}
+	}
+}
+
+void bench_stats(ull_t *min, ull_t *med, ull_t *p90, ull_t *p99, ull_t *dev) {
+	ctx_t *ctx = core_get();
+
+	*min = ctx->min;
+	*med = ctx->med;
+	*p90 = ctx->p90;
+	*p99 = ctx->p99;
+	*dev = ctx->dev;
+}
+
 void bench_clean(void) {
-#if TIMER == PERF
 	ctx_t *ctx = core_get();
 	if (ctx != NULL) {
+		if (ctx->json != NULL) {
+			fclose(ctx->json);
+		}
+		if (ctx->csv != NULL) {
+			fclose(ctx->csv);
+		}
+		free(ctx->base);
+		ctx->json = ctx->csv = NULL;
+		ctx->base = NULL;
+		ctx->base_len = 0;
+	}
+#if TIMER == PERF
+	if (ctx != NULL) {
+		for (int i = ctx->perf_num - 1; i >= 0; i--) {
+			close(ctx->perf_grp[i]);
+		}
+		ctx->perf_num = 0;
 		close(ctx->perf_fd);
 		munmap(ctx->perf_buf, sysconf(_SC_PAGESIZE)),
 		ctx->perf_fd = -1;
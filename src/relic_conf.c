@@ -64,6 +64,8 @@ void conf_print(void) {
 	util_print("-- RELIC " RLC_VERSION " configuration:\n\n");
 #if ALLOC == DYNAMIC
 	util_print("** Allocation mode: DYNAMIC\n\n");
+#elif ALLOC == POOL
+	util_print("** Allocation mode: POOL\n\n");
 #elif ALLOC == AUTO
 	util_print("** Allocation mode: AUTO\n\n");
 #endif
@@ -74,6 +76,8 @@ void conf_print(void) {
 	util_print("** Arithmetic backend: gmp\n\n");
 #elif ARITH == GMP_SEC
 	util_print("** Arithmetic backend: gmp-sec\n\n");
+#elif ARITH == X64_DISPATCH
+	util_print("** Arithmetic backend: x64-dispatch\n\n");
 #else
 	util_print("** Arithmetic backend: " QUOTE(ARITH) "\n\n");
 #endif
@@ -99,6 +99,109 @@ rlc_thread ctx_t *core_ctx = NULL;
 static ctx_t *core_ctx = NULL;
 #endif
 
+#if defined(MULTI) && MULTI == PTHREAD
+/**
+ * Lock protecting the reference counters of shared parameters.
+ */
+static pthread_mutex_t core_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Adds a value to the reference counter of a set of precomputed tables.
+ *
+ * @param[in,out] pre		- the precomputed tables.
+ * @param[in] inc			- the value to add.
+ * @return the updated number of references.
+ */
+static int core_ref(pre_t *pre, int inc) {
+	int refs;
+#if defined(MULTI) && MULTI == OPENMP
+#pragma omp atomic capture
+	refs = pre->refs += inc;
+#elif defined(MULTI) && MULTI == PTHREAD
+	pthread_mutex_lock(&core_lock);
+	refs = pre->refs += inc;
+	pthread_mutex_unlock(&core_lock);
+#else
+	refs = pre->refs += inc;
+#endif
+	return refs;
+}
+
+/**
+ * Copies a library context and resets the state that cannot be shared
+ * with the source context.
+ *
+ * @param[out] dst			- the destination context.
+ * @param[in] src			- the source context.
+ */
+static void core_copy(ctx_t *dst, const ctx_t *src) {
+	memcpy(dst, src, sizeof(ctx_t));
+#ifdef CHECK
+	dst->last = NULL;
+	dst->caught = 0;
+#endif
+#if ALLOC == POOL
+	/* Free lists are owned by a single thread. */
+	memset(dst->pool, 0, sizeof(dst->pool));
+	memset(dst->pool_len, 0, sizeof(dst->pool_len));
+#endif
+	dst->code = RLC_OK;
+}
+
+#if defined(MULTI)
+
+/**
+ * Flag to indicate that the current thread is already a library worker.
+ */
+static rlc_thread int core_worker = 0;
+#if MULTI == OPENMP && !defined(_MSC_VER)
+#pragma omp threadprivate(core_worker)
+#endif
+
+/**
+ * Arguments passed to a worker.
+ */
+typedef struct {
+	/** The function to execute. */
+	void (*func)(void *, int, int);
+	/** The argument to pass to the function. */
+	void *arg;
+	/** The worker index. */
+	int id;
+	/** The number of workers. */
+	int cores;
+	/** The private context of the worker. */
+	ctx_t *ctx;
+} core_job_t;
+
+/**
+ * Executes a job inside a worker, using the worker's private context.
+ *
+ * @param[in,out] ptr		- the worker arguments.
+ * @return NULL.
+ */
+static void *core_job(void *ptr) {
+	core_job_t *job = (core_job_t *)ptr;
+	ctx_t *old = core_ctx;
+	int flag = core_worker;
+
+	core_ctx = job->ctx;
+	core_worker = 1;
+	job->func(job->arg, job->id, job->cores);
+#if ALLOC == POOL
+	if (job->id > 0) {
+		/* Release the blocks cached by the private context. */
+		pool_clean();
+	}
+#endif
+	core_worker = flag;
+	core_ctx = old;
+	return NULL;
+}
+
+#endif /* MULTI */
+
 int core_init(void) {
 	if (core_ctx == NULL) {
 		core_ctx = &(first_ctx);
@@ -119,6 +222,16 @@ int core_init(void) {
 #endif /* CHECK */
 
 	core_ctx->code = RLC_OK;
+#if ALLOC == POOL
+	memset(core_ctx->pool, 0, sizeof(core_ctx->pool));
+	memset(core_ctx->pool_len, 0, sizeof(core_ctx->pool_len));
+#endif
+	/* Keep the large tables off the context, which may be thread-local. */
+	core_ctx->pre = (pre_t *)calloc(1, sizeof(pre_t));
+	if (core_ctx->pre == NULL) {
+		return RLC_ERR;
+	}
+	core_ctx->pre->refs = 1;
 
 	RLC_TRY {
 		arch_init();
@@ -150,34 +263,118 @@ int core_init(void) {
 		pc_core_init();
 #endif
 	} RLC_CATCH_ANY {
+		/* Release what was set up, but keep the failed context current. */
+		ctx_t *ctx = core_ctx;
+		core_clean();
+		core_ctx = ctx;
 		return RLC_ERR;
 	}
 
 	return RLC_OK;
 }
 
+int core_share(ctx_t *ctx) {
+	if (ctx == NULL || ctx->pre == NULL) {
+		return RLC_ERR;
+	}
+	if (core_ctx == ctx) {
+		return RLC_OK;
+	}
+	if (core_ctx == NULL) {
+		core_ctx = &(first_ctx);
+	}
+	if (core_ctx->pre != NULL) {
+		/* Release the parameters of an initialized context first. */
+		ctx_t *dst = core_ctx;
+		core_clean();
+		core_ctx = dst;
+	}
+
+	core_copy(core_ctx, ctx);
+	core_ref(core_ctx->pre, 1);
+
+	RLC_TRY {
+		arch_init();
+		rand_init();
+#if BENCH > 0
+		bench_init();
+#endif
+	} RLC_CATCH_ANY {
+		return RLC_ERR;
+	}
+
+	return RLC_OK;
+}
+
+ctx_t *core_new(void) {
+	ctx_t *old = core_ctx, *ctx = (ctx_t *)calloc(1, sizeof(ctx_t));
+	int result;
+
+	if (ctx == NULL) {
+		return NULL;
+	}
+
+	core_ctx = ctx;
+	result = core_init();
+	core_ctx = old;
+	if (result != RLC_OK) {
+		core_free(ctx);
+		return NULL;
+	}
+	return ctx;
+}
+
+void core_free(ctx_t *ctx) {
+	ctx_t *old = core_ctx;
+
+	if (ctx == NULL) {
+		return;
+	}
+
+	core_ctx = ctx;
+	core_clean();
+	core_ctx = (old == ctx ? NULL : old);
+	free(ctx);
+}
+
 int core_clean(void) {
+	int shared = 0;
+
+	if (core_ctx != NULL && core_ctx->pre == NULL) {
+		/* The context was never initialized or is already finalized. */
+		int result = core_ctx->code;
+		core_ctx = NULL;
+		return result;
+	}
+
+	if (core_ctx != NULL && core_ctx->pre != NULL) {
+		/* The last context using the parameters releases them. */
+		shared = (core_ref(core_ctx->pre, -1) > 0);
+	}
+
+	if (!shared) {
 #ifdef WITH_FP
-	fp_prime_clean();
+		fp_prime_clean();
 #endif
 #ifdef WITH_FB
-	fb_poly_clean();
+		fb_poly_clean();
 #endif
 #ifdef WITH_EP
-	ep_curve_clean();
+		ep_curve_clean();
 #endif
 #ifdef WITH_EB
-	eb_curve_clean();
+		eb_curve_clean();
 #endif
 #ifdef WITH_ED
-	ed_curve_clean();
+		ed_curve_clean();
 #endif
 #ifdef WITH_PP
-	pp_map_clean();
+		pp_map_clean();
 #endif
 #ifdef WITH_PC
-	pc_core_clean();
+		pc_core_clean();
 #endif
+	}
 
 #if BENCH > 0
 		bench_clean();
@@ -185,9 +382,16 @@ int core_clean(void) {
 
 	arch_clean();
 	rand_clean();
+#if ALLOC == POOL
+	pool_clean();
+#endif
 
 	if (core_ctx != NULL) {
 		int result = core_ctx->code;
+		if (!shared) {
+			free(core_ctx->pre);
+		}
+		core_ctx->pre = NULL;
 		core_ctx = NULL;
 		return result;
 	}
@@ -207,6 +411,95 @@ void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
 
+void core_run(void (*func)(void *arg, int id, int cores), void *arg,
+		int cores) {
+#if defined(MULTI)
+	ctx_t *src = core_get();
+	core_job_t *job;
+	int i, code = RLC_OK;
+
+	cores = RLC_MIN(cores, CORES);
+#if MULTI == OPENMP
+	if (omp_in_parallel()) {
+		cores = 1;
+	}
+#endif
+	if (cores <= 1 || core_worker) {
+		func(arg, 0, 1);
+		return;
+	}
+
+	job = (core_job_t *)calloc(cores, sizeof(core_job_t));
+	if (job == NULL) {
+		func(arg, 0, 1);
+		return;
+	}
+
+	/* Copy the context before starting, the caller may change it later. */
+	for (i = 0; i < cores; i++) {
+		job[i].func = func;
+		job[i].arg = arg;
+		job[i].id = i;
+		job[i].cores = cores;
+		if (i == 0) {
+			job[i].ctx = src;
+		} else {
+			job[i].ctx = (ctx_t *)malloc(sizeof(ctx_t));
+			if (job[i].ctx == NULL) {
+				cores = i;
+				break;
+			}
+			core_copy(job[i].ctx, src);
+		}
+	}
+	for (i = 0; i < cores; i++) {
+		job[i].cores = cores;
+	}
+
+#if MULTI == OPENMP
+#pragma omp parallel for num_threads(cores) schedule(static, 1)
+	for (i = 0; i < cores; i++) {
+		core_job(&job[i]);
+	}
+#elif MULTI == PTHREAD
+	pthread_t *thread = (pthread_t *)calloc(cores, sizeof(pthread_t));
+	int *spawn = (int *)calloc(cores, sizeof(int));
+
+	for (i = 1; i < cores; i++) {
+		if (thread != NULL && spawn != NULL) {
+			spawn[i] = !pthread_create(&thread[i], NULL, core_job, &job[i]);
+		}
+	}
+	core_job(&job[0]);
+	for (i = 1; i < cores; i++) {
+		if (spawn != NULL && spawn[i]) {
+			pthread_join(thread[i], NULL);
+		} else {
+			/* Run the job in the calling thread if no thread is available. */
+			core_job(&job[i]);
+		}
+	}
+	free(thread);
+	free(spawn);
+#endif
+
+	for (i = 1; i < cores; i++) {
+		if (job[i].ctx->code != RLC_OK) {
+			code = RLC_ERR;
+		}
+		free(job[i].ctx);
+	}
+	free(job);
+
+	if (code != RLC_OK) {
+		RLC_THROW(ERR_CAUGHT);
+	}
+#else
+	(void)cores;
+	func(arg, 0, 1);
+#endif
+}
+
 #if defined(MULTI)
 void core_set_thread_initializer(void(*init)(void *init_ptr), void* init_ptr) {
     core_thread_initializer = init;
@@ -0,0 +1,318 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2026 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Template for discrete logarithms in small ranges in the groups of the
+ * pairing.
+ *
+ * @ingroup tmpl
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Defines a template for computing a discrete logarithm with the baby-step
+ * giant-step method.
+ *
+ * @param[in] G			- the group prefix.
+ * @param[in] ADD		- the group operation.
+ * @param[in] NEG		- the group inversion.
+ * @param[in] MUL		- the exponentiation by a digit.
+ * @param[in] NORM		- the normalization of an element.
+ * @param[in] IS_ONE	- the test for the identity.
+ */
+#define TMPL_DLOG_BSGS_IMP(G, ADD, NEG, MUL, NORM, IS_ONE)					\
+	static int G##_dlog_bsgs(dig_t *k, const G##_t a, const G##_t s,		\
+			const pc_dlog_t t, dig_t r) {									\
+		int result = RLC_ERR;												\
+		uint64_t i, n, key;													\
+		dig_t c, j, m = t->m;												\
+		G##_t g, u, v;														\
+																			\
+		G##_null(g);														\
+		G##_null(u);														\
+		G##_null(v);														\
+																			\
+		RLC_TRY {															\
+			G##_new(g);														\
+			G##_new(u);														\
+			G##_new(v);														\
+																			\
+			/* Each giant step subtracts m baby steps. */					\
+			MUL(g, s, m);													\
+			NEG(g, g);														\
+			NORM(g, g);														\
+			NORM(u, a);														\
+			for (c = 0; result != RLC_OK && c < r; c += m) {				\
+				if (IS_ONE(u)) {											\
+					*k = c;													\
+					result = RLC_OK;										\
+					break;													\
+				}															\
+				key = G##_dlog_map(u);										\
+				i = key & (t->len - 1);										\
+				n = 0;														\
+				while ((j = pc_dlog_get(t, key, &i, &n)) != 0) {			\
+					/* Discard collisions of the fingerprints. */			\
+					if (j < r - c) {										\
+						MUL(v, s, c + j);									\
+						if (G##_cmp(v, a) == RLC_EQ) {						\
+							*k = c + j;										\
+							result = RLC_OK;								\
+							break;											\
+						}													\
+					}														\
+				}															\
+				if (r - c <= m) {											\
+					break;													\
+				}															\
+				ADD(u, u, g);												\
+				NORM(u, u);													\
+			}																\
+		}																	\
+		RLC_CATCH_ANY {														\
+			result = RLC_ERR;												\
+		}																	\
+		RLC_FINALLY {														\
+			G##_free(g);													\
+			G##_free(u);													\
+			G##_free(v);													\
+		}																	\
+		return result;														\
+	}
+
+/**
+ * Defines a template for computing a discrete logarithm with the Pollard
+ * kangaroo method.
+ *
+ * @param[in] G			- the group prefix.
+ * @param[in] ADD		- the group operation.
+ * @param[in] DBL		- the group operation of an element with itself.
+ * @param[in] MUL		- the exponentiation by a digit.
+ * @param[in] NORM		- the normalization of an element.
+ * @param[in] NORM_SIM	- the simultaneous normalization of elements.
+ */
+#define TMPL_DLOG_KAN_IMP(G, ADD, DBL, MUL, NORM, NORM_SIM)					\
+	static int G##_dlog_kan(dig_t *k, const G##_t a, const G##_t s, dig_t w, \
+			int tries) {													\
+		int c, h, n, result = RLC_ERR;										\
+		uint64_t key, trap;													\
+		dig_t d, e, mean;													\
+		G##_t u, v, *j;														\
+																			\
+		if (w > ((dig_t)1 << (RLC_DIG - 4))) {								\
+			RLC_THROW(ERR_NO_VALID);										\
+			return RLC_ERR;													\
+		}																	\
+																			\
+		n = pc_dlog_len(&mean, w);											\
+		j = RLC_ALLOCA(G##_t, n);											\
+																			\
+		G##_null(u);														\
+		G##_null(v);														\
+		for (h = 0; j != NULL && h < n; h++) {								\
+			G##_null(j[h]);													\
+		}																	\
+																			\
+		RLC_TRY {															\
+			if (j == NULL) {												\
+				RLC_THROW(ERR_NO_MEMORY);									\
+			}																\
+			G##_new(u);														\
+			G##_new(v);														\
+			for (h = 0; h < n; h++) {										\
+				G##_new(j[h]);												\
+			}																\
+																			\
+			/* The jumps are the multiples of the base by powers of two. */	\
+			G##_copy(j[0], s);												\
+			for (h = 1; h < n; h++) {										\
+				DBL(j[h], j[h - 1]);										\
+			}																\
+			NORM_SIM(j, j, n);												\
+																			\
+			for (c = 0; result != RLC_OK && c < tries; c++) {				\
+				/* The tame kangaroo starts at the end of the range. */		\
+				MUL(u, s, w - 1);											\
+				NORM(u, u);													\
+				for (d = e = 0; e < 4 * mean; e++) {						\
+					h = pc_dlog_jmp(G##_dlog_map(u), c, n);					\
+					ADD(u, u, j[h]);										\
+					NORM(u, u);												\
+					d += (dig_t)1 << h;										\
+				}															\
+				trap = G##_dlog_map(u);										\
+																			\
+				/* The wild kangaroo follows the tame one after landing on	\
+				 * any of its positions, so it falls in the trap first. */	\
+				NORM(v, a);													\
+				e = 0;														\
+				while (e <= w - 1 + d) {									\
+					key = G##_dlog_map(v);									\
+					if (key == trap && G##_cmp(u, v) == RLC_EQ) {			\
+						*k = w - 1 + d - e;									\
+						result = RLC_OK;									\
+						break;												\
+					}														\
+					h = pc_dlog_jmp(key, c, n);								\
+					ADD(v, v, j[h]);										\
+					NORM(v, v);												\
+					e += (dig_t)1 << h;										\
+				}															\
+			}																\
+		}																	\
+		RLC_CATCH_ANY {														\
+			result = RLC_ERR;												\
+		}																	\
+		RLC_FINALLY {														\
+			G##_free(u);													\
+			G##_free(v);													\
+			for (h = 0; j != NULL && h < n; h++) {							\
+				G##_free(j[h]);												\
+			}																\
+			RLC_FREE(j);													\
+		}																	\
+		return result;														\
+	}
+
+/**
+ * Defines a template for building a table of baby steps.
+ *
+ * @param[in] G			- the group prefix.
+ * @param[in] ADD		- the group operation.
+ * @param[in] SET_ONE	- the assignment of the identity.
+ * @param[in] NORM_SIM	- the simultaneous normalization of elements.
+ */
+#define TMPL_DLOG_PRE_IMP(G, ADD, SET_ONE, NORM_SIM)						\
+	int G##_dlog_pre(pc_dlog_t t, const G##_t s, dig_t m) {					\
+		int result = RLC_OK;												\
+		dig_t h, i, l;														\
+		G##_t u, *v = RLC_ALLOCA(G##_t, PC_DLOG_CHUNK);						\
+																			\
+		/* Start empty, so that the table can be freed on any error. */		\
+		t->key = NULL;														\
+		t->val = NULL;														\
+		t->len = t->m = 0;													\
+		t->own = 0;															\
+																			\
+		G##_null(u);														\
+		for (h = 0; v != NULL && h < PC_DLOG_CHUNK; h++) {					\
+			G##_null(v[h]);													\
+		}																	\
+																			\
+		RLC_TRY {															\
+			if (v == NULL) {												\
+				RLC_THROW(ERR_NO_MEMORY);									\
+			}																\
+			if (m == 0 || (uint64_t)m > UINT32_MAX) {						\
+				RLC_THROW(ERR_NO_VALID);									\
+			}																\
+			G##_new(u);														\
+			for (h = 0; h < PC_DLOG_CHUNK; h++) {							\
+				G##_new(v[h]);												\
+			}																\
+																			\
+			pc_dlog_new(t, G##_dlog_map(s), m);								\
+			SET_ONE(u);														\
+			for (i = 1; i <= m; i += l) {									\
+				/* Normalize the baby steps in chunks to share inversions. */ \
+				l = RLC_MIN(PC_DLOG_CHUNK, m - i + 1);						\
+				for (h = 0; h < l; h++) {									\
+					ADD(u, u, s);											\
+					G##_copy(v[h], u);										\
+				}															\
+				NORM_SIM(v, v, l);											\
+				for (h = 0; h < l; h++) {									\
+					pc_dlog_add(t, G##_dlog_map(v[h]), i + h);				\
+				}															\
+				G##_copy(u, v[l - 1]);										\
+			}																\
+		}																	\
+		RLC_CATCH_ANY {														\
+			pc_dlog_free(t);												\
+			result = RLC_ERR;												\
+		}																	\
+		RLC_FINALLY {														\
+			G##_free(u);													\
+			for (h = 0; v != NULL && h < PC_DLOG_CHUNK; h++) {				\
+				G##_free(v[h]);												\
+			}																\
+			RLC_FREE(v);													\
+		}																	\
+		return result;														\
+	}
+
+/**
+ * Defines a template for computing a discrete logarithm in a range.
+ *
+ * @param[in] G			- the group prefix.
+ * @param[in] IS_ONE	- the test for the identity.
+ */
+#define TMPL_DLOG_IMP(G, IS_ONE)											\
+	int G##_dlog(dig_t *k, const G##_t a, const G##_t s, const pc_dlog_t t,	\
+			dig_t r) {														\
+		int result = RLC_ERR;												\
+		pc_dlog_t u;														\
+		dig_t m, w;															\
+																			\
+		if (t != NULL && t->id != G##_dlog_map(s)) {						\
+			RLC_THROW(ERR_NO_VALID);										\
+			return RLC_ERR;													\
+		}																	\
+		if (r > 0 && IS_ONE(a)) {											\
+			*k = 0;															\
+			return RLC_OK;													\
+		}																	\
+																			\
+		/* Search in ranges growing by 16 so that the cost depends on the	\
+		 * logarithm, not on the bound. */									\
+		for (w = RLC_MIN(r, 256); w > 0 && result != RLC_OK;				\
+				w = (w > r / 16 ? r : 16 * w)) {							\
+			for (m = 1; m < w / m; m <<= 1);								\
+			if (t != NULL && w / t->m <= 4 * t->m) {						\
+				result = G##_dlog_bsgs(k, a, s, t, w);						\
+			} else if (m <= RLC_PC_DLOG_MAX) {								\
+				result = G##_dlog_pre(u, s, m);								\
+				if (result == RLC_OK) {										\
+					result = G##_dlog_bsgs(k, a, s, u, w);					\
+					pc_dlog_free(u);										\
+				}															\
+			} else {														\
+				result = G##_dlog_kan(k, a, s, w,							\
+						(w == r ? RLC_PC_DLOG_TRY : 1));					\
+			}																\
+			if (w == r) {													\
+				break;														\
+			}																\
+		}																	\
+		if (result == RLC_OK && *k >= r) {									\
+			result = RLC_ERR;												\
+		}																	\
+		return result;														\
+	}
@@ -2072,6 +2072,193 @@ static int inversion(void) {
 	return code;
 }
 
+static int polynomial(void) {
+	int code = RLC_ERR;
+	const size_t n = 100;
+	bn_t a[100], b[100], c[100], m, x, y, z;
+	dig_t *u = NULL, *v = NULL, *w = NULL;
+	bn_pol_t p;
+
+	bn_null(m);
+	bn_null(x);
+	bn_null(y);
+	bn_null(z);
+	for (size_t i = 0; i < n; i++) {
+		bn_null(a[i]);
+		bn_null(b[i]);
+		bn_null(c[i]);
+	}
+
+	RLC_TRY {
+		bn_new(m);
+		bn_new(x);
+		bn_new(y);
+		bn_new(z);
+		for (size_t i = 0; i < n; i++) {
+			bn_new(a[i]);
+			bn_new(b[i]);
+			bn_new(c[i]);
+		}
+		u = (dig_t *)calloc(2 * n * RLC_BN_DIGS, sizeof(dig_t));
+		v = (dig_t *)calloc(2 * n * RLC_BN_DIGS, sizeof(dig_t));
+		w = (dig_t *)calloc(2 * n * RLC_BN_DIGS, sizeof(dig_t));
+		if (u == NULL || v == NULL || w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		/* Find a prime m such that 2^16 divides m - 1. */
+		do {
+			bn_rand(m, RLC_POS, RLC_MIN(240, RLC_BN_BITS - 16));
+			bn_lsh(m, m, 16);
+			bn_add_dig(m, m, 1);
+		} while (!bn_is_prime(m));
+		bn_pol_pre(p, m);
+
+		TEST_CASE("number theoretic transform is correct") {
+			TEST_ASSERT(p->s >= 16, end);
+			for (size_t i = 0; i < 64; i++) {
+				bn_rand_mod(a[i], m);
+			}
+			bn_pol_set(u, a, 64, p);
+			bn_pol_set(v, a, 64, p);
+			bn_pol_ntt(u, 64, p);
+			bn_pol_get(b, u, 64, p);
+			bn_pol_get(&x, p->root, 1, p);
+			bn_set_2b(y, p->s - 6);
+			bn_mxp(x, x, y, m);
+			bn_set_dig(y, 1);
+			for (size_t i = 0; i < 64; i += 21) {
+				bn_evl(z, a, y, m, 64);
+				TEST_ASSERT(bn_cmp(z, b[i]) == RLC_EQ, end);
+				for (size_t j = 0; j < 21; j++) {
+					bn_mul(y, y, x);
+					bn_mod(y, y, m);
+				}
+			}
+			bn_pol_itt(u, 64, p);
+			TEST_ASSERT(dv_cmp(u, v, 64 * p->w) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("polynomial multiplication is correct") {
+			for (size_t i = 0; i < n; i++) {
+				bn_rand_mod(a[i], m);
+			}
+			bn_pol_set(u, a, n, p);
+			bn_pol_mul(v, u, 40, u + 40 * p->w, 60, p);
+			bn_pol_get(b, v, 99, p);
+			bn_rand_mod(x, m);
+			bn_evl(y, a, x, m, 40);
+			bn_evl(z, a + 40, x, m, 60);
+			bn_mul(y, y, z);
+			bn_mod(y, y, m);
+			bn_evl(z, b, x, m, 99);
+			TEST_ASSERT(bn_cmp(y, z) == RLC_EQ, end);
+			bn_pol_mul(v, u, 3, u + 3 * p->w, 5, p);
+			bn_pol_get(b, v, 7, p);
+			bn_evl(y, a, x, m, 3);
+			bn_evl(z, a + 3, x, m, 5);
+			bn_mul(y, y, z);
+			bn_mod(y, y, m);
+			bn_evl(z, b, x, m, 7);
+			TEST_ASSERT(bn_cmp(y, z) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("polynomial division is correct") {
+			for (size_t i = 0; i < n; i++) {
+				bn_rand_mod(a[i], m);
+			}
+			bn_lag(b, a, m, 39);
+			bn_pol_set(u, a, n, p);
+			bn_pol_set(v, b, 40, p);
+			bn_pol_div(w, w + 61 * p->w, u, n, v, 40, p);
+			bn_pol_get(c, w, 100, p);
+			bn_rand_mod(x, m);
+			bn_evl(y, c, x, m, 61);
+			bn_evl(z, b, x, m, 40);
+			bn_mul(y, y, z);
+			bn_evl(z, c + 61, x, m, 39);
+			bn_add(y, y, z);
+			bn_mod(y, y, m);
+			bn_evl(z, a, x, m, n);
+			TEST_ASSERT(bn_cmp(y, z) == RLC_EQ, end);
+			bn_pol_div(w, w + 91 * p->w, u, n, v + 30 * p->w, 10, p);
+			bn_pol_get(c, w, 100, p);
+			bn_evl(y, c, x, m, 91);
+			bn_evl(z, b + 30, x, m, 10);
+			bn_mul(y, y, z);
+			bn_evl(z, c + 91, x, m, 9);
+			bn_add(y, y, z);
+			bn_mod(y, y, m);
+			bn_evl(z, a, x, m, n);
+			TEST_ASSERT(bn_cmp(y, z) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("polynomial from roots is correct") {
+			for (size_t i = 0; i < 70; i++) {
+				bn_rand_mod(a[i], m);
+			}
+			bn_lag(b, a, m, 70);
+			TEST_ASSERT(bn_cmp_dig(b[70], 1) == RLC_EQ, end);
+			for (size_t i = 0; i < 70; i++) {
+				bn_evl(z, b, a[i], m, 71);
+				TEST_ASSERT(bn_is_zero(z), end);
+			}
+			bn_lag(c, a, m, 5);
+			TEST_ASSERT(bn_cmp_dig(c[5], 1) == RLC_EQ, end);
+			bn_evl(z, c, a[3], m, 6);
+			TEST_ASSERT(bn_is_zero(z), end);
+		} TEST_END;
+
+		TEST_CASE("multipoint evaluation is correct") {
+			for (size_t i = 0; i < n; i++) {
+				bn_rand_mod(a[i], m);
+				bn_rand_mod(b[i], m);
+			}
+			bn_pol_set(u, a, 70, p);
+			bn_pol_set(v, b, n, p);
+			bn_pol_evl(w, u, 70, v, n, p);
+			bn_pol_get(c, w, n, p);
+			for (size_t i = 0; i < n; i++) {
+				bn_evl(z, a, b[i], m, 70);
+				TEST_ASSERT(bn_cmp(z, c[i]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_CASE("polynomial interpolation is correct") {
+			for (size_t i = 0; i < 70; i++) {
+				bn_rand_mod(a[i], m);
+				bn_rand_mod(b[i], m);
+			}
+			bn_pol_set(u, a, 70, p);
+			bn_pol_set(v, b, 70, p);
+			bn_pol_itp(w, u, v, 70, p);
+			bn_pol_get(c, w, 70, p);
+			for (size_t i = 0; i < 70; i++) {
+				bn_evl(z, c, a[i], m, 70);
+				TEST_ASSERT(bn_cmp(z, b[i]) == RLC_EQ, end);
+			}
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(m);
+	bn_free(x);
+	bn_free(y);
+	bn_free(z);
+	for (size_t i = 0; i < n; i++) {
+		bn_free(a[i]);
+		bn_free(b[i]);
+		bn_free(c[i]);
+	}
+	free(u);
+	free(v);
+	free(w);
+	return code;
+}
+
 static int factor(void) {
 	int code = RLC_ERR;
 	bn_t p, q, n;
@@ -2552,6 +2739,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (polynomial() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (factor() != RLC_OK) {
 		core_clean();
 		return 1;
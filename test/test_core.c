@@ -62,9 +62,88 @@ void *tester(void *ptr) {
 	return NULL;
 }
 
+static ctx_t *shared_ctx;
+
+void *sharer(void *ptr) {
+	int *code = (int *)ptr;
+	*code = RLC_ERR;
+	if (core_share(shared_ctx) == RLC_OK && core_get()->pre == shared_ctx->pre) {
+		*code = RLC_OK;
+	}
+	core_clean();
+	return NULL;
+}
+
 #endif
 #endif
 
+#if defined(WITH_EP)
+
+static int handles(void) {
+	int code = RLC_ERR, param = ep_param_get(), pa = 0, pb = 0;
+	ctx_t *a = NULL, *b = NULL, *old_ctx = core_get();
+	bn_t n;
+	ep_t p;
+
+	bn_null(n);
+	ep_null(p);
+
+	TEST_ONCE("switching between curve handles is correct") {
+		a = core_new();
+		b = core_new();
+		TEST_ASSERT(a != NULL && b != NULL, end);
+		/* Creating handles does not change the current context. */
+		TEST_ASSERT(core_get() == old_ctx && ep_param_get() == param, end);
+		core_set(a);
+		if (ep_param_set_any_endom() == RLC_OK) {
+			pa = ep_param_get();
+		}
+		core_set(b);
+		if (ep_param_set_any_plain() == RLC_OK) {
+			pb = ep_param_get();
+		}
+		core_set(old_ctx);
+		if (pa != 0 && pb != 0 && pa != pb) {
+			RLC_TRY {
+				for (int i = 0; i < 2; i++) {
+					core_set(i == 0 ? a : b);
+					bn_new(n);
+					ep_new(p);
+					TEST_ASSERT(ep_param_get() == (i == 0 ? pa : pb), end);
+					/* Parameters and tables are ready without recomputation. */
+					ep_curve_get_ord(n);
+					ep_mul_gen(p, n);
+					TEST_ASSERT(ep_is_infty(p), end);
+					ep_rand(p);
+					TEST_ASSERT(ep_on_curve(p), end);
+					bn_free(n);
+					ep_free(p);
+				}
+			} RLC_CATCH_ANY {
+				RLC_ERROR(end);
+			}
+			core_set(old_ctx);
+		}
+		TEST_ASSERT(ep_param_get() == param, end);
+	} TEST_END;
+
+	code = RLC_OK;
+
+  end:
+	/* Always restore the original context before releasing the handles. */
+	core_set(old_ctx);
+	bn_free(n);
+	ep_free(p);
+	core_free(a);
+	core_free(b);
+	if (core_get() != old_ctx) {
+		code = RLC_ERR;
+	}
+	return code;
+}
+
+#endif
+
 int main(void) {
 	int code = RLC_ERR;
 
@@ -100,6 +179,60 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+	TEST_ONCE("sharing the library parameters is correct") {
+		ctx_t new_ctx, *old_ctx;
+		old_ctx = core_get();
+		memset(&new_ctx, 0, sizeof(ctx_t));
+		core_set(&new_ctx);
+		/* Sharing into an initialized context releases its parameters. */
+		TEST_ASSERT(core_init() == RLC_OK, end);
+		TEST_ASSERT(core_get()->pre != old_ctx->pre, end);
+		/* Initialize the new context with the parameters of the old one. */
+		TEST_ASSERT(core_share(old_ctx) == RLC_OK, end);
+		TEST_ASSERT(core_get()->pre == old_ctx->pre, end);
+		TEST_ASSERT(old_ctx->pre->refs == 2, end);
+#if defined(WITH_EP) && defined(EP_PRECO)
+		TEST_ASSERT(ep_curve_get_tab()[0] == &(old_ctx->pre->ep_pre[0]), end);
+#endif
+		/* Errors are still private to each context. */
+		RLC_THROW(ERR_NO_MEMORY);
+		core_set(old_ctx);
+		TEST_ASSERT(err_get_code() == RLC_OK, end);
+		core_set(&new_ctx);
+		TEST_ASSERT(err_get_code() == RLC_ERR, end);
+		core_clean();
+		core_set(old_ctx);
+		TEST_ASSERT(core_get()->pre != NULL && core_get()->pre->refs == 1, end);
+	} TEST_END;
+
+#if ALLOC == POOL
+	TEST_ONCE("memory pool recycles blocks") {
+		uint8_t *p, *q;
+		p = (uint8_t *)pool_alloc(100);
+		TEST_ASSERT(p != NULL, end);
+		memset(p, 0xFF, 100);
+		pool_free(p);
+		/* A block from the same size class is reused. */
+		q = (uint8_t *)pool_calloc(1, 120);
+		TEST_ASSERT(q == p && q[0] == 0 && q[119] == 0, end);
+		q[0] = 1;
+		/* Growing the block preserves its contents. */
+		p = (uint8_t *)pool_realloc(q, 1000);
+		TEST_ASSERT(p != NULL && p[0] == 1, end);
+		pool_free(p);
+		TEST_ASSERT(core_get()->pool[6] == p, end);
+		pool_clean();
+		TEST_ASSERT(core_get()->pool[6] == NULL, end);
+	} TEST_END;
+#endif
+
+#if defined(WITH_EP)
+	if (handles() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+#endif
+
 	code = RLC_OK;
 
 #if defined(MULTI)
@@ -162,6 +295,24 @@ int main(void) {
 		}
 		TEST_ASSERT(code == RLC_OK, end);
 	} TEST_END;
+
+	TEST_ONCE("library parameters are shared across threads") {
+		pthread_t thread[CORES];
+		int result[CORES] = { RLC_OK };
+		shared_ctx = core_get();
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_create(&(thread[i]), NULL, sharer, &(result[i]))) {
+				code = RLC_ERR;
+			}
+		}
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_join(thread[i], NULL) || result[i] != RLC_OK) {
+				code = RLC_ERR;
+			}
+		}
+		TEST_ASSERT(code == RLC_OK, end);
+		TEST_ASSERT(core_get()->pre->refs == 1, end);
+	} TEST_END;
 #endif
 #endif
 
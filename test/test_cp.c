@@ -688,6 +688,138 @@ static int ecss(void) {
 	return code;
 }
 
+static int ecpk(void) {
+	int code = RLC_ERR;
+	bn_t d, r, s;
+	ec_t q;
+	ec_pubkey_t p;
+	ec_pubkey_st *k;
+	ec_cache_t c;
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, b[2 * RLC_FC_BYTES + 1];
+	size_t l;
+
+	bn_null(d);
+	bn_null(r);
+	bn_null(s);
+	ec_null(q);
+	ec_pubkey_null(p);
+	memset(c, 0, sizeof(ec_cache_t));
+
+	RLC_TRY {
+		bn_new(d);
+		bn_new(r);
+		bn_new(s);
+		ec_new(q);
+		ec_pubkey_new(p);
+
+		TEST_CASE("ecdsa signature with precomputed key is correct") {
+			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+			TEST_ASSERT(cp_ecpk_pre(p, q) == RLC_OK, end);
+			TEST_ASSERT(cp_ecdsa_sig(r, s, m, sizeof(m), 0, d) == RLC_OK, end);
+			TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0, p) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0, p) == 0, end);
+			m[0] ^= 1;
+			ec_set_infty(q);
+			TEST_ASSERT(cp_ecpk_pre(p, q) == RLC_ERR, end);
+		}
+		TEST_END;
+
+		TEST_CASE("ecss signature with precomputed key is correct") {
+			TEST_ASSERT(cp_ecss_gen(d, q) == RLC_OK, end);
+			TEST_ASSERT(cp_ecpk_pre(p, q) == RLC_OK, end);
+			TEST_ASSERT(cp_ecss_sig(r, s, m, sizeof(m), d) == RLC_OK, end);
+			TEST_ASSERT(cp_ecss_ver_pre(r, s, m, sizeof(m), p) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_ecss_ver_pre(r, s, m, sizeof(m), p) == 0, end);
+			m[0] ^= 1;
+		}
+		TEST_END;
+
+		TEST_CASE("cache of precomputed keys is correct") {
+			TEST_ASSERT(cp_ecpk_init(c, 1) == RLC_ERR, end);
+			TEST_ASSERT(cp_ecpk_init(c, 1 << 16) == RLC_OK, end);
+			TEST_ASSERT(cp_ecpk_get(c, b, 0) == NULL, end);
+			/* Insert more keys than fit, so that some are evicted. */
+			for (int i = 0; i < 64; i++) {
+				TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+				TEST_ASSERT(cp_ecdsa_sig(r, s, m, sizeof(m), 0, d) == RLC_OK,
+						end);
+				l = ec_size_bin(q, 1);
+				ec_write_bin(b, l, q, 1);
+				k = cp_ecpk_get(c, b, l);
+				TEST_ASSERT(k != NULL, end);
+				TEST_ASSERT(cp_ecpk_get(c, b, l) == k, end);
+				TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0, k) == 1,
+						end);
+			}
+			cp_ecpk_clean(c);
+		}
+		TEST_END;
+
+		TEST_CASE("cache of precomputed keys refetches evicted keys") {
+			/* Find the smallest budget accepted, which gives a single set. */
+			for (l = 1; cp_ecpk_init(c, l) != RLC_OK; l <<= 1);
+			TEST_ASSERT(c->n > 0 && c->n < 8, end);
+			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+			TEST_ASSERT(cp_ecdsa_sig(r, s, m, sizeof(m), 0, d) == RLC_OK, end);
+			l = ec_size_bin(q, 1);
+			ec_write_bin(b, l, q, 1);
+			TEST_ASSERT(cp_ecpk_get(c, b, l) != NULL, end);
+			/* Fill the set with other keys, evicting the first one. */
+			for (size_t i = 0; i < c->n; i++) {
+				uint8_t e[2 * RLC_FC_BYTES + 1];
+				ec_rand(q);
+				ec_write_bin(e, l, q, 1);
+				TEST_ASSERT(cp_ecpk_get(c, e, l) != NULL, end);
+			}
+			for (size_t i = 0; i < c->n; i++) {
+				TEST_ASSERT(c->l[i] != l || memcmp(c->b + i * sizeof(b), b,
+						l) != 0, end);
+			}
+			k = cp_ecpk_get(c, b, l);
+			TEST_ASSERT(k != NULL, end);
+			TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0, k) == 1, end);
+			TEST_ASSERT(cp_ecpk_get(c, b, l) == k, end);
+			cp_ecpk_clean(c);
+		}
+		TEST_END;
+
+		TEST_CASE("cache of precomputed keys rejects invalid keys") {
+			TEST_ASSERT(cp_ecpk_init(c, 1 << 16) == RLC_OK, end);
+			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+			l = ec_size_bin(q, 0);
+			ec_write_bin(b, l, q, 0);
+			/* Invalid prefix. */
+			b[0] ^= 0xFF;
+			TEST_ASSERT(cp_ecpk_get(c, b, l) == NULL, end);
+			b[0] ^= 0xFF;
+			/* Point not on the curve. */
+			b[l - 1] ^= 1;
+			TEST_ASSERT(cp_ecpk_get(c, b, l) == NULL, end);
+			b[l - 1] ^= 1;
+			/* Invalid length. */
+			TEST_ASSERT(cp_ecpk_get(c, b, l - 1) == NULL, end);
+			TEST_ASSERT(cp_ecpk_get(c, b, l) != NULL, end);
+			cp_ecpk_clean(c);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+
+  end:
+	cp_ecpk_clean(c);
+	bn_free(d);
+	bn_free(r);
+	bn_free(s);
+	ec_free(q);
+	ec_pubkey_free(p);
+	return code;
+}
+
 static int vbnn(void) {
 	int code = RLC_ERR;
 	uint8_t ida[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
@@ -1158,6 +1290,124 @@ static int pedersen(void) {
 	return code;
 }
 
+#define IPA_N	16
+#define IPA_K	4
+
+static int ipa(void) {
+	int code = RLC_ERR;
+	ec_t p, u, g[IPA_N], h[IPA_N], l[IPA_K], r[IPA_K], t[2 * IPA_N + 1];
+	bn_t n, x, y, a[IPA_N], b[IPA_N], k[2 * IPA_N + 1];
+
+	bn_null(n);
+	bn_null(x);
+	bn_null(y);
+	ec_null(p);
+	ec_null(u);
+	for (int i = 0; i < IPA_N; i++) {
+		ec_null(g[i]);
+		ec_null(h[i]);
+		bn_null(a[i]);
+		bn_null(b[i]);
+	}
+	for (int i = 0; i < IPA_K; i++) {
+		ec_null(l[i]);
+		ec_null(r[i]);
+	}
+	for (int i = 0; i <= 2 * IPA_N; i++) {
+		ec_null(t[i]);
+		bn_null(k[i]);
+	}
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(x);
+		bn_new(y);
+		ec_new(p);
+		ec_new(u);
+		for (int i = 0; i < IPA_N; i++) {
+			ec_new(g[i]);
+			ec_new(h[i]);
+			bn_new(a[i]);
+			bn_new(b[i]);
+		}
+		for (int i = 0; i < IPA_K; i++) {
+			ec_new(l[i]);
+			ec_new(r[i]);
+		}
+		for (int i = 0; i <= 2 * IPA_N; i++) {
+			ec_new(t[i]);
+			bn_new(k[i]);
+		}
+
+		ec_curve_get_ord(n);
+		TEST_ASSERT(cp_ipa_gen(g, h, u, IPA_N) == RLC_OK, end);
+
+		TEST_CASE("inner product argument is correct") {
+			/* Commit to random vectors as P = <a, g> + <b, h> + <a, b> * u. */
+			bn_zero(k[2 * IPA_N]);
+			for (int i = 0; i < IPA_N; i++) {
+				bn_rand_mod(a[i], n);
+				bn_rand_mod(b[i], n);
+				bn_copy(k[i], a[i]);
+				bn_copy(k[IPA_N + i], b[i]);
+				bn_mul(x, a[i], b[i]);
+				bn_add(k[2 * IPA_N], k[2 * IPA_N], x);
+				ec_copy(t[i], g[i]);
+				ec_copy(t[IPA_N + i], h[i]);
+			}
+			bn_mod(k[2 * IPA_N], k[2 * IPA_N], n);
+			ec_copy(t[2 * IPA_N], u);
+			ec_mul_sim_lot(p, (const ec_t *)t, (const bn_t *)k, 2 * IPA_N + 1);
+			TEST_ASSERT(cp_ipa_prv(l, r, x, y, p, (const ec_t *)g,
+					(const ec_t *)h, u, (const bn_t *)a, (const bn_t *)b,
+					IPA_N) == RLC_OK, end);
+			TEST_ASSERT(cp_ipa_ver(p, (const ec_t *)l, (const ec_t *)r, x, y,
+					(const ec_t *)g, (const ec_t *)h, u, IPA_N) == 1, end);
+		} TEST_END;
+
+		TEST_CASE("inner product argument rejects invalid proofs") {
+			TEST_ASSERT(cp_ipa_prv(l, r, x, y, p, (const ec_t *)g,
+					(const ec_t *)h, u, (const bn_t *)a, (const bn_t *)b,
+					IPA_N) == RLC_OK, end);
+			bn_add_dig(x, x, 1);
+			TEST_ASSERT(cp_ipa_ver(p, (const ec_t *)l, (const ec_t *)r, x, y,
+					(const ec_t *)g, (const ec_t *)h, u, IPA_N) == 0, end);
+			bn_sub_dig(x, x, 1);
+			ec_dbl(p, p);
+			TEST_ASSERT(cp_ipa_ver(p, (const ec_t *)l, (const ec_t *)r, x, y,
+					(const ec_t *)g, (const ec_t *)h, u, IPA_N) == 0, end);
+			TEST_ASSERT(cp_ipa_prv(l, r, x, y, p, (const ec_t *)g,
+					(const ec_t *)h, u, (const bn_t *)a, (const bn_t *)b,
+					IPA_N - 1) == RLC_ERR, end);
+		} TEST_END;
+	} RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+
+  end:
+	bn_free(n);
+	bn_free(x);
+	bn_free(y);
+	ec_free(p);
+	ec_free(u);
+	for (int i = 0; i < IPA_N; i++) {
+		ec_free(g[i]);
+		ec_free(h[i]);
+		bn_free(a[i]);
+		bn_free(b[i]);
+	}
+	for (int i = 0; i < IPA_K; i++) {
+		ec_free(l[i]);
+		ec_free(r[i]);
+	}
+	for (int i = 0; i <= 2 * IPA_N; i++) {
+		ec_free(t[i]);
+		bn_free(k[i]);
+	}
+	return code;
+}
+
 static int oprf(void) {
 	int code = RLC_ERR;
 	ec_t c, h;
@@ -1727,7 +1977,7 @@ static int bgn(void) {
 }
 
 static int bls(void) {
-	int code = RLC_ERR;
+	int code = RLC_ERR, b[2];
 	bn_t d;
 	g1_t s[2];
 	g2_t q[2];
@@ -1795,6 +2045,24 @@ static int bls(void) {
 			TEST_ASSERT(cp_bls_agg_ver(s[0], ms, ls, 2, q) == 0, end);
 		}
 		TEST_END;
+
+		TEST_CASE("boneh-lynn-schacham batch verification is correct") {
+			TEST_ASSERT(cp_bls_gen(d, q[0]) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_sig(s[0], ms[0], ls[0], d) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_gen(d, q[1]) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_sig(s[1], ms[1], ls[1], d) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_batch_ver(b, s, ms, ls, 2, q) == 1, end);
+			TEST_ASSERT(b[0] == 1 && b[1] == 1, end);
+			TEST_ASSERT(cp_bls_batch_ver(NULL, s, ms, ls, 2, q) == 1, end);
+			/* Sign the first message with the wrong key. */
+			TEST_ASSERT(cp_bls_sig(s[0], ms[0], ls[0], d) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_batch_ver(b, s, ms, ls, 2, q) == 0, end);
+			TEST_ASSERT(b[0] == 0 && b[1] == 1, end);
+			g2_set_infty(q[1]);
+			TEST_ASSERT(cp_bls_batch_ver(b, s, ms, ls, 2, q) == 0, end);
+			TEST_ASSERT(b[0] == 0 && b[1] == 0, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -2448,9 +2716,186 @@ static int lhs(void) {
 	return code;
 }
 
+#define KZG_N	16			/* Number of coefficients. */
+#define KZG_K	4			/* Number of points in a multi-point opening. */
+#define KZG_L	3			/* Number of openings in a batch. */
+
+static int kzg(void) {
+	int code = RLC_ERR;
+	bn_t e, q, z[KZG_K], y[KZG_K], a[KZG_N];
+	g1_t c[KZG_L], pi[KZG_L], s[KZG_N], u[KZG_N];
+	g2_t t[KZG_K + 1], v[KZG_K + 1];
+	uint8_t *bin = NULL;
+	size_t len;
+
+	bn_null(e);
+	bn_null(q);
+	for (int i = 0; i < KZG_K; i++) {
+		bn_null(z[i]);
+		bn_null(y[i]);
+	}
+	for (int i = 0; i < KZG_N; i++) {
+		bn_null(a[i]);
+		g1_null(s[i]);
+		g1_null(u[i]);
+	}
+	for (int i = 0; i < KZG_L; i++) {
+		g1_null(c[i]);
+		g1_null(pi[i]);
+	}
+	for (int i = 0; i <= KZG_K; i++) {
+		g2_null(t[i]);
+		g2_null(v[i]);
+	}
+
+	RLC_TRY {
+		bn_new(e);
+		bn_new(q);
+		for (int i = 0; i < KZG_K; i++) {
+			bn_new(z[i]);
+			bn_new(y[i]);
+		}
+		for (int i = 0; i < KZG_N; i++) {
+			bn_new(a[i]);
+			g1_new(s[i]);
+			g1_new(u[i]);
+		}
+		for (int i = 0; i < KZG_L; i++) {
+			g1_new(c[i]);
+			g1_new(pi[i]);
+		}
+		for (int i = 0; i <= KZG_K; i++) {
+			g2_new(t[i]);
+			g2_new(v[i]);
+		}
+
+		pc_get_ord(q);
+		TEST_ASSERT(cp_kzg_gen(s, KZG_N, t, KZG_K + 1) == RLC_OK, end);
+		len = cp_kzg_size(KZG_N, KZG_K + 1);
+		bin = RLC_ALLOCA(uint8_t, len);
+		TEST_ASSERT(bin != NULL, end);
+
+		TEST_CASE("kate-zaverucha-goldberg commitment is correct") {
+			for (int i = 0; i < KZG_N; i++) {
+				bn_rand_mod(a[i], q);
+			}
+			bn_rand_mod(z[0], q);
+			TEST_ASSERT(cp_kzg_com(c[0], a, KZG_N, s) == RLC_OK, end);
+			TEST_ASSERT(cp_kzg_prv(pi[0], y[0], a, KZG_N, z[0], s) == RLC_OK,
+					end);
+			bn_evl(e, a, z[0], q, KZG_N);
+			TEST_ASSERT(bn_cmp(y[0], e) == RLC_EQ, end);
+			TEST_ASSERT(cp_kzg_ver(c[0], z[0], y[0], pi[0], t) == 1, end);
+			bn_add_dig(y[0], y[0], 1);
+			TEST_ASSERT(cp_kzg_ver(c[0], z[0], y[0], pi[0], t) == 0, end);
+		}
+		TEST_END;
+
+		TEST_CASE("kate-zaverucha-goldberg multi-point opening is correct") {
+			for (int i = 0; i < KZG_N; i++) {
+				bn_rand_mod(a[i], q);
+			}
+			for (int i = 0; i < KZG_K; i++) {
+				bn_rand_mod(z[i], q);
+			}
+			TEST_ASSERT(cp_kzg_com(c[0], a, KZG_N, s) == RLC_OK, end);
+			TEST_ASSERT(cp_kzg_prv_sim(pi[0], y, a, KZG_N, z, KZG_K,
+					s) == RLC_OK, end);
+			TEST_ASSERT(cp_kzg_ver_sim(c[0], z, y, KZG_K, pi[0], s, t) == 1,
+					end);
+			for (int i = 0; i < KZG_K; i++) {
+				bn_evl(e, a, z[i], q, KZG_N);
+				TEST_ASSERT(bn_cmp(e, y[i]) == RLC_EQ, end);
+			}
+			bn_add_dig(y[0], y[0], 1);
+			TEST_ASSERT(cp_kzg_ver_sim(c[0], z, y, KZG_K, pi[0], s, t) == 0,
+					end);
+		}
+		TEST_END;
+
+		TEST_CASE("kate-zaverucha-goldberg batch verification is correct") {
+			for (int j = 0; j < KZG_L; j++) {
+				for (int i = 0; i < KZG_N; i++) {
+					bn_rand_mod(a[i], q);
+				}
+				bn_rand_mod(z[j], q);
+				TEST_ASSERT(cp_kzg_com(c[j], a, KZG_N, s) == RLC_OK, end);
+				TEST_ASSERT(cp_kzg_prv(pi[j], y[j], a, KZG_N, z[j],
+						s) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_kzg_ver_lot(c, z, y, pi, KZG_L, t) == 1, end);
+			bn_add_dig(y[KZG_L - 1], y[KZG_L - 1], 1);
+			TEST_ASSERT(cp_kzg_ver_lot(c, z, y, pi, KZG_L, t) == 0, end);
+		}
+		TEST_END;
+
+		TEST_CASE("kate-zaverucha-goldberg reference string is serialized") {
+			TEST_ASSERT(cp_kzg_write(bin, len, s, KZG_N, t,
+					KZG_K + 1) == RLC_OK, end);
+			TEST_ASSERT(cp_kzg_read(u, KZG_N, v, KZG_K + 1, bin,
+					len) == RLC_OK, end);
+			for (int i = 0; i < KZG_N; i++) {
+				TEST_ASSERT(g1_cmp(s[i], u[i]) == RLC_EQ, end);
+			}
+			for (int i = 0; i <= KZG_K; i++) {
+				TEST_ASSERT(g2_cmp(t[i], v[i]) == RLC_EQ, end);
+			}
+			TEST_ASSERT(cp_kzg_read(u, KZG_N, v, KZG_K + 1, bin,
+					len - 1) == RLC_ERR, end);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+
+  end:
+	RLC_FREE(bin);
+	bn_free(e);
+	bn_free(q);
+	for (int i = 0; i < KZG_K; i++) {
+		bn_free(z[i]);
+		bn_free(y[i]);
+	}
+	for (int i = 0; i < KZG_N; i++) {
+		bn_free(a[i]);
+		g1_free(s[i]);
+		g1_free(u[i]);
+	}
+	for (int i = 0; i < KZG_L; i++) {
+		g1_free(c[i]);
+		g1_free(pi[i]);
+	}
+	for (int i = 0; i <= KZG_K; i++) {
+		g2_free(t[i]);
+		g2_free(v[i]);
+	}
+	return code;
+}
+
 #define M	5			/* Number of server messages (larger). */
 #define N	2			/* Number of client messages. */
 
+/**
+ * Collects the blocks of a streamed PB-PSI answer.
+ */
+typedef struct {
+	gt_t *t;
+	g1_t *u;
+	size_t len;
+} psi_str_t;
+
+static void psi_str(const gt_t *t, const g1_t *u, size_t len, void *arg) {
+	psi_str_t *a = (psi_str_t *)arg;
+
+	for (size_t i = 0; i < len; i++) {
+		gt_copy(a->t[a->len], t[i]);
+		g1_copy(a->u[a->len], u[i]);
+		a->len++;
+	}
+}
+
 static int psi(void) {
 	int result, code = RLC_ERR;
 	bn_t g, n, q, r, p[M], x[M], v[N], w[N], y[N], z[M];
@@ -2521,6 +2966,9 @@ static int psi(void) {
 				TEST_ASSERT(cp_rsapsi_ans(v, w, q, g, n, y, N) == RLC_OK, end);
 				TEST_ASSERT(cp_rsapsi_int(z, &l, r, p, n, x, M, v, w, N) == RLC_OK, end);
 				TEST_ASSERT(l == k, end);
+				for (int j = 0; j < k; j++) {
+					TEST_ASSERT(bn_cmp(z[j], x[j]) == RLC_EQ, end);
+				}
 			}
 		} TEST_END;
 
@@ -2544,6 +2992,9 @@ static int psi(void) {
 				TEST_ASSERT(cp_shipsi_int(z, &l, r, p, crt->n, x, M, v, w[0],
 					N) == RLC_OK, end);
 				TEST_ASSERT(l == k, end);
+				for (int j = 0; j < k; j++) {
+					TEST_ASSERT(bn_cmp(z[j], x[j]) == RLC_EQ, end);
+				}
 			}
 		} TEST_END;
 
@@ -2566,6 +3017,26 @@ static int psi(void) {
 					TEST_ASSERT(cp_pbpsi_int(z, &l, d, x, M, t, u, N) == RLC_OK,
 						end);
 					TEST_ASSERT(l == k, end);
+					for (int j = 0; j < k; j++) {
+						TEST_ASSERT(bn_cmp(z[j], x[j]) == RLC_EQ, end);
+					}
+				}
+			} TEST_END;
+
+			TEST_CASE("pairing-based laconic private set intersection streams") {
+				psi_str_t a = { t, u, 0 };
+				for (int j = 0; j < N; j++) {
+					bn_copy(y[j], x[N - 1 - j]);
+				}
+				/* Answer in blocks of one element, collecting them in t, u. */
+				TEST_ASSERT(cp_pbpsi_ans_str(ss, d[0], y, N, 1, psi_str,
+					&a) == RLC_OK, end);
+				TEST_ASSERT(a.len == N, end);
+				TEST_ASSERT(cp_pbpsi_int(z, &l, d, x, M, t, u, N) == RLC_OK,
+					end);
+				TEST_ASSERT(l == N, end);
+				for (int j = 0; j < N; j++) {
+					TEST_ASSERT(bn_cmp(z[j], x[j]) == RLC_EQ, end);
 				}
 			} TEST_END;
 		}
@@ -2668,6 +3139,11 @@ int main(void) {
 			return 1;
 		}
 
+		if (ecpk() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
 		if (vbnn() != RLC_OK) {
 			core_clean();
 			return 1;
@@ -2703,6 +3179,11 @@ int main(void) {
 			return 1;
 		}
 
+		if (ipa() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
 		if (oprf() != RLC_OK) {
 			core_clean();
 			return 1;
@@ -2780,6 +3261,11 @@ int main(void) {
 			core_clean();
 			return 1;
 		}
+
+		if (kzg() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
 	}
 #endif
 
@@ -61,18 +61,27 @@ static int memory(void) {
 }
 
 static int util(void) {
-	int l, code = RLC_ERR;
-	ep_t a, b, c;
+	int l, code = RLC_ERR, v[9];
+	ep_t a, b, c, s[9], t[9];
 	uint8_t bin[2 * RLC_FP_BYTES + 1];
+	uint8_t buf[9 * (2 * RLC_FP_BYTES + 1)];
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
+	for (int i = 0; i < 9; i++) {
+		ep_null(s[i]);
+		ep_null(t[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		ep_new(c);
+		for (int i = 0; i < 9; i++) {
+			ep_new(s[i]);
+			ep_new(t[i]);
+		}
 
 		TEST_CASE("copy and comparison are consistent") {
 			ep_rand(a);
@@ -167,6 +176,32 @@ static int util(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_CASE("reading and writing points in batch is consistent") {
+			for (int j = 0; j < 2; j++) {
+				ep_rand(a);
+				l = ep_size_bin(a, j);
+				for (int i = 0; i < 9; i++) {
+					ep_rand(s[i]);
+					if (i == 3) {
+						ep_set_infty(s[i]);
+					}
+					ep_write_bin(buf + i * l, l, s[i], j);
+				}
+				/* Corrupt the prefix and make a coordinate too large. */
+				buf[5 * l] = 5;
+				memset(buf + 7 * l + 1, 0xFF, RLC_FP_BYTES);
+				ep_read_bin_batch(t, v, buf, l, 9);
+				for (int i = 0; i < 9; i++) {
+					if (i == 5 || i == 7) {
+						TEST_ASSERT(!v[i] && ep_is_infty(t[i]), end);
+					} else {
+						TEST_ASSERT(v[i] && ep_cmp(s[i], t[i]) == RLC_EQ, end);
+					}
+				}
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -177,18 +212,27 @@ static int util(void) {
 	ep_free(a);
 	ep_free(b);
 	ep_free(c);
+	for (int i = 0; i < 9; i++) {
+		ep_free(s[i]);
+		ep_free(t[i]);
+	}
 	return code;
 }
 
 static int addition(void) {
 	int code = RLC_ERR;
-	ep_t a, b, c, d, e;
+	ep_t a, b, c, d, e, s[10], t[10], u[10];
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
 	ep_null(d);
 	ep_null(e);
+	for (int i = 0; i < 10; i++) {
+		ep_null(s[i]);
+		ep_null(t[i]);
+		ep_null(u[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
@@ -196,6 +240,11 @@ static int addition(void) {
 		ep_new(c);
 		ep_new(d);
 		ep_new(e);
+		for (int i = 0; i < 10; i++) {
+			ep_new(s[i]);
+			ep_new(t[i]);
+			ep_new(u[i]);
+		}
 
 		TEST_CASE("point addition is commutative") {
 			ep_rand(a);
@@ -232,6 +281,31 @@ static int addition(void) {
 			TEST_ASSERT(ep_is_infty(e), end);
 		} TEST_END;
 
+		TEST_CASE("batch point addition is correct") {
+			for (int i = 0; i < 10; i++) {
+				ep_rand(s[i]);
+				ep_rand(t[i]);
+				ep_dbl(t[i], t[i]);
+			}
+			/* Exercise the identity, inverses and doublings. */
+			ep_set_infty(s[1]);
+			ep_neg(t[2], s[2]);
+			ep_copy(t[3], s[3]);
+			ep_add_batch(u, (const ep_t *)s, (const ep_t *)t, 10);
+			for (int i = 0; i < 10; i++) {
+				ep_add(e, s[i], t[i]);
+				TEST_ASSERT(ep_cmp(u[i], e) == RLC_EQ, end);
+			}
+			ep_add_batch(s, (const ep_t *)s, (const ep_t *)t, 10);
+			ep_norm_batch(t, (const ep_t *)s, 10);
+			for (int i = 0; i < 10; i++) {
+				ep_norm(e, u[i]);
+				TEST_ASSERT(ep_cmp(s[i], u[i]) == RLC_EQ, end);
+				TEST_ASSERT(ep_cmp(t[i], e) == RLC_EQ, end);
+				TEST_ASSERT(ep_is_infty(e) || t[i]->coord == BASIC, end);
+			}
+		} TEST_END;
+
 #if EP_ADD == BASIC || !defined(STRIP)
 		TEST_CASE("point addition in affine coordinates is correct") {
 			ep_rand(a);
@@ -333,6 +407,11 @@ static int addition(void) {
 	ep_free(c);
 	ep_free(d);
 	ep_free(e);
+	for (int i = 0; i < 10; i++) {
+		ep_free(s[i]);
+		ep_free(t[i]);
+		ep_free(u[i]);
+	}
 	return code;
 }
 
@@ -390,16 +469,24 @@ static int subtraction(void) {
 
 static int doubling(void) {
 	int code = RLC_ERR;
-	ep_t a, b, c;
+	ep_t a, b, c, s[10], t[10];
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
+	for (int i = 0; i < 10; i++) {
+		ep_null(s[i]);
+		ep_null(t[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		ep_new(c);
+		for (int i = 0; i < 10; i++) {
+			ep_new(s[i]);
+			ep_new(t[i]);
+		}
 
 		TEST_CASE("point doubling is correct") {
 			ep_rand(a);
@@ -408,6 +495,23 @@ static int doubling(void) {
 			TEST_ASSERT(ep_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
 
+		TEST_CASE("batch point doubling is correct") {
+			for (int i = 0; i < 10; i++) {
+				ep_rand(s[i]);
+			}
+			ep_set_infty(s[1]);
+			ep_dbl(s[2], s[2]);
+			ep_dbl_batch(t, (const ep_t *)s, 10);
+			for (int i = 0; i < 10; i++) {
+				ep_dbl(c, s[i]);
+				TEST_ASSERT(ep_cmp(t[i], c) == RLC_EQ, end);
+			}
+			ep_dbl_batch(s, (const ep_t *)s, 10);
+			for (int i = 0; i < 10; i++) {
+				TEST_ASSERT(ep_cmp(s[i], t[i]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
 #if EP_ADD == BASIC || !defined(STRIP)
 		TEST_CASE("point doubling in affine coordinates is correct") {
 			ep_rand(a);
@@ -465,6 +569,10 @@ static int doubling(void) {
 	ep_free(a);
 	ep_free(b);
 	ep_free(c);
+	for (int i = 0; i < 10; i++) {
+		ep_free(s[i]);
+		ep_free(t[i]);
+	}
 	return code;
 }
 
@@ -890,6 +998,8 @@ static int fixed(void) {
 	int code = RLC_ERR;
 	bn_t n, k;
 	ep_t p, q, r, t[RLC_EP_TABLE_MAX];
+	uint8_t *bin = NULL;
+	size_t len;
 
 	bn_null(n);
 	bn_null(k);
@@ -1069,6 +1179,35 @@ static int fixed(void) {
 			ep_free(t[i]);
 		}
 #endif
+		TEST_CASE("serialized table fixed point multiplication is correct") {
+			for (int w = 2; w <= 8; w += 6) {
+				len = ep_mul_size_bin(w);
+				bin = (uint8_t *)calloc(len, sizeof(uint8_t));
+				TEST_ASSERT(bin != NULL, end);
+				ep_rand(p);
+				ep_mul_pre_bin(bin, len, p, w);
+				bn_zero(k);
+				ep_mul_fix_bin(r, bin, len, k);
+				TEST_ASSERT(ep_is_infty(r), end);
+				bn_set_dig(k, 1);
+				ep_mul_fix_bin(r, bin, len, k);
+				TEST_ASSERT(ep_cmp(p, r) == RLC_EQ, end);
+				bn_rand_mod(k, n);
+				ep_mul(r, p, k);
+				ep_mul_fix_bin(q, bin, len, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				bn_neg(k, k);
+				ep_mul_fix_bin(r, bin, len, k);
+				ep_neg(r, r);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				bn_sub_dig(k, n, 1);
+				ep_mul_fix_bin(r, bin, len, k);
+				ep_neg(r, r);
+				TEST_ASSERT(ep_cmp(p, r) == RLC_EQ, end);
+				free(bin);
+				bin = NULL;
+			}
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1076,6 +1215,7 @@ static int fixed(void) {
 	}
 	code = RLC_OK;
   end:
+	free(bin);
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
@@ -1385,6 +1525,32 @@ static int simultaneous(void) {
 			ep_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("pippenger simultaneous multiplication is correct") {
+			ep_set_infty(r);
+			ep_mul_sim_pip(p[16], p, k, 0);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep_rand(p[j]);
+			}
+			/* Repeat points and scalars to exercise bucket collisions. */
+			ep_copy(p[1], p[0]);
+			ep_neg(p[2], p[0]);
+			bn_copy(k[1], k[0]);
+			bn_copy(k[2], k[0]);
+			ep_set_infty(p[3]);
+			bn_neg(k[4], k[4]);
+			for (int j = 0; j < 16; j++) {
+				ep_mul(p[16], p[j], k[j]);
+				ep_add(r, r, p[16]);
+			}
+			ep_norm(r, r);
+			ep_mul_sim_pip(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			ep_mul_sim_lot(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1435,17 +1601,23 @@ static int compression(void) {
 
 static int hashing(void) {
 	int code = RLC_ERR;
-	ep_t a;
+	ep_t a, b[10];
 	bn_t n;
 	/* Allocate buffer with plenty of room. */
 	uint8_t msg[4 * RLC_FP_BYTES];
 
 	ep_null(a);
 	bn_null(n);
+	for (int i = 0; i < 10; i++) {
+		ep_null(b[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		bn_new(n);
+		for (int i = 0; i < 10; i++) {
+			ep_new(b[i]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -1462,6 +1634,22 @@ static int hashing(void) {
 		}
 		TEST_END;
 
+		TEST_CASE("batch point hashing is correct") {
+			const uint8_t *m[10];
+			size_t l[10];
+			rand_bytes(msg, sizeof(msg));
+			for (int i = 0; i < 10; i++) {
+				m[i] = msg + i;
+				l[i] = 7 * i;
+			}
+			ep_map_batch(b, m, l, 10);
+			for (int i = 0; i < 10; i++) {
+				ep_map(a, m[i], l[i]);
+				TEST_ASSERT(ep_cmp(a, b[i]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
 #if EP_MAP == BASIC || !defined(STRIP)
 		TEST_CASE("basic point hashing is correct") {
 			rand_bytes(msg, ep_map_rnd_size());
@@ -1506,6 +1694,9 @@ static int hashing(void) {
   end:
 	ep_free(a);
 	bn_free(n);
+	for (int i = 0; i < 10; i++) {
+		ep_free(b[i]);
+	}
 	return code;
 }
 
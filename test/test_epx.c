@@ -61,18 +61,27 @@ static int memory2(void) {
 }
 
 static int util2(void) {
-	int l, code = RLC_ERR;
-	ep2_t a, b, c;
+	int l, code = RLC_ERR, v[9];
+	ep2_t a, b, c, s[9], t[9];
 	uint8_t bin[4 * RLC_FP_BYTES + 1];
+	uint8_t buf[9 * (4 * RLC_FP_BYTES + 1)];
 
 	ep2_null(a);
 	ep2_null(b);
 	ep2_null(c);
+	for (int i = 0; i < 9; i++) {
+		ep2_null(s[i]);
+		ep2_null(t[i]);
+	}
 
 	RLC_TRY {
 		ep2_new(a);
 		ep2_new(b);
 		ep2_new(c);
+		for (int i = 0; i < 9; i++) {
+			ep2_new(s[i]);
+			ep2_new(t[i]);
+		}
 
 		TEST_CASE("copy and comparison are consistent") {
 			ep2_rand(a);
@@ -166,6 +175,32 @@ static int util2(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_CASE("reading and writing points in batch is consistent") {
+			for (int j = 0; j < 2; j++) {
+				ep2_rand(a);
+				l = ep2_size_bin(a, j);
+				for (int i = 0; i < 9; i++) {
+					ep2_rand(s[i]);
+					if (i == 3) {
+						ep2_set_infty(s[i]);
+					}
+					ep2_write_bin(buf + i * l, l, s[i], j);
+				}
+				/* Corrupt the prefix and make a coordinate too large. */
+				buf[5 * l] = 5;
+				memset(buf + 7 * l + 1, 0xFF, RLC_FP_BYTES);
+				ep2_read_bin_batch(t, v, buf, l, 9);
+				for (int i = 0; i < 9; i++) {
+					if (i == 5 || i == 7) {
+						TEST_ASSERT(!v[i] && ep2_is_infty(t[i]), end);
+					} else {
+						TEST_ASSERT(v[i] && ep2_cmp(s[i], t[i]) == RLC_EQ, end);
+					}
+				}
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -176,6 +211,10 @@ static int util2(void) {
 	ep2_free(a);
 	ep2_free(b);
 	ep2_free(c);
+	for (int i = 0; i < 9; i++) {
+		ep2_free(s[i]);
+		ep2_free(t[i]);
+	}
 	return code;
 }
 
@@ -1133,6 +1172,30 @@ static int simultaneous2(void) {
 			ep2_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("pippenger simultaneous multiplication is correct") {
+			ep2_set_infty(r);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep2_rand(p[j]);
+			}
+			/* Repeat points and scalars to exercise bucket collisions. */
+			ep2_copy(p[1], p[0]);
+			ep2_neg(p[2], p[0]);
+			bn_copy(k[1], k[0]);
+			bn_copy(k[2], k[0]);
+			ep2_set_infty(p[3]);
+			bn_neg(k[4], k[4]);
+			for (int j = 0; j < 16; j++) {
+				ep2_mul(p[16], p[j], k[j]);
+				ep2_add(r, r, p[16]);
+			}
+			ep2_norm(r, r);
+			ep2_mul_sim_pip(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			ep2_mul_sim_lot(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1184,15 +1247,21 @@ static int compression2(void) {
 static int hashing2(void) {
 	int code = RLC_ERR;
 	bn_t n;
-	ep2_t a;
+	ep2_t a, b[4];
 	uint8_t msg[5];
 
 	bn_null(n);
 	ep2_null(a);
+	for (int i = 0; i < 4; i++) {
+		ep2_null(b[i]);
+	}
 
 	RLC_TRY {
 		bn_new(n);
 		ep2_new(a);
+		for (int i = 0; i < 4; i++) {
+			ep2_new(b[i]);
+		}
 
 		ep2_curve_get_ord(n);
 
@@ -1205,6 +1274,33 @@ static int hashing2(void) {
 		}
 		TEST_END;
 
+		TEST_CASE("batched point hashing is correct") {
+			const uint8_t *m[4];
+			size_t l[4];
+			rand_bytes(msg, sizeof(msg));
+			for (int i = 0; i < 4; i++) {
+				m[i] = msg;
+				l[i] = i + 2;
+			}
+			ep2_map_batch(b, m, l, 4);
+			for (int i = 0; i < 4; i++) {
+				ep2_map(a, m[i], l[i]);
+				TEST_ASSERT(ep2_cmp(a, b[i]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_CASE("simultaneous cofactor multiplication is correct") {
+			for (int i = 0; i < 4; i++) {
+				ep2_rand(b[i]);
+			}
+			ep2_mul_cof(a, b[3]);
+			ep2_mul_cof_sim(b, (const ep2_t *)b, 4);
+			TEST_ASSERT(ep2_cmp(a, b[3]) == RLC_EQ, end);
+			TEST_ASSERT(ep2_on_curve(b[0]) == 1, end);
+		}
+		TEST_END;
+
 #if EP_MAP == BASIC || !defined(STRIP)
 		TEST_CASE("basic point hashing is correct") {
 			rand_bytes(msg, sizeof(msg));
@@ -1248,6 +1344,9 @@ static int hashing2(void) {
   end:
 	bn_free(n);
 	ep2_free(a);
+	for (int i = 0; i < 4; i++) {
+		ep2_free(b[i]);
+	}
 	return code;
 }
 
@@ -101,6 +101,30 @@ int main(void) {
 		}
 	} TEST_END;
 
+	TEST_ONCE("errors thrown in try-catch are flagged until the block ends") {
+		int thrown = 0;
+
+		RLC_TRY {
+			RLC_THROW(ERR_NO_VALID);
+			thrown = RLC_THROWN;
+		}
+		RLC_CATCH(e) {
+#ifdef NOJMP
+			/* The execution continued after the throw with the flag raised. */
+			thrown = (thrown == 1 && e == ERR_NO_VALID);
+#else
+			/* The execution jumped straight to this block. */
+			thrown = (thrown == 0 && e == ERR_NO_VALID);
+#endif
+		}
+		if (!thrown || RLC_THROWN) {
+			test_fail();
+			code = RLC_OK;
+			goto end;
+		}
+		err_get_code();
+	} TEST_END;
+
 	counter = 0;
 
 	TEST_ONCE("try-catch is correct and error message is printed") {
@@ -382,7 +382,7 @@ static int subtraction(void) {
 
 static int multiplication(void) {
 	int code = RLC_ERR;
-	fp_t a, b, c, d, e, f;
+	fp_t a, b, c, d, e, f, t[8], u[8], v[8];
 
 	fp_null(a);
 	fp_null(b);
@@ -390,6 +390,11 @@ static int multiplication(void) {
 	fp_null(d);
 	fp_null(e);
 	fp_null(f);
+	for (int i = 0; i < 8; i++) {
+		fp_null(t[i]);
+		fp_null(u[i]);
+		fp_null(v[i]);
+	}
 
 	RLC_TRY {
 		fp_new(a);
@@ -398,6 +403,11 @@ static int multiplication(void) {
 		fp_new(d);
 		fp_new(e);
 		fp_new(f);
+		for (int i = 0; i < 8; i++) {
+			fp_new(t[i]);
+			fp_new(u[i]);
+			fp_new(v[i]);
+		}
 
 		TEST_CASE("multiplication is commutative") {
 			fp_rand(a);
@@ -487,6 +497,45 @@ static int multiplication(void) {
 		}
 		TEST_END;
 #endif
+
+		TEST_CASE("batched multiplication is correct") {
+			for (int i = 0; i < 8; i++) {
+				fp_rand(u[i]);
+				fp_rand(v[i]);
+			}
+			fp_zero(u[0]);
+			fp_set_dig(u[1], 1);
+			fp_neg(u[2], u[1]);
+			fp_neg(v[2], u[1]);
+			fp_mul_x8(t, u, v);
+			for (int i = 0; i < 8; i++) {
+				fp_mul(c, u[i], v[i]);
+				TEST_ASSERT(fp_cmp(c, t[i]) == RLC_EQ, end);
+			}
+			fp_mul_x8(u, u, v);
+			for (int i = 0; i < 8; i++) {
+				TEST_ASSERT(fp_cmp(u[i], t[i]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+#if ARITH == X64_DISPATCH && defined(FP_LOW_BMI2)
+		TEST_CASE("dispatched multiplication is consistent") {
+			fp_rand(a);
+			fp_rand(b);
+			fp_mul(c, a, b);
+			fp_mulm_low_base(d, a, b);
+			TEST_ASSERT(fp_cmp(c, d) == RLC_EQ, end);
+			if (arch_isa() & RLC_ISA_BMI2) {
+				fp_mulm_low_bmi2(e, a, b);
+				TEST_ASSERT(fp_cmp(c, e) == RLC_EQ, end);
+				fp_sqrm_low_base(e, a);
+				fp_sqrm_low_bmi2(f, a);
+				TEST_ASSERT(fp_cmp(e, f) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -499,21 +548,34 @@ static int multiplication(void) {
 	fp_free(d);
 	fp_free(e);
 	fp_free(f);
+	for (int i = 0; i < 8; i++) {
+		fp_free(t[i]);
+		fp_free(u[i]);
+		fp_free(v[i]);
+	}
 	return code;
 }
 
 static int squaring(void) {
 	int code = RLC_ERR;
-	fp_t a, b, c;
+	fp_t a, b, c, t[8], u[8];
 
 	fp_null(a);
 	fp_null(b);
 	fp_null(c);
+	for (int i = 0; i < 8; i++) {
+		fp_null(t[i]);
+		fp_null(u[i]);
+	}
 
 	RLC_TRY {
 		fp_new(a);
 		fp_new(b);
 		fp_new(c);
+		for (int i = 0; i < 8; i++) {
+			fp_new(t[i]);
+			fp_new(u[i]);
+		}
 
 		TEST_CASE("squaring is correct") {
 			fp_rand(a);
@@ -557,6 +619,20 @@ static int squaring(void) {
 			TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
 #endif
+
+		TEST_CASE("batched squaring is correct") {
+			for (int i = 0; i < 8; i++) {
+				fp_rand(u[i]);
+			}
+			fp_zero(u[0]);
+			fp_set_dig(u[1], 1);
+			fp_neg(u[2], u[1]);
+			fp_sqr_x8(t, u);
+			for (int i = 0; i < 8; i++) {
+				fp_sqr(c, u[i]);
+				TEST_ASSERT(fp_cmp(c, t[i]) == RLC_EQ, end);
+			}
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -566,6 +642,10 @@ static int squaring(void) {
 	fp_free(a);
 	fp_free(b);
 	fp_free(c);
+	for (int i = 0; i < 8; i++) {
+		fp_free(t[i]);
+		fp_free(u[i]);
+	}
 	return code;
 }
 
@@ -996,19 +1076,27 @@ static int symbol(void) {
 
 static int exponentiation(void) {
 	int code = RLC_ERR;
-	fp_t a, b, c;
+	fp_t a, b, c, e[9], f[9];
 	bn_t d;
 
 	fp_null(a);
 	fp_null(b);
 	fp_null(c);
 	bn_null(d);
+	for (int i = 0; i < 9; i++) {
+		fp_null(e[i]);
+		fp_null(f[i]);
+	}
 
 	RLC_TRY {
 		fp_new(a);
 		fp_new(b);
 		fp_new(c);
 		bn_new(d);
+		for (int i = 0; i < 9; i++) {
+			fp_new(e[i]);
+			fp_new(f[i]);
+		}
 
 		TEST_CASE("exponentiation is correct") {
 			fp_rand(a);
@@ -1032,6 +1120,34 @@ static int exponentiation(void) {
 		}
 		TEST_END;
 
+		TEST_CASE("batched exponentiation is correct") {
+			for (int i = 0; i < 9; i++) {
+				fp_rand(e[i]);
+			}
+			bn_rand(d, RLC_POS, RLC_FP_BITS);
+			fp_exp_batch(f, (const fp_t *)e, d, 9);
+			for (int i = 0; i < 9; i++) {
+				fp_exp(c, e[i], d);
+				TEST_ASSERT(fp_cmp(c, f[i]) == RLC_EQ, end);
+			}
+			bn_neg(d, d);
+			fp_exp_batch(f, (const fp_t *)e, d, 3);
+			for (int i = 0; i < 3; i++) {
+				fp_exp(c, e[i], d);
+				TEST_ASSERT(fp_cmp(c, f[i]) == RLC_EQ, end);
+			}
+			/* Check short exponents, which start with a single window. */
+			for (dig_t j = 1; j <= 4; j++) {
+				bn_set_dig(d, j);
+				fp_exp_batch(f, (const fp_t *)e, d, 8);
+				for (int i = 0; i < 8; i++) {
+					fp_exp_dig(c, e[i], j);
+					TEST_ASSERT(fp_cmp(c, f[i]) == RLC_EQ, end);
+				}
+			}
+		}
+		TEST_END;
+
 #if FP_EXP == BASIC || !defined(STRIP)
 		TEST_CASE("basic exponentiation is correct") {
 			fp_rand(a);
@@ -1074,21 +1190,34 @@ static int exponentiation(void) {
 	fp_free(b);
 	fp_free(c);
 	bn_free(d);
+	for (int i = 0; i < 9; i++) {
+		fp_free(e[i]);
+		fp_free(f[i]);
+	}
 	return code;
 }
 
 static int square_root(void) {
 	int code = RLC_ERR;
-	fp_t a, b, c;
+	fp_t a, b, c, d[9], e[9];
+	int r[9];
 
 	fp_null(a);
 	fp_null(b);
 	fp_null(c);
+	for (int i = 0; i < 9; i++) {
+		fp_null(d[i]);
+		fp_null(e[i]);
+	}
 
 	RLC_TRY {
 		fp_new(a);
 		fp_new(b);
 		fp_new(c);
+		for (int i = 0; i < 9; i++) {
+			fp_new(d[i]);
+			fp_new(e[i]);
+		}
 
 		TEST_CASE("quadratic residuosity test is correct") {
 			fp_zero(a);
@@ -1120,6 +1249,25 @@ static int square_root(void) {
 			TEST_ASSERT(fp_srt(b, a) == 0, end);
 		}
 		TEST_END;
+
+		TEST_CASE("batched square root extraction is correct") {
+			for (int i = 0; i < 9; i++) {
+				fp_rand(d[i]);
+				if (i % 2 == 0) {
+					fp_sqr(d[i], d[i]);
+				}
+			}
+			fp_zero(d[8]);
+			fp_srt_batch(e, r, (const fp_t *)d, 9);
+			for (int i = 0; i < 9; i++) {
+				TEST_ASSERT(r[i] == fp_is_sqr(d[i]), end);
+				if (r[i]) {
+					fp_sqr(c, e[i]);
+					TEST_ASSERT(fp_cmp(c, d[i]) == RLC_EQ, end);
+				}
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1129,6 +1277,10 @@ static int square_root(void) {
 	fp_free(a);
 	fp_free(b);
 	fp_free(c);
+	for (int i = 0; i < 9; i++) {
+		fp_free(d[i]);
+		fp_free(e[i]);
+	}
 	return code;
 }
 
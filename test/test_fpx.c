@@ -767,17 +767,25 @@ static int compression2(void) {
 
 static int square_root2(void) {
 	int code = RLC_ERR;
-	fp2_t a, b, c;
-	int r;
+	fp2_t a, b, c, d[9], e[9];
+	int r, v[9];
 
 	fp2_null(a);
 	fp2_null(b);
 	fp2_null(c);
+	for (int i = 0; i < 9; i++) {
+		fp2_null(d[i]);
+		fp2_null(e[i]);
+	}
 
 	RLC_TRY {
 		fp2_new(a);
 		fp2_new(b);
 		fp2_new(c);
+		for (int i = 0; i < 9; i++) {
+			fp2_new(d[i]);
+			fp2_new(e[i]);
+		}
 
 		TEST_CASE("quadratic residuosity test is correct") {
 			fp2_zero(a);
@@ -830,6 +838,26 @@ static int square_root2(void) {
 			} while(fp2_is_sqr(a) == 1);
 			TEST_ASSERT(fp2_srt(b, a) == 0, end);
 		} TEST_END;
+
+		TEST_CASE("batched square root extraction is correct") {
+			for (int i = 0; i < 9; i++) {
+				fp2_rand(d[i]);
+				if (i % 2 == 0) {
+					fp2_sqr(d[i], d[i]);
+				}
+			}
+			fp_zero(d[4][1]);
+			fp_zero(d[6][0]);
+			fp2_zero(d[8]);
+			fp2_srt_batch(e, v, (const fp2_t *)d, 9);
+			for (int i = 0; i < 9; i++) {
+				TEST_ASSERT(v[i] == fp2_is_sqr(d[i]), end);
+				if (v[i]) {
+					fp2_sqr(c, e[i]);
+					TEST_ASSERT(fp2_cmp(c, d[i]) == RLC_EQ, end);
+				}
+			}
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -840,6 +868,10 @@ static int square_root2(void) {
 	fp2_free(a);
 	fp2_free(b);
 	fp2_free(c);
+	for (int i = 0; i < 9; i++) {
+		fp2_free(d[i]);
+		fp2_free(e[i]);
+	}
 	return code;
 }
 
@@ -222,6 +222,43 @@ static int sha256(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha256 batch hash function is consistent") {
+		const size_t len[10] = {0, 1, 55, 56, 63, 64, 65, 119, 120, 112};
+		const uint8_t *msg[10];
+		uint8_t batch[10 * 32];
+		for (i = 0; i < MSG_SIZE && i < 120; i++) {
+			message[i] = (uint8_t)(7 * i + 1);
+		}
+		for (i = 0; i < 10; i++) {
+			msg[i] = message + (i % 3);
+		}
+		md_map_sh256_batch(batch, msg, len, 10);
+		for (i = 0; i < 10; i++) {
+			md_map_sh256(digest, msg[i], len[i]);
+			TEST_ASSERT(memcmp(digest, batch + 32 * i, 32) == 0, end);
+		}
+	}
+	TEST_END;
+
+#if MD_MAP == SH256
+	TEST_ONCE("batch xmd function is consistent") {
+		const size_t len[10] = {0, 1, 3, 16, 37, 55, 64, 65, 100, 109};
+		const uint8_t *msg[10];
+		uint8_t buf[75], batch[10 * 75];
+		for (i = 0; i < 10; i++) {
+			msg[i] = message + i;
+		}
+		md_xmd_batch(batch, 75, msg, len, 10, (uint8_t *)TEST2b,
+				strlen(TEST2b));
+		for (i = 0; i < 10; i++) {
+			md_xmd(buf, 75, msg[i], len[i], (uint8_t *)TEST2b,
+					strlen(TEST2b));
+			TEST_ASSERT(memcmp(buf, batch + 75 * i, 75) == 0, end);
+		}
+	}
+	TEST_END;
+#endif
+
 	code = RLC_OK;
 
   end:
@@ -560,14 +560,37 @@ static int simultaneous1(void) {
 	return code;
 }
 
+/**
+ * Returns the last slot of the table of valid elements that changed since the
+ * given copy of the table was taken, or -1 if none did, and updates the copy.
+ */
+static int val_slot(uint8_t v[RLC_PC_VAL][RLC_PC_VLEN]) {
+	int s = -1;
+
+	for (int i = 0; i < RLC_PC_VAL; i++) {
+		if (memcmp(v[i], core_get()->pc_val[i], RLC_PC_VLEN) != 0) {
+			s = i;
+		}
+	}
+	memcpy(v, core_get()->pc_val, RLC_PC_VAL * RLC_PC_VLEN);
+	return s;
+}
+
 static int validity1(void) {
-	int code = RLC_ERR;
-	g1_t a;
+	int code = RLC_ERR, r[4];
+	uint8_t v[RLC_PC_VAL][RLC_PC_VLEN];
+	g1_t a, b[4];
 
 	g1_null(a);
+	for (int i = 0; i < 4; i++) {
+		g1_null(b[i]);
+	}
 
 	RLC_TRY {
 		g1_new(a);
+		for (int i = 0; i < 4; i++) {
+			g1_new(b[i]);
+		}
 
 		TEST_CASE("validity test is correct") {
 			g1_set_infty(a);
@@ -577,12 +600,67 @@ static int validity1(void) {
 		}
 		TEST_END;
 
+		TEST_CASE("cached validity test is correct") {
+			g1_rand(a);
+			g1_norm(a, a);
+			TEST_ASSERT(g1_is_valid(a), end);
+			TEST_ASSERT(g1_is_valid(a), end);
+			g1_norm(a, a);
+			fp_add_dig(a->x, a->x, 1);
+			TEST_ASSERT(!g1_is_valid(a), end);
+		}
+		TEST_END;
+
+		TEST_ONCE("cached validity test survives eviction") {
+			int s, t = -1;
+
+			g1_rand(a);
+			g1_norm(a, a);
+			val_slot(v);
+			TEST_ASSERT(g1_is_valid(a), end);
+			/* The slot stays unchanged if the cache is not used. */
+			s = val_slot(v);
+			for (int i = 0; s != -1 && t != s && i < 64 * RLC_PC_VAL; i++) {
+				g1_rand(b[0]);
+				g1_norm(b[0], b[0]);
+				TEST_ASSERT(g1_is_valid(b[0]), end);
+				t = val_slot(v);
+			}
+			TEST_ASSERT(s == -1 || t == s, end);
+			/* The evicted element is checked and recorded again. */
+			TEST_ASSERT(g1_is_valid(a), end);
+			TEST_ASSERT(val_slot(v) == s, end);
+			g1_copy(b[1], a);
+			fp_add_dig(b[1]->x, b[1]->x, 1);
+			TEST_ASSERT(!g1_is_valid(b[1]), end);
+			/* Elements in projective coordinates are not recorded. */
+			g1_dbl(b[1], a);
+			TEST_ASSERT(g1_is_valid(b[1]), end);
+			TEST_ASSERT(b[1]->coord == BASIC || val_slot(v) == -1, end);
+		}
+		TEST_END;
+
 		TEST_CASE("blinding is consistent") {
 			g1_rand(a);
 			g1_blind(a, a);
 			g1_norm(a, a);
 			TEST_ASSERT(g1_is_valid(a), end);
 		} TEST_END;
+
+		TEST_CASE("batched validity test is correct") {
+			for (int i = 0; i < 4; i++) {
+				g1_rand(b[i]);
+				g1_norm(b[i], b[i]);
+			}
+			g1_set_infty(b[1]);
+			fp_add_dig(b[2]->x, b[2]->x, 1);
+			g1_is_valid_batch(r, (const g1_t *)b, 4);
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(r[i] == g1_is_valid(b[i]), end);
+			}
+			TEST_ASSERT(r[0] && !r[1] && !r[2] && r[3], end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -590,6 +668,9 @@ static int validity1(void) {
 	code = RLC_OK;
   end:
 	g1_free(a);
+	for (int i = 0; i < 4; i++) {
+		g1_free(b[i]);
+	}
 	return code;
 }
 
@@ -1152,13 +1233,20 @@ static int simultaneous2(void) {
 }
 
 static int validity2(void) {
-	int code = RLC_ERR;
-	g2_t a;
+	int code = RLC_ERR, r[4];
+	uint8_t v[RLC_PC_VAL][RLC_PC_VLEN];
+	g2_t a, b[4];
 
 	g2_null(a);
+	for (int i = 0; i < 4; i++) {
+		g2_null(b[i]);
+	}
 
 	RLC_TRY {
 		g2_new(a);
+		for (int i = 0; i < 4; i++) {
+			g2_new(b[i]);
+		}
 
 		TEST_CASE("validity test is correct") {
 			g2_set_infty(a);
@@ -1168,12 +1256,67 @@ static int validity2(void) {
 		}
 		TEST_END;
 
+		TEST_CASE("cached validity test is correct") {
+			g2_rand(a);
+			g2_norm(a, a);
+			TEST_ASSERT(g2_is_valid(a), end);
+			TEST_ASSERT(g2_is_valid(a), end);
+			g2_norm(a, a);
+			fp_add_dig(RLC_G2_BASEF(a->x), RLC_G2_BASEF(a->x), 1);
+			TEST_ASSERT(!g2_is_valid(a), end);
+		}
+		TEST_END;
+
+		TEST_ONCE("cached validity test survives eviction") {
+			int s, t = -1;
+
+			g2_rand(a);
+			g2_norm(a, a);
+			val_slot(v);
+			TEST_ASSERT(g2_is_valid(a), end);
+			/* The slot stays unchanged if the cache is not used. */
+			s = val_slot(v);
+			for (int i = 0; s != -1 && t != s && i < 64 * RLC_PC_VAL; i++) {
+				g2_rand(b[0]);
+				g2_norm(b[0], b[0]);
+				TEST_ASSERT(g2_is_valid(b[0]), end);
+				t = val_slot(v);
+			}
+			TEST_ASSERT(s == -1 || t == s, end);
+			/* The evicted element is checked and recorded again. */
+			TEST_ASSERT(g2_is_valid(a), end);
+			TEST_ASSERT(val_slot(v) == s, end);
+			g2_copy(b[1], a);
+			fp_add_dig(RLC_G2_BASEF(b[1]->x), RLC_G2_BASEF(b[1]->x), 1);
+			TEST_ASSERT(!g2_is_valid(b[1]), end);
+			/* Elements in projective coordinates are not recorded. */
+			g2_dbl(b[1], a);
+			TEST_ASSERT(g2_is_valid(b[1]), end);
+			TEST_ASSERT(b[1]->coord == BASIC || val_slot(v) == -1, end);
+		}
+		TEST_END;
+
 		TEST_CASE("blinding is consistent") {
 			g2_rand(a);
 			g2_blind(a, a);
 			g2_norm(a, a);
 			TEST_ASSERT(g2_is_valid(a), end);
 		} TEST_END;
+
+		TEST_CASE("batched validity test is correct") {
+			for (int i = 0; i < 4; i++) {
+				g2_rand(b[i]);
+				g2_norm(b[i], b[i]);
+			}
+			g2_set_infty(b[1]);
+			fp_add_dig(RLC_G2_BASEF(b[2]->x), RLC_G2_BASEF(b[2]->x), 1);
+			g2_is_valid_batch(r, (const g2_t *)b, 4);
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(r[i] == g2_is_valid(b[i]), end);
+			}
+			TEST_ASSERT(r[0] && !r[1] && !r[2] && r[3], end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1181,6 +1324,9 @@ static int validity2(void) {
 	code = RLC_OK;
   end:
 	g2_free(a);
+	for (int i = 0; i < 4; i++) {
+		g2_free(b[i]);
+	}
 	return code;
 }
 
@@ -1560,17 +1706,176 @@ static int validity(void) {
 	return code;
 }
 
+static int logarithm(void) {
+	int code = RLC_ERR;
+	g1_t p, q;
+	g2_t r, s;
+	gt_t a, b;
+	pc_dlog_t t, u;
+	dig_t k, l;
+	size_t len;
+	uint8_t *bin = NULL;
+
+	g1_null(p);
+	g1_null(q);
+	g2_null(r);
+	g2_null(s);
+	gt_null(a);
+	gt_null(b);
+
+	RLC_TRY {
+		g1_new(p);
+		g1_new(q);
+		g2_new(r);
+		g2_new(s);
+		gt_new(a);
+		gt_new(b);
+
+		TEST_CASE("discrete logarithm in G_1 is correct") {
+			g1_rand(p);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 1000;
+			g1_mul_dig(q, p, k);
+			TEST_ASSERT(g1_dlog(&l, q, p, NULL, 1000) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(g1_dlog(&l, q, p, NULL, k) == RLC_ERR, end);
+			TEST_ASSERT(g1_dlog_pre(t, p, 256) == RLC_OK, end);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= (1 << 16);
+			g1_mul_dig(q, p, k);
+			TEST_ASSERT(g1_dlog(&l, q, p, t, 1 << 16) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			pc_dlog_free(t);
+		}
+		TEST_END;
+
+		TEST_CASE("discrete logarithm in G_2 is correct") {
+			g2_rand(r);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 1000;
+			g2_mul_dig(s, r, k);
+			TEST_ASSERT(g2_dlog(&l, s, r, NULL, 1000) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(g2_dlog_pre(t, r, 256) == RLC_OK, end);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= (1 << 16);
+			g2_mul_dig(s, r, k);
+			TEST_ASSERT(g2_dlog(&l, s, r, t, 1 << 16) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			pc_dlog_free(t);
+		}
+		TEST_END;
+
+		TEST_CASE("discrete logarithm in G_T is correct") {
+			gt_rand(a);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 1000;
+			gt_exp_dig(b, a, k);
+			TEST_ASSERT(gt_dlog(&l, b, a, NULL, 1000) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(gt_dlog_pre(t, a, 256) == RLC_OK, end);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= (1 << 16);
+			gt_exp_dig(b, a, k);
+			TEST_ASSERT(gt_dlog(&l, b, a, t, 1 << 16) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			pc_dlog_free(t);
+		}
+		TEST_END;
+
+		TEST_CASE("reading and writing a discrete logarithm table are consistent") {
+			g1_rand(p);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= (1 << 16);
+			g1_mul_dig(q, p, k);
+			TEST_ASSERT(g1_dlog_pre(t, p, 256) == RLC_OK, end);
+			len = pc_dlog_size(t);
+			bin = (uint8_t *)malloc(len);
+			TEST_ASSERT(bin != NULL, end);
+			pc_dlog_write(bin, len, t);
+			pc_dlog_free(t);
+			pc_dlog_read(u, bin, len);
+			TEST_ASSERT(g1_dlog(&l, q, p, u, 1 << 16) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			pc_dlog_free(u);
+			free(bin);
+			bin = NULL;
+		}
+		TEST_END;
+
+		TEST_CASE("reading a corrupted discrete logarithm table fails") {
+			uint32_t *v;
+
+			g1_rand(p);
+			TEST_ASSERT(g1_dlog_pre(t, p, 256) == RLC_OK, end);
+			len = pc_dlog_size(t);
+			bin = (uint8_t *)malloc(len);
+			TEST_ASSERT(bin != NULL, end);
+			pc_dlog_write(bin, len, t);
+			/* Fill every empty slot, so that lookups would never stop. */
+			v = (uint32_t *)(bin + len - t->len * sizeof(uint32_t));
+			for (k = 0; k < t->len; k++) {
+				v[k] = (v[k] == 0 ? 1 : v[k]);
+			}
+			RLC_TRY {
+				pc_dlog_read(u, bin, len);
+			} RLC_CATCH_ANY {
+				u->len = 0;
+			}
+			TEST_ASSERT(u->len == 0 && u->val == NULL, end);
+			/* Restore the table and store an exponent out of range. */
+			pc_dlog_write(bin, len, t);
+			for (k = 0; v[k] == 0; k++);
+			v[k] = t->m + 1;
+			RLC_TRY {
+				pc_dlog_read(u, bin, len);
+			} RLC_CATCH_ANY {
+				u->len = 0;
+			}
+			TEST_ASSERT(u->len == 0 && u->val == NULL, end);
+			/* Check that a truncated table is also rejected. */
+			pc_dlog_write(bin, len, t);
+			RLC_TRY {
+				pc_dlog_read(u, bin, len - 1);
+			} RLC_CATCH_ANY {
+				u->len = 0;
+			}
+			TEST_ASSERT(u->len == 0 && u->val == NULL, end);
+			pc_dlog_free(t);
+			free(bin);
+			bin = NULL;
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	free(bin);
+	g1_free(p);
+	g1_free(q);
+	g2_free(r);
+	g2_free(s);
+	gt_free(a);
+	gt_free(b);
+	return code;
+}
+
 static int pairing(void) {
 	int j, code = RLC_ERR;
 	g1_t p[2];
 	g2_t q[2];
 	gt_t e1, e2;
+	g2_prep_t w[2];
 	bn_t k, n;
 
 	gt_null(e1);
 	gt_null(e2);
 	bn_null(k);
 	bn_null(n);
+	g2_prep_null(w[0]);
+	g2_prep_null(w[1]);
 
 	RLC_TRY {
 		gt_new(e1);
@@ -1583,6 +1888,7 @@ static int pairing(void) {
 			g2_null(q[j]);
 			g1_new(p[j]);
 			g2_new(q[j]);
+			g2_prep_new(w[j]);
 		}
 
 		pc_get_ord(n);
@@ -1652,6 +1958,47 @@ static int pairing(void) {
 			pc_map_sim(e1, p, q, 2);
 			TEST_ASSERT(gt_cmp_dig(e1, 1) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("parallel multi-pairing is correct") {
+			g1_rand(p[0]);
+			g2_rand(q[0]);
+			g1_rand(p[1]);
+			g2_rand(q[1]);
+			pc_map_sim(e1, p, q, 2);
+			pc_map_par(e2, p, q, 2);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g2_set_infty(q[1]);
+			pc_map(e1, p[0], q[0]);
+			pc_map_par(e2, p, q, 2);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g1_neg(p[1], p[0]);
+			g2_copy(q[1], q[0]);
+			pc_map_par(e1, p, q, 2);
+			TEST_ASSERT(gt_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+
+#if PP_MAP == OATEP && (RLC_GT_EMBED == 12 || RLC_GT_EMBED == 16 || \
+		RLC_GT_EMBED == 18 || RLC_GT_EMBED == 24)
+		TEST_CASE("pairing with precomputation is correct") {
+			g1_rand(p[0]);
+			g2_rand(q[0]);
+			g1_rand(p[1]);
+			g2_rand(q[1]);
+			g2_prep(w[0], q[0]);
+			g2_prep(w[1], q[1]);
+			pc_map(e1, p[0], q[0]);
+			pc_map_prep(e2, p[0], w[0]);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			pc_map_sim(e1, p, q, 2);
+			pc_map_sim_prep(e2, p, w, 2);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g2_set_infty(q[1]);
+			g2_prep(w[1], q[1]);
+			pc_map(e1, p[0], q[0]);
+			pc_map_sim_prep(e2, p, w, 2);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1666,6 +2013,7 @@ static int pairing(void) {
 	for (j = 0; j < 2; j++) {
 		g1_free(p[j]);
 		g2_free(q[j]);
+		g2_prep_free(w[j]);
 	}
 	return code;
 }
@@ -1802,6 +2150,10 @@ int test(void) {
 		return RLC_ERR;
 	}
 
+	if (logarithm() != RLC_OK) {
+		return RLC_ERR;
+	}
+
 	if (pairing() != RLC_OK) {
 		return RLC_ERR;
 	}
@@ -1517,12 +1517,15 @@ static int pairing12(void) {
 	ep_t p[2];
 	ep2_t q[2], r;
 	fp12_t e1, e2;
+	pp_prep_t w[2];
 
 	bn_null(k);
 	bn_null(n);
 	fp12_null(e1);
 	fp12_null(e2);
 	ep2_null(r);
+	pp_prep_null(w[0]);
+	pp_prep_null(w[1]);
 
 	RLC_TRY {
 		bn_new(n);
@@ -1536,6 +1539,7 @@ static int pairing12(void) {
 			ep2_null(q[j]);
 			ep_new(p[j]);
 			ep2_new(q[j]);
+			pp_prep_new(w[j]);
 		}
 
 		ep_curve_get_ord(n);
@@ -1805,6 +1809,55 @@ static int pairing12(void) {
 			pp_map_sim_oatep_k12(e1, p, q, 2);
 			TEST_ASSERT(fp12_cmp_dig(e1, 1) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("parallel optimal ate multi-pairing is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_par_oatep_k12(e2, p, q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_par_oatep_k12(e2, p, q, 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[1]);
+			pp_map_par_oatep_k12(e2, p, q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_neg(p[1], p[0]);
+			ep2_copy(q[1], q[0]);
+			pp_map_par_oatep_k12(e1, p, q, 2);
+			TEST_ASSERT(fp12_cmp_dig(e1, 1) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			pp_map_par_oatep_k12(e1, p, q, 1);
+			TEST_ASSERT(fp12_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+#endif
+
+#if PP_MAP == OATEP || !defined(STRIP)
+		TEST_CASE("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_prep_k12(w[0], q[0]);
+			pp_prep_k12(w[1], q[1]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_prep_k12(e2, p[0], w[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_sim_prep_k12(e2, p, w, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[1]);
+			pp_map_sim_prep_k12(e1, p, w, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) != RLC_EQ, end);
+			pp_map_prep_k12(e2, p[0], w[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[0]);
+			pp_prep_k12(w[0], q[0]);
+			pp_map_prep_k12(e1, p[0], w[0]);
+			TEST_ASSERT(fp12_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
 #endif
 	}
 	RLC_CATCH_ANY {
@@ -1822,6 +1875,7 @@ static int pairing12(void) {
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep2_free(q[j]);
+		pp_prep_free(w[j]);
 	}
 	return code;
 }
@@ -2069,12 +2123,15 @@ static int pairing16(void) {
 	ep_t p[2];
 	ep4_t q[2], r;
 	fp16_t e1, e2;
+	pp_prep_t w[2];
 
 	bn_null(k);
 	bn_null(n);
 	fp16_null(e1);
 	fp16_null(e2);
 	ep4_null(r);
+	pp_prep_null(w[0]);
+	pp_prep_null(w[1]);
 
 	RLC_TRY {
 		bn_new(n);
@@ -2088,6 +2145,7 @@ static int pairing16(void) {
 			ep4_null(q[j]);
 			ep_new(p[j]);
 			ep4_new(q[j]);
+			pp_prep_new(w[j]);
 		}
 
 		ep_curve_get_ord(n);
@@ -2342,6 +2400,32 @@ static int pairing16(void) {
 			TEST_ASSERT(fp16_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
 #endif
+
+#if PP_MAP == OATEP || !defined(STRIP)
+		TEST_CASE("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep4_rand(q[0]);
+			ep_rand(p[1]);
+			ep4_rand(q[1]);
+			pp_prep_k16(w[0], q[0]);
+			pp_prep_k16(w[1], q[1]);
+			pp_map_oatep_k16(e1, p[0], q[0]);
+			pp_map_prep_k16(e2, p[0], w[0]);
+			TEST_ASSERT(fp16_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_oatep_k16(e1, p, q, 2);
+			pp_map_sim_prep_k16(e2, p, w, 2);
+			TEST_ASSERT(fp16_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[1]);
+			pp_map_sim_prep_k16(e1, p, w, 2);
+			TEST_ASSERT(fp16_cmp(e1, e2) != RLC_EQ, end);
+			pp_map_prep_k16(e2, p[0], w[0]);
+			TEST_ASSERT(fp16_cmp(e1, e2) == RLC_EQ, end);
+			ep4_set_infty(q[0]);
+			pp_prep_k16(w[0], q[0]);
+			pp_map_prep_k16(e1, p[0], w[0]);
+			TEST_ASSERT(fp16_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -2358,6 +2442,7 @@ static int pairing16(void) {
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep4_free(q[j]);
+		pp_prep_free(w[j]);
 	}
 	return code;
 }
@@ -2611,12 +2696,15 @@ static int pairing18(void) {
 	ep_t p[2];
 	ep3_t q[2], r;
 	fp18_t e1, e2;
+	pp_prep_t w[2];
 
 	bn_null(k);
 	bn_null(n);
 	fp18_null(e1);
 	fp18_null(e2);
 	ep3_null(r);
+	pp_prep_null(w[0]);
+	pp_prep_null(w[1]);
 
 	RLC_TRY {
 		bn_new(n);
@@ -2630,6 +2718,7 @@ static int pairing18(void) {
 			ep3_null(q[j]);
 			ep_new(p[j]);
 			ep3_new(q[j]);
+			pp_prep_new(w[j]);
 		}
 
 		ep_curve_get_ord(n);
@@ -2884,6 +2973,32 @@ static int pairing18(void) {
 			TEST_ASSERT(fp18_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
 #endif
+
+#if PP_MAP == OATEP || !defined(STRIP)
+		TEST_CASE("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep3_rand(q[0]);
+			ep_rand(p[1]);
+			ep3_rand(q[1]);
+			pp_prep_k18(w[0], q[0]);
+			pp_prep_k18(w[1], q[1]);
+			pp_map_oatep_k18(e1, p[0], q[0]);
+			pp_map_prep_k18(e2, p[0], w[0]);
+			TEST_ASSERT(fp18_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_oatep_k18(e1, p, q, 2);
+			pp_map_sim_prep_k18(e2, p, w, 2);
+			TEST_ASSERT(fp18_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[1]);
+			pp_map_sim_prep_k18(e1, p, w, 2);
+			TEST_ASSERT(fp18_cmp(e1, e2) != RLC_EQ, end);
+			pp_map_prep_k18(e2, p[0], w[0]);
+			TEST_ASSERT(fp18_cmp(e1, e2) == RLC_EQ, end);
+			ep3_set_infty(q[0]);
+			pp_prep_k18(w[0], q[0]);
+			pp_map_prep_k18(e1, p[0], w[0]);
+			TEST_ASSERT(fp18_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -2900,6 +3015,7 @@ static int pairing18(void) {
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep3_free(q[j]);
+		pp_prep_free(w[j]);
 	}
 	return code;
 }
@@ -3097,12 +3213,15 @@ static int pairing24(void) {
 	ep_t p[2];
 	ep4_t q[2], r;
 	fp24_t e1, e2;
+	pp_prep_t w[2];
 
 	bn_null(k);
 	bn_null(n);
 	fp24_null(e1);
 	fp24_null(e2);
 	ep4_null(r);
+	pp_prep_null(w[0]);
+	pp_prep_null(w[1]);
 
 	RLC_TRY {
 		bn_new(n);
@@ -3116,6 +3235,7 @@ static int pairing24(void) {
 			ep4_null(q[j]);
 			ep_new(p[j]);
 			ep4_new(q[j]);
+			pp_prep_new(w[j]);
 		}
 
 		ep_curve_get_ord(n);
@@ -3185,6 +3305,32 @@ static int pairing24(void) {
 			pp_map_sim_k24(e1, p, q, 2);
 			TEST_ASSERT(fp24_cmp_dig(e1, 1) == RLC_EQ, end);
 		} TEST_END;
+
+#if PP_MAP == OATEP || !defined(STRIP)
+		TEST_CASE("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep4_rand(q[0]);
+			ep_rand(p[1]);
+			ep4_rand(q[1]);
+			pp_prep_k24(w[0], q[0]);
+			pp_prep_k24(w[1], q[1]);
+			pp_map_k24(e1, p[0], q[0]);
+			pp_map_prep_k24(e2, p[0], w[0]);
+			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_k24(e1, p, q, 2);
+			pp_map_sim_prep_k24(e2, p, w, 2);
+			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[1]);
+			pp_map_sim_prep_k24(e1, p, w, 2);
+			TEST_ASSERT(fp24_cmp(e1, e2) != RLC_EQ, end);
+			pp_map_prep_k24(e2, p[0], w[0]);
+			TEST_ASSERT(fp24_cmp(e1, e2) == RLC_EQ, end);
+			ep4_set_infty(q[0]);
+			pp_prep_k24(w[0], q[0]);
+			pp_map_prep_k24(e1, p[0], w[0]);
+			TEST_ASSERT(fp24_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -3201,6 +3347,7 @@ static int pairing24(void) {
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep4_free(q[j]);
+		pp_prep_free(w[j]);
 	}
 	return code;
 }